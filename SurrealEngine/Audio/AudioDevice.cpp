@@ -270,13 +270,16 @@ public:
 	{
 		sounds.push_back(sound);
 
-		ALenum format = AL_FORMAT_MONO_FLOAT32;
-		if (sound->channels == 2)
-			format = AL_FORMAT_STEREO_FLOAT32;
+		bool stereo = sound->channels == 2;
+		ALenum format = stereo ? AL_FORMAT_STEREO_FLOAT32 : AL_FORMAT_MONO_FLOAT32;
+		if (sound->sampleFormat == SoundSampleFormat::Int16)
+			format = stereo ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16;
+		else if (sound->sampleFormat == SoundSampleFormat::UInt8)
+			format = stereo ? AL_FORMAT_STEREO8 : AL_FORMAT_MONO8;
 
 		ALuint id;
 		alGenBuffers(1, &id);
-		alBufferData(id, format, sound->samples.data(), (ALsizei)(sound->samples.size()*sizeof(sound->samples[0])), sound->frequency);
+		alBufferData(id, format, sound->samples.data(), (ALsizei)sound->samples.size(), sound->frequency);
 		alError = alGetError();
 		if (alError != AL_NO_ERROR)
 			Exception::Throw("Failed to buffer sound data for " + sound->Name.ToString());
@@ -265,6 +265,41 @@ public:
 		}
 	}
 
+	size_t ReadSamples16(int16_t* output, size_t samples) override
+	{
+		if (!eofdata)
+		{
+			size_t samplesread = drwav_read_pcm_frames_s16(&decoder, samples / decoder.channels, output) * decoder.channels;
+			eofdata = (samplesread != samples);
+			return samplesread;
+		}
+		else
+		{
+			return 0;
+		}
+	}
+
+	int GetNativeBits() override
+	{
+		if (decoder.translatedFormatTag == DR_WAVE_FORMAT_PCM && (decoder.bitsPerSample == 8 || decoder.bitsPerSample == 16))
+			return decoder.bitsPerSample;
+		return 0;
+	}
+
+	size_t ReadNativeSamples(void* output, size_t samples) override
+	{
+		if (!eofdata)
+		{
+			size_t samplesread = drwav_read_pcm_frames(&decoder, samples / decoder.channels, output) * decoder.channels;
+			eofdata = (samplesread != samples);
+			return samplesread;
+		}
+		else
+		{
+			return 0;
+		}
+	}
+
 	size_t InputRead(void* pBufferOut, size_t bytesToRead)
 	{
 		size_t available = filedata.size() - inputpos;
@@ -574,6 +609,22 @@ std::unique_ptr<AudioSource> AudioSource::CreateFlac(Array<uint8_t> filedata)
 	return std::make_unique<FlacAudioSource>(std::move(filedata));
 }
 
+size_t AudioSource::ReadSamples16(int16_t* output, size_t samples)
+{
+	float buffer[1024];
+	size_t pos = 0;
+	while (pos < samples)
+	{
+		size_t count = ReadSamples(buffer, std::min(samples - pos, (size_t)1024));
+		for (size_t i = 0; i < count; i++)
+			output[pos + i] = (int16_t)std::clamp(buffer[i] * 32768.0f, -32768.0f, 32767.0f);
+		pos += count;
+		if (count == 0)
+			break;
+	}
+	return pos;
+}
+
 std::unique_ptr<AudioSource> AudioSource::CreateWav(Array<uint8_t> filedata)
 {
 	return std::make_unique<WavAudioSource>(std::move(filedata));
@@ -589,6 +640,87 @@ std::unique_ptr<AudioSource> AudioSource::CreateMod(Array<uint8_t> filedata, boo
 	return std::make_unique<DumbAudioSource>(std::move(filedata), loop, [=](auto handle) { return dumb_read_any(handle, restrict_, subsong); });
 }
 
+class PcmAudioSource : public AudioSource
+{
+public:
+	PcmAudioSource(Array<uint8_t> samples, int bits, int frequency, int channels, bool loop) : samples(std::move(samples)), bits(bits), frequency(frequency), channels(channels), loop(loop)
+	{
+		if ((bits != 8 && bits != 16 && bits != 32) || channels <= 0)
+			Exception::Throw("Unsupported PCM format");
+		count = this->samples.size() / (bits / 8);
+		count -= count % channels;
+	}
+
+	int GetFrequency() override
+	{
+		return frequency;
+	}
+
+	int GetChannels() override
+	{
+		return channels;
+	}
+
+	int GetSamples() override
+	{
+		return (int)(count / channels);
+	}
+
+	void SeekToSample(uint64_t position) override
+	{
+		pos = std::min((size_t)position * channels, count);
+	}
+
+	size_t ReadSamples(float* output, size_t requested) override
+	{
+		size_t total = 0;
+		while (total < requested)
+		{
+			if (pos == count)
+			{
+				if (!loop || count == 0)
+					break;
+				pos = 0;
+			}
+
+			size_t n = std::min(requested - total, count - pos);
+			if (bits == 32)
+			{
+				memcpy(output + total, (const float*)samples.data() + pos, n * sizeof(float));
+			}
+			else if (bits == 16)
+			{
+				const int16_t* src = (const int16_t*)samples.data() + pos;
+				for (size_t i = 0; i < n; i++)
+					output[total + i] = src[i] * (1.0f / 32768.0f);
+			}
+			else
+			{
+				const uint8_t* src = samples.data() + pos;
+				for (size_t i = 0; i < n; i++)
+					output[total + i] = (src[i] - 128) * (1.0f / 128.0f);
+			}
+			pos += n;
+			total += n;
+		}
+		return total;
+	}
+
+private:
+	Array<uint8_t> samples;
+	int bits = 0;
+	int frequency = 0;
+	int channels = 0;
+	bool loop = false;
+	size_t count = 0;
+	size_t pos = 0;
+};
+
+std::unique_ptr<AudioSource> AudioSource::CreatePcm(Array<uint8_t> samples, int bits, int frequency, int channels, bool loop)
+{
+	return std::make_unique<PcmAudioSource>(std::move(samples), bits, frequency, channels, loop);
+}
+
 class ResampleAudioSource : public AudioSource
 {
 public:
@@ -12,6 +12,8 @@ public:
 	static std::unique_ptr<AudioSource> CreateWav(Array<uint8_t> filedata);
 	static std::unique_ptr<AudioSource> CreateOgg(Array<uint8_t> filedata);
 	static std::unique_ptr<AudioSource> CreateMod(Array<uint8_t> filedata, bool loop = true, int restrict_ = 0, int subsong = 0);
+	// Interleaved samples that are already decoded. Bits is 8 (unsigned), 16 (signed) or 32 (float).
+	static std::unique_ptr<AudioSource> CreatePcm(Array<uint8_t> samples, int bits, int frequency, int channels, bool loop);
 	static std::unique_ptr<AudioSource> CreateResampler(int targetFrequency, std::unique_ptr<AudioSource> source);
 
 	AudioSource() = default;
@@ -21,6 +23,12 @@ public:
 	virtual int GetSamples() = 0;
 	virtual void SeekToSample(uint64_t position) = 0;
 	virtual size_t ReadSamples(float* output, size_t samples) = 0;
+	virtual size_t ReadSamples16(int16_t* output, size_t samples);
+
+	// Bits per sample of the source PCM data if ReadNativeSamples can return it unconverted, otherwise 0.
+	// 8-bit samples are unsigned, 16-bit samples signed.
+	virtual int GetNativeBits() { return 0; }
+	virtual size_t ReadNativeSamples(void* output, size_t samples) { return 0; }
 
 	bool bIsLooped = false;
 	uint32_t loopStart = 0;
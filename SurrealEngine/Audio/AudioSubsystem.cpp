@@ -2,11 +2,16 @@
 #include "Precomp.h"
 #include "AudioSubsystem.h"
 #include "AudioSource.h"
+#include "SoundCache.h"
+#include "Engine.h"
 #include "UObject/UActor.h"
 #include "UObject/UClient.h"
 #include "UObject/ULevel.h"
 #include "UObject/USound.h"
 #include "UObject/UMusic.h"
+#include "UObject/USubsystem.h"
+#include "Utils/StrCompare.h"
+#include "Utils/File.h"
 
 AudioSubsystem::AudioSubsystem()
 {
@@ -16,6 +21,20 @@ AudioSubsystem::AudioSubsystem()
 	// TODO: Add option for music buffer count
 	// TODO: Add option for music buffer size
 	Device = AudioDevice::Create(48000, 256, 16, 256);
+
+	std::unique_ptr<SoundCache> cache;
+	if (engine->audiodev->UseSoundCache)
+	{
+		// Entries are keyed by package file path, so all games can share the per user cache folder
+		std::string cachePath = OS::cache_path();
+		std::string cacheFolder = !cachePath.empty() ? FilePath::combine(cachePath, "Sounds") : FilePath::combine(engine->LaunchInfo.gameRootFolder, "System/SE-SoundCache");
+		cache = std::make_unique<SoundCache>(cacheFolder, (uint64_t)std::max(engine->audiodev->SoundCacheSize, 0) * 1024 * 1024);
+	}
+
+	const std::string& sampleFormat = engine->audiodev->SampleFormat;
+	SoundSampleFormat format = StrCompare::equals_ignore_case(sampleFormat, "Float") ? SoundSampleFormat::Float : SoundSampleFormat::Int16;
+	bool nativeFormat = StrCompare::equals_ignore_case(sampleFormat, "Native");
+	Decoder = std::make_unique<SoundDecoder>(format, nativeFormat, std::move(cache));
 }
 
 void AudioSubsystem::SetViewport(UViewport* InViewport)
@@ -48,6 +67,8 @@ UViewport* AudioSubsystem::GetViewport()
 
 void AudioSubsystem::Update(const mat4& listener)
 {
+	Decoder->Update();
+
 	StartAmbience();
 	UpdateAmbience();
 	UpdateSounds(listener);
@@ -58,6 +79,12 @@ void AudioSubsystem::Update(const mat4& listener)
 	Device->Update();
 }
 
+void AudioSubsystem::UpdateWhileLoading()
+{
+	Decoder->Update();
+	Device->Update();
+}
+
 static float distSquared(const vec3& a, const vec3& b)
 {
 	vec3 d = b - a;
@@ -152,10 +179,14 @@ void AudioSubsystem::UpdateSounds(const mat4& listener)
 					PlayingSounds[i] = {};
 				}
 			}
-			else
+			else if (Playing.Sound->IsReady())
 			{
 				Playing.Channel = Device->PlaySound((int)i, Playing.Sound, Playing.Location, SoundVolume * 0.25f, Playing.Radius, Playing.Pitch);
 			}
+			else if (Playing.Sound->IsFailed())
+			{
+				PlayingSounds[i] = {};
+			}
 		}
 	}
 }
@@ -178,7 +209,7 @@ void AudioSubsystem::UpdateMusic()
 		if (CurrentSong && UseDigitalMusic)
 		{
 			int subsong = CurrentSection != 255 ? CurrentSection : 0;
-			Device->PlayMusic(AudioSource::CreateMod(CurrentSong->Data, true, 0, subsong));
+			Device->PlayMusic(Decoder->CreateMusicSource(CurrentSong, subsong));
 		}
 
 		Viewport->Actor()->Transition() = MTRAN_None;
@@ -223,7 +254,10 @@ bool AudioSubsystem::PlaySound(UActor* Actor, int Id, USound* Sound, vec3 Locati
 	if (Index == PlayingSounds.size())
 		return 0;
 
-	Sound->GetSound();
+	// Playback starts in UpdateSounds once the sound has been decoded
+	Sound->RequestSound();
+	if (Sound->IsFailed())
+		return 0;
 
 	// Put the sound on the play-list
 	StopSound(Index);
@@ -232,6 +266,12 @@ bool AudioSubsystem::PlaySound(UActor* Actor, int Id, USound* Sound, vec3 Locati
 	return true;
 }
 
+void AudioSubsystem::PrecacheSounds(const Array<USound*>& sounds)
+{
+	for (USound* sound : sounds)
+		sound->RequestSound();
+}
+
 void AudioSubsystem::StopSound(size_t index)
 {
 	PlayingSound& Playing = PlayingSounds[index];
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AudioDevice.h"
+#include "SoundDecoder.h"
 #include "Math/vec.h"
 #include "Math/mat.h"
 
@@ -36,6 +37,10 @@ public:
 
 	void Update(const mat4& listener);
 
+	// Hands finished decodes to their sounds and keeps the device running without touching the viewport or any actor.
+	// Used while a map is loading.
+	void UpdateWhileLoading();
+
 	bool PlaySound(UActor* Actor, int Id, USound* Sound, vec3 Location, float Volume, float Radius, float Pitch);
 	void NoteDestroy(UActor* Actor);
 
@@ -44,6 +49,10 @@ public:
 	void StopSounds();
 
 	AudioDevice* GetDevice() { return Device.get(); }
+	SoundDecoder* GetSoundDecoder() { return Decoder.get(); }
+
+	// Starts decoding the sounds in the background so they are ready when first played
+	void PrecacheSounds(const Array<USound*>& sounds);
 
 private:
 	void StartAmbience();
@@ -65,6 +74,7 @@ private:
 	float DopplerSpeed = 9000.0f;
 
 	std::unique_ptr<AudioDevice> Device;
+	std::unique_ptr<SoundDecoder> Decoder;
 	Array<PlayingSound> PlayingSounds;
 	UMusic* CurrentSong = nullptr;
 	int CurrentSection = 255;
@@ -0,0 +1,226 @@
+
+#include "Precomp.h"
+#include "SoundCache.h"
+#include "Utils/File.h"
+#include "Utils/Logger.h"
+#include <cstdio>
+
+namespace
+{
+	const uint32_t CacheSignature = 0x43534553; // "SESC"
+	const uint32_t CacheVersion = 3;
+
+	// The key follows the header and is compared on read, so two keys with the same hash never return the wrong sound
+	struct CacheHeader
+	{
+		uint32_t Signature;
+		uint32_t Version;
+		uint32_t KeySize;
+		int32_t Frequency;
+		int32_t Channels;
+		uint32_t SampleFormat;
+		uint32_t Looped;
+		uint64_t LoopStart;
+		uint64_t LoopEnd;
+		uint64_t SampleCount;
+	};
+}
+
+SoundCache::SoundCache(const std::string& cacheFolder, uint64_t maxSize) : cacheFolder(cacheFolder), maxSize(maxSize)
+{
+	try
+	{
+		Directory::make_directory(cacheFolder);
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Could not create sound cache folder: ") + e.what());
+	}
+
+	LoadIndex();
+	Evict();
+}
+
+SoundCache::~SoundCache()
+{
+	if (indexChanged)
+		SaveIndex();
+}
+
+bool SoundCache::Read(const std::string& key, const char* variant, DecodedSound& sound)
+{
+	std::string name = GetEntryName(key, variant);
+	try
+	{
+		std::shared_ptr<File> file = File::try_open_existing(FilePath::combine(cacheFolder, name));
+		if (!file)
+			return false;
+
+		CacheHeader header = {};
+		file->read(&header, sizeof(CacheHeader));
+		if (header.Signature != CacheSignature || header.Version != CacheVersion || header.KeySize != key.size())
+			return false;
+		if (header.SampleFormat > (uint32_t)SoundSampleFormat::UInt8)
+			return false;
+		SoundSampleFormat format = (SoundSampleFormat)header.SampleFormat;
+		uint64_t headerSize = sizeof(CacheHeader) + key.size();
+		if (header.Frequency <= 0 || header.Channels <= 0 || header.SampleCount > (uint64_t)(file->size() - headerSize) / GetSampleSize(format))
+			return false;
+
+		std::string storedKey(key.size(), '\0');
+		if (!storedKey.empty())
+			file->read(storedKey.data(), storedKey.size());
+		if (storedKey != key)
+			return false;
+
+		sound.Frequency = header.Frequency;
+		sound.Channels = header.Channels;
+		sound.SampleFormat = format;
+		sound.LoopInfo.Looped = header.Looped != 0;
+		sound.LoopInfo.LoopStart = header.LoopStart;
+		sound.LoopInfo.LoopEnd = header.LoopEnd;
+		sound.Samples.resize((size_t)header.SampleCount * GetSampleSize(format));
+		if (!sound.Samples.empty())
+			file->read(sound.Samples.data(), sound.Samples.size());
+
+		std::unique_lock<std::mutex> lock(mutex);
+		Touch(name, file->size());
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Ignoring sound cache entry: ") + e.what());
+		sound = {};
+		return false;
+	}
+}
+
+void SoundCache::Store(const std::string& key, const char* variant, const DecodedSound& sound)
+{
+	CacheHeader header = {};
+	header.Signature = CacheSignature;
+	header.Version = CacheVersion;
+	header.KeySize = (uint32_t)key.size();
+	header.Frequency = sound.Frequency;
+	header.Channels = sound.Channels;
+	header.SampleFormat = (uint32_t)sound.SampleFormat;
+	header.Looped = sound.LoopInfo.Looped ? 1 : 0;
+	header.LoopStart = sound.LoopInfo.LoopStart;
+	header.LoopEnd = sound.LoopInfo.LoopEnd;
+	header.SampleCount = sound.Samples.size() / GetSampleSize(sound.SampleFormat);
+
+	// Written atomically so a reader never sees a partial entry. If two threads store the same sound, the last one wins.
+	std::string name = GetEntryName(key, variant);
+	try
+	{
+		File::write_atomic(FilePath::combine(cacheFolder, name), [&](File& file) {
+			file.write(&header, sizeof(CacheHeader));
+			file.write(key.data(), key.size());
+			if (!sound.Samples.empty())
+				file.write(sound.Samples.data(), sound.Samples.size());
+		});
+
+		std::unique_lock<std::mutex> lock(mutex);
+		Touch(name, sizeof(CacheHeader) + key.size() + sound.Samples.size());
+		Evict();
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Could not store sound cache entry: ") + e.what());
+	}
+}
+
+void SoundCache::Touch(const std::string& name, uint64_t size)
+{
+	Entry& entry = entries[name];
+	totalSize = totalSize - entry.Size + size;
+	entry.Size = size;
+	entry.LastUse = ++useCounter;
+	indexChanged = true;
+}
+
+void SoundCache::Evict()
+{
+	// The most recently used entry is always kept, even if it alone is over the budget
+	while (totalSize > maxSize && entries.size() > 1)
+	{
+		auto oldest = std::min_element(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.second.LastUse < b.second.LastUse; });
+		std::remove(FilePath::combine(cacheFolder, oldest->first).c_str());
+		totalSize -= oldest->second.Size;
+		entries.erase(oldest);
+		indexChanged = true;
+	}
+}
+
+void SoundCache::LoadIndex()
+{
+	for (const std::string& name : Directory::files(FilePath::combine(cacheFolder, "*.pcm")))
+	{
+		FileStats stats;
+		if (File::try_get_stats(FilePath::combine(cacheFolder, name), stats))
+		{
+			entries[name].Size = stats.size;
+			totalSize += stats.size;
+		}
+	}
+
+	// The index lists the entries from least to most recently used. Entries missing from it count as the oldest.
+	std::string indexFilename = FilePath::combine(cacheFolder, "index.txt");
+	FileStats stats;
+	if (!File::try_get_stats(indexFilename, stats))
+		return;
+
+	try
+	{
+		for (const std::string& name : File::read_all_lines(indexFilename))
+		{
+			auto it = entries.find(name);
+			if (it != entries.end())
+				it->second.LastUse = ++useCounter;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Could not read sound cache index: ") + e.what());
+	}
+}
+
+void SoundCache::SaveIndex()
+{
+	Array<std::pair<uint64_t, const std::string*>> order;
+	order.reserve(entries.size());
+	for (const auto& it : entries)
+		order.push_back({ it.second.LastUse, &it.first });
+	std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+	std::string text;
+	for (const auto& it : order)
+	{
+		text += *it.second;
+		text += '\n';
+	}
+
+	try
+	{
+		File::write_all_text_atomic(FilePath::combine(cacheFolder, "index.txt"), text);
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Could not save sound cache index: ") + e.what());
+	}
+}
+
+std::string SoundCache::GetEntryName(const std::string& key, const char* variant) const
+{
+	// 64-bit FNV-1a of the key. Stable across builds, unlike std::hash.
+	uint64_t hash = 14695981039346656037ULL;
+	for (char c : key)
+	{
+		hash ^= (uint8_t)c;
+		hash *= 1099511628211ULL;
+	}
+
+	char name[64];
+	std::snprintf(name, sizeof(name), "%016llx-%s.pcm", (unsigned long long)hash, variant);
+	return name;
+}
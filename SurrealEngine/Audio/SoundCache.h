@@ -0,0 +1,40 @@
+#pragma once
+
+#include "SoundDecoder.h"
+#include <unordered_map>
+
+// Decoded ogg, mp3 and flac sounds and music kept on disk between sessions, one file per entry.
+// Entries are keyed by a string naming the package file, its size and write time and the object, so lookups never hash the sound data.
+// The variant names the decode settings used, so changing them does not return stale entries.
+// The folder is kept below maxSize bytes by removing the least recently used entries. Safe to use from any thread.
+class SoundCache
+{
+public:
+	SoundCache(const std::string& cacheFolder, uint64_t maxSize);
+	~SoundCache();
+
+	bool Read(const std::string& key, const char* variant, DecodedSound& sound);
+	void Store(const std::string& key, const char* variant, const DecodedSound& sound);
+
+private:
+	struct Entry
+	{
+		uint64_t Size = 0;
+		uint64_t LastUse = 0;
+	};
+
+	std::string GetEntryName(const std::string& key, const char* variant) const;
+	void Touch(const std::string& name, uint64_t size);
+	void Evict();
+	void LoadIndex();
+	void SaveIndex();
+
+	std::string cacheFolder;
+	uint64_t maxSize = 0;
+
+	std::mutex mutex;
+	std::unordered_map<std::string, Entry> entries;
+	uint64_t totalSize = 0;
+	uint64_t useCounter = 0;
+	bool indexChanged = false;
+};
@@ -0,0 +1,315 @@
+
+#include "Precomp.h"
+#include "SoundDecoder.h"
+#include "SoundCache.h"
+#include "AudioSource.h"
+#include "UObject/UMusic.h"
+#include "Package/Package.h"
+#include "Utils/File.h"
+
+SoundDecoder::SoundDecoder(SoundSampleFormat format, bool nativeFormat, std::unique_ptr<SoundCache> cache) : format(format), nativeFormat(nativeFormat), cache(std::move(cache))
+{
+	int count = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+	for (int i = 0; i < count; i++)
+	{
+		threads.push_back(std::thread([this]() { WorkerMain(); }));
+	}
+}
+
+SoundDecoder::~SoundDecoder()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	stopFlag = true;
+	lock.unlock();
+	condition.notify_all();
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void SoundDecoder::Queue(USound* sound)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	if (FindJob(sound) != jobs.end())
+		return;
+
+	Job job;
+	job.Sound = sound;
+	jobs.push_back(std::move(job));
+	lock.unlock();
+	condition.notify_one();
+}
+
+void SoundDecoder::Update()
+{
+	std::list<Job> finished;
+	std::unique_lock<std::mutex> lock(mutex);
+	auto it = jobs.begin();
+	while (it != jobs.end())
+	{
+		auto next = std::next(it);
+		if (it->Finished)
+			finished.splice(finished.end(), jobs, it);
+		it = next;
+	}
+	lock.unlock();
+
+	for (Job& job : finished)
+	{
+		job.Sound->SetDecodedSound(std::move(job.Result));
+	}
+}
+
+DecodedSound SoundDecoder::Wait(USound* sound)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	auto it = FindJob(sound);
+	if (it == jobs.end())
+	{
+		lock.unlock();
+		return Decode(sound);
+	}
+
+	if (!it->Running && !it->Finished)
+	{
+		// Still in the queue. Faster to decode it here than to wait for a worker.
+		jobs.erase(it);
+		lock.unlock();
+		return Decode(sound);
+	}
+
+	jobFinished.wait(lock, [&]() { return it->Finished; });
+	DecodedSound result = std::move(it->Result);
+	jobs.erase(it);
+	return result;
+}
+
+void SoundDecoder::Cancel(USound* sound)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	auto it = FindJob(sound);
+	if (it == jobs.end())
+		return;
+
+	if (it->Running)
+	{
+		// The worker removes it when done
+		it->Cancelled = true;
+		jobFinished.wait(lock, [&]() { return FindCancelledJob(sound) == jobs.end(); });
+	}
+	else
+	{
+		jobs.erase(it);
+	}
+}
+
+std::list<SoundDecoder::Job>::iterator SoundDecoder::FindJob(USound* sound)
+{
+	for (auto it = jobs.begin(); it != jobs.end(); ++it)
+	{
+		if (it->Sound == sound && !it->Cancelled)
+			return it;
+	}
+	return jobs.end();
+}
+
+std::list<SoundDecoder::Job>::iterator SoundDecoder::FindCancelledJob(USound* sound)
+{
+	for (auto it = jobs.begin(); it != jobs.end(); ++it)
+	{
+		if (it->Sound == sound && it->Cancelled)
+			return it;
+	}
+	return jobs.end();
+}
+
+void SoundDecoder::WorkerMain()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		auto it = jobs.end();
+		condition.wait(lock, [&]() {
+			if (stopFlag)
+				return true;
+			it = std::find_if(jobs.begin(), jobs.end(), [](const Job& job) { return !job.Running && !job.Finished; });
+			return it != jobs.end();
+		});
+		if (stopFlag)
+			break;
+
+		it->Running = true;
+		USound* sound = it->Sound;
+		lock.unlock();
+
+		DecodedSound result = Decode(sound);
+
+		lock.lock();
+		it->Running = false;
+		if (it->Cancelled)
+		{
+			jobs.erase(it);
+			jobFinished.notify_all();
+		}
+		else
+		{
+			it->Result = std::move(result);
+			it->Finished = true;
+			jobFinished.notify_all();
+		}
+	}
+}
+
+DecodedSound SoundDecoder::Decode(USound* sound)
+{
+	return DecodeCached(sound, sound->Data);
+}
+
+std::unique_ptr<AudioSource> SoundDecoder::CreateMusicSource(UMusic* music, int subsong)
+{
+	if (!IsCompressed(music->Data))
+		return AudioSource::CreateMod(music->Data, true, 0, subsong);
+
+	DecodedSound decoded = DecodeCached(music, music->Data);
+	if (!decoded.Error.empty())
+		Exception::Throw("Could not decode music " + music->Name.ToString() + ": " + decoded.Error);
+	return AudioSource::CreatePcm(std::move(decoded.Samples), GetSampleSize(decoded.SampleFormat) * 8, decoded.Frequency, decoded.Channels, true);
+}
+
+bool SoundDecoder::IsCompressed(const Array<uint8_t>& data)
+{
+	if (data.size() < 4)
+		return false;
+	const uint8_t* d = data.data();
+	bool ogg = d[0] == 'O' && d[1] == 'g' && d[2] == 'g' && d[3] == 'S';
+	bool flac = d[0] == 'f' && d[1] == 'L' && d[2] == 'a' && d[3] == 'C';
+	bool mp3 = (d[0] == 'I' && d[1] == 'D' && d[2] == '3') || (d[0] == 0xff && (d[1] & 0xe0) == 0xe0);
+	return ogg || flac || mp3;
+}
+
+DecodedSound SoundDecoder::DecodeCached(const UObject* object, const Array<uint8_t>& data)
+{
+	if (!cache || !IsCompressed(data))
+		return DecodeSource(data);
+
+	std::string key = GetCacheKey(object, data);
+	if (key.empty())
+		return DecodeSource(data);
+
+	const char* variant = nativeFormat ? "native" : format == SoundSampleFormat::Int16 ? "int16" : "float";
+
+	DecodedSound sound;
+	if (cache->Read(key, variant, sound))
+		return sound;
+
+	sound = DecodeSource(data);
+	if (sound.Error.empty())
+		cache->Store(key, variant, sound);
+	return sound;
+}
+
+std::string SoundDecoder::GetCacheKey(const UObject* object, const Array<uint8_t>& data)
+{
+	// The package file's size and write time change whenever the package is rebuilt, which is all that is needed to spot stale entries
+	if (!object->package)
+		return {};
+	std::string filename = object->package->GetPackageFilename();
+	FileStats stats;
+	if (filename.empty() || !File::try_get_stats(filename, stats))
+		return {};
+	return filename + "|" + std::to_string(stats.size) + "|" + std::to_string(stats.modified) + "|" + std::to_string(object->exportIndex) + "|" + std::to_string(data.size());
+}
+
+// Sample buffers are padded to a multiple of 4 samples
+constexpr size_t AlignSampleCount(size_t count)
+{
+	return (count + 3) & ~(size_t)3;
+}
+
+// Reads until the source runs dry, as compressed sources do not always know their length up front
+template<typename T>
+static void ReadAllSamples(AudioSource* source, Array<uint8_t>& samples, size_t expected, size_t (AudioSource::*read)(T*, size_t))
+{
+	size_t capacity = expected > 0 ? expected : 65536;
+	size_t count = 0;
+	samples.resize(capacity * sizeof(T));
+	while (true)
+	{
+		if (count == capacity)
+		{
+			// Only grow once the source proves to have more
+			T probe[1024];
+			size_t got = (source->*read)(probe, 1024);
+			if (got == 0)
+				break;
+			capacity = std::max(capacity * 2, count + got);
+			samples.resize(capacity * sizeof(T));
+			memcpy((T*)samples.data() + count, probe, got * sizeof(T));
+			count += got;
+			continue;
+		}
+
+		size_t got = (source->*read)((T*)samples.data() + count, capacity - count);
+		if (got == 0)
+			break;
+		count += got;
+	}
+	samples.resize(AlignSampleCount(count) * sizeof(T));
+	std::fill(samples.begin() + count * sizeof(T), samples.end(), 0);
+}
+
+DecodedSound SoundDecoder::DecodeSource(const Array<uint8_t>& data)
+{
+	DecodedSound sound;
+	try
+	{
+		// The source owns its copy of the data. This only runs when the disk cache does not have the sound yet.
+		std::unique_ptr<AudioSource> source;
+		if (data.size() >= 4 && memcmp(data.data(), "OggS", 4) == 0)
+			source = AudioSource::CreateOgg(data);
+		else if (data.size() >= 4 && memcmp(data.data(), "fLaC", 4) == 0)
+			source = AudioSource::CreateFlac(data);
+		else if (IsCompressed(data))
+			source = AudioSource::CreateMp3(data);
+		else
+			source = AudioSource::CreateWav(data);
+
+		size_t count = AlignSampleCount((size_t)source->GetSamples() * source->GetChannels());
+		int nativeBits = nativeFormat ? source->GetNativeBits() : 0;
+		if (nativeBits == 8)
+		{
+			sound.SampleFormat = SoundSampleFormat::UInt8;
+			sound.Samples.resize(count, 128);
+			count = AlignSampleCount(source->ReadNativeSamples(sound.Samples.data(), count));
+			sound.Samples.resize(count, 128);
+		}
+		else if (nativeBits == 16)
+		{
+			sound.SampleFormat = SoundSampleFormat::Int16;
+			sound.Samples.resize(count * sizeof(int16_t));
+			count = AlignSampleCount(source->ReadNativeSamples(sound.Samples.data(), count));
+			sound.Samples.resize(count * sizeof(int16_t));
+		}
+		else if (format == SoundSampleFormat::Int16)
+		{
+			sound.SampleFormat = SoundSampleFormat::Int16;
+			ReadAllSamples<int16_t>(source.get(), sound.Samples, count, &AudioSource::ReadSamples16);
+		}
+		else
+		{
+			sound.SampleFormat = SoundSampleFormat::Float;
+			ReadAllSamples<float>(source.get(), sound.Samples, count, &AudioSource::ReadSamples);
+		}
+
+		sound.Frequency = source->GetFrequency();
+		sound.Channels = source->GetChannels();
+
+		sound.LoopInfo.Looped = source->bIsLooped;
+		sound.LoopInfo.LoopStart = source->loopStart;
+		sound.LoopInfo.LoopEnd = source->loopEnd;
+	}
+	catch (const std::exception& e)
+	{
+		sound.Error = e.what();
+	}
+	return sound;
+}
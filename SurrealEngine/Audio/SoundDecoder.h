@@ -0,0 +1,81 @@
+#pragma once
+
+#include "UObject/USound.h"
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <list>
+
+class SoundCache;
+class AudioSource;
+class UMusic;
+
+class DecodedSound
+{
+public:
+	Array<uint8_t> Samples;
+	SoundSampleFormat SampleFormat = SoundSampleFormat::Float;
+	int Frequency = 0;
+	int Channels = 0;
+	AudioLoopInfo LoopInfo;
+	std::string Error;
+};
+
+// Decodes sounds on worker threads. The results are handed back to the sounds on the main thread.
+class SoundDecoder
+{
+public:
+	SoundDecoder(SoundSampleFormat format, bool nativeFormat, std::unique_ptr<SoundCache> cache);
+	~SoundDecoder();
+
+	// Queue a sound for decoding. Does nothing if it is already queued.
+	void Queue(USound* sound);
+
+	// Apply the sounds that finished decoding since the last call
+	void Update();
+
+	// Get the sound decoded now, either by taking the finished result, waiting for the worker or decoding it on this thread
+	DecodedSound Wait(USound* sound);
+
+	// Forget about a sound. Called when the sound is destroyed. Waits for a worker still decoding it, as the worker reads the sound's data.
+	void Cancel(USound* sound);
+
+	// Decode on the calling thread, using the disk cache if there is one. Can be called from any thread.
+	DecodedSound Decode(USound* sound);
+
+	// Create a looping source for a song. Modules are rendered as they play. Ogg, mp3 and flac songs are decoded up front, or read from the disk cache.
+	std::unique_ptr<AudioSource> CreateMusicSource(UMusic* music, int subsong);
+
+	// True for the formats worth caching: ogg, mp3 and flac. Wav data is already PCM and decodes faster than the cache can be read.
+	static bool IsCompressed(const Array<uint8_t>& data);
+
+private:
+	// Jobs read the compressed data from the sound itself, which stays alive until the job is cancelled or collected
+	struct Job
+	{
+		USound* Sound = nullptr;
+		bool Running = false;
+		bool Finished = false;
+		bool Cancelled = false;
+		DecodedSound Result;
+	};
+
+	void WorkerMain();
+	DecodedSound DecodeCached(const UObject* object, const Array<uint8_t>& data);
+	DecodedSound DecodeSource(const Array<uint8_t>& data);
+	static std::string GetCacheKey(const UObject* object, const Array<uint8_t>& data);
+	std::list<Job>::iterator FindJob(USound* sound);
+	std::list<Job>::iterator FindCancelledJob(USound* sound);
+
+	// Format used when the native format is not wanted or not available
+	SoundSampleFormat format = SoundSampleFormat::Float;
+	bool nativeFormat = false;
+	std::unique_ptr<SoundCache> cache;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::condition_variable jobFinished;
+	std::list<Job> jobs;
+	Array<std::thread> threads;
+	bool stopFlag = false;
+};
@@ -8,60 +8,181 @@ void CollisionHash::AddToCollision(UActor* actor)
 {
 	if (actor->bCollideActors())
 	{
-		vec3 location = actor->Location();
-		float height = actor->CollisionHeight();
-		float radius = actor->CollisionRadius();
-		vec3 extents = { radius, radius, height };
+		int level;
+		uint32_t bucketId;
+		GetActorBucket(actor, level, bucketId);
 
 		actor->CollisionHashInfo.Inserted = true;
-		actor->CollisionHashInfo.Location = location;
-		actor->CollisionHashInfo.Height = height;
-		actor->CollisionHashInfo.Radius = radius;
+		actor->CollisionHashInfo.GridLevel = level;
+		actor->CollisionHashInfo.BucketId = bucketId;
 
-		ivec3 start = GetStartExtents(location, extents);
-		ivec3 end = GetEndExtents(location, extents);
-		for (int z = start.z; z < end.z; z++)
+		if (level < 0)
 		{
-			for (int y = start.y; y < end.y; y++)
-			{
-				for (int x = start.x; x < end.x; x++)
-				{
-					CollisionActors[GetBucketId(x, y, z)].push_back(actor);
-				}
-			}
+			HugeActors.push_back(actor);
+			return;
 		}
+
+		AddToBucket(bucketId, actor);
+		LevelActorCount[level]++;
 	}
 }
 
+void CollisionHash::UpdateCollision(UActor* actor)
+{
+	if (actor->CollisionHashInfo.Inserted && actor->bCollideActors())
+	{
+		int level;
+		uint32_t bucketId;
+		GetActorBucket(actor, level, bucketId);
+		if (level == actor->CollisionHashInfo.GridLevel && bucketId == actor->CollisionHashInfo.BucketId)
+			return;
+	}
+
+	RemoveFromCollision(actor);
+	AddToCollision(actor);
+}
+
+void CollisionHash::GetActorBucket(UActor* actor, int& level, uint32_t& bucketId)
+{
+	level = GetGridLevel(std::max(actor->CollisionHeight(), actor->CollisionRadius()));
+	if (level < 0)
+	{
+		bucketId = 0;
+		return;
+	}
+
+	vec3 location = actor->Location();
+	float scale = 1.0f / GetCellSize(level);
+	int x = (int)std::floor(location.x * scale);
+	int y = (int)std::floor(location.y * scale);
+	int z = (int)std::floor(location.z * scale);
+	bucketId = GetBucketId(level, x, y, z);
+}
+
 void CollisionHash::RemoveFromCollision(UActor* actor)
 {
 	if (actor->CollisionHashInfo.Inserted)
 	{
-		vec3 location = actor->CollisionHashInfo.Location;
-		float height = actor->CollisionHashInfo.Height;
-		float radius = actor->CollisionHashInfo.Radius;
-		vec3 extents = { radius, radius, height };
-
-		ivec3 start = GetStartExtents(location, extents);
-		ivec3 end = GetEndExtents(location, extents);
-		for (int z = start.z; z < end.z; z++)
+		int level = actor->CollisionHashInfo.GridLevel;
+		if (level < 0)
+		{
+			auto it = std::find(HugeActors.begin(), HugeActors.end(), actor);
+			if (it != HugeActors.end())
+			{
+				*it = HugeActors.back();
+				HugeActors.pop_back();
+			}
+		}
+		else
+		{
+			RemoveFromBucket(actor->CollisionHashInfo.BucketId, actor);
+			LevelActorCount[level]--;
+		}
+
+		actor->CollisionHashInfo.Inserted = false;
+	}
+}
+
+CollisionHash::CollisionHash()
+{
+	Resize(1024);
+}
+
+void CollisionHash::AddToBucket(uint32_t bucketId, UActor* actor)
+{
+	size_t slot = GetSlot(bucketId);
+	while (true)
+	{
+		Cell& cell = Cells[slot];
+		if (cell.Count == 0)
+			break;
+		if (cell.BucketId == bucketId && cell.Count < Cell::Capacity)
 		{
-			for (int y = start.y; y < end.y; y++)
+			cell.Actors[cell.Count++] = actor;
+			return;
+		}
+		slot = (slot + 1) & SlotMask;
+	}
+
+	// Keep the table at most half full so probe sequences stay short
+	if ((UsedCells + 1) * 2 > Cells.size())
+	{
+		Resize(Cells.size() * 2);
+		AddToBucket(bucketId, actor);
+		return;
+	}
+
+	Cell& cell = Cells[slot];
+	cell.BucketId = bucketId;
+	cell.Count = 1;
+	cell.Actors[0] = actor;
+	UsedCells++;
+}
+
+void CollisionHash::RemoveFromBucket(uint32_t bucketId, UActor* actor)
+{
+	size_t slot = GetSlot(bucketId);
+	while (true)
+	{
+		Cell& cell = Cells[slot];
+		if (cell.Count == 0)
+			return;
+
+		if (cell.BucketId == bucketId)
+		{
+			for (uint32_t i = 0; i < cell.Count; i++)
 			{
-				for (int x = start.x; x < end.x; x++)
+				if (cell.Actors[i] == actor)
 				{
-					auto it = CollisionActors.find(GetBucketId(x, y, z));
-					if (it != CollisionActors.end())
-					{
-						it->second.remove(actor);
-						if (it->second.empty())
-							CollisionActors.erase(it);
-					}
+					cell.Actors[i] = cell.Actors[--cell.Count];
+					if (cell.Count == 0)
+						RemoveCell(slot);
+					return;
 				}
 			}
 		}
+		slot = (slot + 1) & SlotMask;
+	}
+}
 
-		actor->CollisionHashInfo.Inserted = false;
+void CollisionHash::RemoveCell(size_t slot)
+{
+	// Backward shift deletion: move later cells of the probe run into the hole unless that would put them before their home slot
+	size_t hole = slot;
+	size_t next = slot;
+	while (true)
+	{
+		next = (next + 1) & SlotMask;
+		if (Cells[next].Count == 0)
+			break;
+
+		size_t home = GetSlot(Cells[next].BucketId);
+		bool homeInRange = (hole <= next) ? (home > hole && home <= next) : (home > hole || home <= next);
+		if (!homeInRange)
+		{
+			Cells[hole] = Cells[next];
+			hole = next;
+		}
+	}
+	Cells[hole].Count = 0;
+	UsedCells--;
+}
+
+void CollisionHash::Resize(size_t slotCount)
+{
+	Array<Cell> oldCells = std::move(Cells);
+	Cells.clear();
+	Cells.resize(slotCount);
+	SlotMask = slotCount - 1;
+	SlotShift = 32;
+	while (((size_t)1 << (32 - SlotShift)) < slotCount)
+		SlotShift--;
+	UsedCells = 0;
+
+	for (const Cell& cell : oldCells)
+	{
+		for (UActor* actor : cell)
+			AddToBucket(cell.BucketId, actor);
 	}
 }
 
@@ -451,52 +572,14 @@ Array<UActor*> CollisionHash::CollidingActors(const vec3& origin, float radius)
 	double dradius = radius;
 	vec3 extents = { radius, radius, radius };
 
+	// Every actor is in exactly one cell, so no duplicates need to be removed
 	Array<UActor*> hits;
-
-	ivec3 start = GetStartExtents(origin, extents);
-	ivec3 end = GetEndExtents(origin, extents);
-	if (end.x - start.x < 100 && end.y - start.y < 100 && end.z - start.z < 100)
-	{
-		for (int z = start.z; z < end.z; z++)
-		{
-			for (int y = start.y; y < end.y; y++)
-			{
-				for (int x = start.x; x < end.x; x++)
-				{
-					auto it = CollisionActors.find(GetBucketId(x, y, z));
-					if (it != CollisionActors.end())
-					{
-						for (UActor* actor : it->second)
-						{
-							if (SphereActorOverlap(dorigin, dradius, actor))
-								hits.push_back(actor);
-						}
-					}
-				}
-			}
-		}
-	}
-
-	std::set<UActor*> seenActors;
-	Array<UActor*> uniqueHits;
-	uniqueHits.reserve(hits.size());
-	for (auto& hit : hits)
-	{
-		if (hit)
-		{
-			if (seenActors.find(hit) == seenActors.end())
-			{
-				seenActors.insert(hit);
-				uniqueHits.push_back(hit);
-			}
-		}
-		else
-		{
-			uniqueHits.push_back(hit);
-		}
-	}
-
-	return uniqueHits;
+	ForEachActor(origin - extents, origin + extents, [&](UActor* actor) {
+		if (SphereActorOverlap(dorigin, dradius, actor))
+			hits.push_back(actor);
+		return true;
+	});
+	return hits;
 }
 
 Array<UActor*> CollisionHash::CollidingActors(const vec3& origin, float height, float radius)
@@ -507,49 +590,10 @@ Array<UActor*> CollisionHash::CollidingActors(const vec3& origin, float height,
 	vec3 extents = { radius, radius, height };
 
 	Array<UActor*> hits;
-
-	ivec3 start = GetStartExtents(origin, extents);
-	ivec3 end = GetEndExtents(origin, extents);
-	if (end.x - start.x < 100 && end.y - start.y < 100 && end.z - start.z < 100)
-	{
-		for (int z = start.z; z < end.z; z++)
-		{
-			for (int y = start.y; y < end.y; y++)
-			{
-				for (int x = start.x; x < end.x; x++)
-				{
-					auto it = CollisionActors.find(GetBucketId(x, y, z));
-					if (it != CollisionActors.end())
-					{
-						for (UActor* actor : it->second)
-						{
-							if (CylinderActorOverlap(dorigin, dheight, dradius, actor))
-								hits.push_back(actor);
-						}
-					}
-				}
-			}
-		}
-	}
-
-	std::set<UActor*> seenActors;
-	Array<UActor*> uniqueHits;
-	uniqueHits.reserve(hits.size());
-	for (auto& hit : hits)
-	{
-		if (hit)
-		{
-			if (seenActors.find(hit) == seenActors.end())
-			{
-				seenActors.insert(hit);
-				uniqueHits.push_back(hit);
-			}
-		}
-		else
-		{
-			uniqueHits.push_back(hit);
-		}
-	}
-
-	return uniqueHits;
+	ForEachActor(origin - extents, origin + extents, [&](UActor* actor) {
+		if (CylinderActorOverlap(dorigin, dheight, dradius, actor))
+			hits.push_back(actor);
+		return true;
+	});
+	return hits;
 }
@@ -1,86 +1,76 @@
 #pragma once
 
 #include "Math/vec.h"
-#include <unordered_map>
-#include <list>
 
 class UActor;
 
 class CollisionHash
 {
 public:
-	std::unordered_map<uint32_t, std::list<UActor*>> CollisionActors;
+	// Open addressing table slot. A bucket holding more actors than fit in one cell continues in further cells with the same id.
+	struct Cell
+	{
+		enum { Capacity = 6 };
+
+		uint32_t BucketId = 0;
+		uint32_t Count = 0; // Zero marks an unused slot
+		UActor* Actors[Capacity];
+
+		UActor* const* begin() const { return Actors; }
+		UActor* const* end() const { return Actors + Count; }
+	};
+
+	CollisionHash();
 
 	void AddToCollision(UActor* actor);
 	void RemoveFromCollision(UActor* actor);
 
+	// Call after the actor moved or changed its collision. Only touches the hash if the actor left its cell.
+	void UpdateCollision(UActor* actor);
+
+	// Iterate the cells of a bucket:
+	// for (const Cell* cell = hash.FirstCell(id); cell; cell = hash.NextCell(cell))
+	const Cell* FirstCell(uint32_t bucketId) const { return FindCell(bucketId, GetSlot(bucketId)); }
+	const Cell* NextCell(const Cell* cell) const { return FindCell(cell->BucketId, ((cell - Cells.data()) + 1) & SlotMask); }
+
 	Array<UActor*> CollidingActors(const vec3& origin, float radius);
 	Array<UActor*> CollidingActors(const vec3& origin, float height, float radius);
 
-	static ivec3 GetStartExtents(const vec3& location, const vec3& extents)
-	{
-		int xx = (int)std::floor((location.x - extents.x) * (1.0f / 256.0f));
-		int yy = (int)std::floor((location.y - extents.y) * (1.0f / 256.0f));
-		int zz = (int)std::floor((location.z - extents.z) * (1.0f / 256.0f));
-		return { xx, yy, zz };
-	}
+	// Each actor lives in one cell of the grid level whose cell size fits the actor's bounds.
+	// Cells are loose: an actor may extend up to half a cell outside of its cell.
+	enum { GridLevels = 8 };
 
-	static ivec3 GetRayStartExtents(const vec3& from, const vec3& to)
+	static float GetCellSize(int level)
 	{
-		float x = std::min(from.x, to.x);
-		float y = std::min(from.y, to.y);
-		float z = std::min(from.z, to.z);
-		int xx = (int)std::floor(x * (1.0f / 256.0f));
-		int yy = (int)std::floor(y * (1.0f / 256.0f));
-		int zz = (int)std::floor(z * (1.0f / 256.0f));
-		return { xx, yy, zz };
+		return (float)(256 << level);
 	}
 
-	static ivec3 GetSweepStartExtents(const vec3& from, const vec3& to, const vec3& extents)
+	// Returns -1 if the actor is too large for any level
+	static int GetGridLevel(float extent)
 	{
-		float x = std::min(from.x, to.x) - extents.x;
-		float y = std::min(from.y, to.y) - extents.y;
-		float z = std::min(from.z, to.z) - extents.z;
-		int xx = (int)std::floor(x * (1.0f / 256.0f));
-		int yy = (int)std::floor(y * (1.0f / 256.0f));
-		int zz = (int)std::floor(z * (1.0f / 256.0f));
-		return { xx, yy, zz };
+		for (int level = 0; level < GridLevels; level++)
+		{
+			if (extent <= GetCellSize(level) * 0.5f)
+				return level;
+		}
+		return -1;
 	}
 
-	static ivec3 GetEndExtents(const vec3& location, const vec3& extents)
+	static uint32_t GetBucketId(int level, int x, int y, int z)
 	{
-		int xx = (int)std::floor((location.x + extents.x) * (1.0f / 256.0f)) + 1;
-		int yy = (int)std::floor((location.y + extents.y) * (1.0f / 256.0f)) + 1;
-		int zz = (int)std::floor((location.z + extents.z) * (1.0f / 256.0f)) + 1;
-		return { xx, yy, zz };
+		return (level << 27) | ((x & 0x1ff) << 18) | ((y & 0x1ff) << 9) | (z & 0x1ff);
 	}
 
-	static ivec3 GetRayEndExtents(const vec3& from, const vec3& to)
-	{
-		float x = std::max(from.x, to.x);
-		float y = std::max(from.y, to.y);
-		float z = std::max(from.z, to.z);
-		int xx = (int)std::floor(x * (1.0f / 256.0f)) + 1;
-		int yy = (int)std::floor(y * (1.0f / 256.0f)) + 1;
-		int zz = (int)std::floor(z * (1.0f / 256.0f)) + 1;
-		return { xx, yy, zz };
-	}
+	// Calls the callback for every actor whose cell may overlap the box. Returns false if the callback returned false to stop early.
+	template<typename Callback>
+	bool ForEachActor(const vec3& mins, const vec3& maxs, Callback&& callback) const;
 
-	static ivec3 GetSweepEndExtents(const vec3& from, const vec3& to, const vec3& extents)
-	{
-		float x = std::max(from.x, to.x) + extents.x;
-		float y = std::max(from.y, to.y) + extents.y;
-		float z = std::max(from.z, to.z) + extents.z;
-		int xx = (int)std::floor(x * (1.0f / 256.0f)) + 1;
-		int yy = (int)std::floor(y * (1.0f / 256.0f)) + 1;
-		int zz = (int)std::floor(z * (1.0f / 256.0f)) + 1;
-		return { xx, yy, zz };
-	}
+	// Calls the callback for every actor whose cell may overlap a box of the given extents moving from start to end.
+	// Only the cells along the sweep are visited, in the order they are reached, so long traces stay cheap.
+	template<typename Callback>
+	bool ForEachActorInSweep(const vec3& start, const vec3& end, const vec3& extents, Callback&& callback) const;
 
-	static uint32_t GetBucketId(int x, int y, int z)
-	{
-		return ((x & 0x3ff) << 20) | ((y & 0x3ff) << 10) | (z & 0x3ff);
-	}
+	size_t GetCellCount() const { return UsedCells; }
 
 	// Ray/actor hit trace
 	static double RayActorTrace(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, UActor* actor);
@@ -115,4 +105,169 @@ public:
 
 	// Cylinder/cylinder overlap test
 	static bool CylinderCylinderOverlap(const dvec3& cylinderCenterA, double cylinderHeightA, double cylinderRadiusA, const dvec3& cylinderCenterB, double cylinderHeightB, double cylinderRadiusB);
+
+private:
+	size_t GetSlot(uint32_t bucketId) const
+	{
+		// Fibonacci hashing spreads the packed x/y/z bits over the whole table
+		return (size_t)((bucketId * 0x9e3779b1u) >> SlotShift) & SlotMask;
+	}
+
+	const Cell* FindCell(uint32_t bucketId, size_t slot) const
+	{
+		while (true)
+		{
+			const Cell& cell = Cells[slot];
+			if (cell.Count == 0)
+				return nullptr;
+			if (cell.BucketId == bucketId)
+				return &cell;
+			slot = (slot + 1) & SlotMask;
+		}
+	}
+
+	static void GetActorBucket(UActor* actor, int& level, uint32_t& bucketId);
+	void AddToBucket(uint32_t bucketId, UActor* actor);
+	void RemoveFromBucket(uint32_t bucketId, UActor* actor);
+	void RemoveCell(size_t slot);
+	void Resize(size_t slotCount);
+
+	Array<Cell> Cells;
+	size_t SlotMask = 0;
+	int SlotShift = 0;
+	size_t UsedCells = 0;
+
+	int LevelActorCount[GridLevels] = {};
+	Array<UActor*> HugeActors;
 };
+
+template<typename Callback>
+bool CollisionHash::ForEachActor(const vec3& mins, const vec3& maxs, Callback&& callback) const
+{
+	for (UActor* actor : HugeActors)
+	{
+		if (!callback(actor))
+			return false;
+	}
+
+	for (int level = 0; level < GridLevels; level++)
+	{
+		if (LevelActorCount[level] == 0)
+			continue;
+
+		float cellSize = GetCellSize(level);
+		float margin = cellSize * 0.5f;
+		float scale = 1.0f / cellSize;
+		int x0 = (int)std::floor((mins.x - margin) * scale);
+		int y0 = (int)std::floor((mins.y - margin) * scale);
+		int z0 = (int)std::floor((mins.z - margin) * scale);
+		int x1 = (int)std::floor((maxs.x + margin) * scale) + 1;
+		int y1 = (int)std::floor((maxs.y + margin) * scale) + 1;
+		int z1 = (int)std::floor((maxs.z + margin) * scale) + 1;
+		if (x1 - x0 >= 100 || y1 - y0 >= 100 || z1 - z0 >= 100)
+			continue;
+
+		for (int z = z0; z < z1; z++)
+		{
+			for (int y = y0; y < y1; y++)
+			{
+				for (int x = x0; x < x1; x++)
+				{
+					for (const Cell* cell = FirstCell(GetBucketId(level, x, y, z)); cell; cell = NextCell(cell))
+					{
+						for (UActor* actor : *cell)
+						{
+							if (!callback(actor))
+								return false;
+						}
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+template<typename Callback>
+bool CollisionHash::ForEachActorInSweep(const vec3& start, const vec3& end, const vec3& extents, Callback&& callback) const
+{
+	for (UActor* actor : HugeActors)
+	{
+		if (!callback(actor))
+			return false;
+	}
+
+	// Walk the cells slice by slice along the axis the sweep moves the most on
+	vec3 delta = end - start;
+	int a = 0;
+	if (std::abs(delta.y) > std::abs(delta[a])) a = 1;
+	if (std::abs(delta.z) > std::abs(delta[a])) a = 2;
+	int b = (a + 1) % 3;
+	int c = (a + 2) % 3;
+
+	for (int level = 0; level < GridLevels; level++)
+	{
+		if (LevelActorCount[level] == 0)
+			continue;
+
+		float cellSize = GetCellSize(level);
+		float scale = 1.0f / cellSize;
+		vec3 r = extents + cellSize * 0.5f;
+
+		int first = (int)std::floor((std::min(start[a], end[a]) - r[a]) * scale);
+		int last = (int)std::floor((std::max(start[a], end[a]) + r[a]) * scale);
+		int step = 1;
+		if (delta[a] < 0.0f)
+		{
+			std::swap(first, last);
+			step = -1;
+		}
+
+		for (int i = first; i != last + step; i += step)
+		{
+			// Part of the sweep that can reach actors in this slice
+			float t0 = 0.0f;
+			float t1 = 1.0f;
+			if (delta[a] != 0.0f)
+			{
+				t0 = (i * cellSize - r[a] - start[a]) / delta[a];
+				t1 = ((i + 1) * cellSize + r[a] - start[a]) / delta[a];
+				if (t0 > t1)
+					std::swap(t0, t1);
+				t0 = std::max(t0, 0.0f);
+				t1 = std::min(t1, 1.0f);
+				if (t0 > t1)
+					continue;
+			}
+
+			float b0 = start[b] + delta[b] * t0;
+			float b1 = start[b] + delta[b] * t1;
+			float c0 = start[c] + delta[c] * t0;
+			float c1 = start[c] + delta[c] * t1;
+			int bmin = (int)std::floor((std::min(b0, b1) - r[b]) * scale);
+			int bmax = (int)std::floor((std::max(b0, b1) + r[b]) * scale);
+			int cmin = (int)std::floor((std::min(c0, c1) - r[c]) * scale);
+			int cmax = (int)std::floor((std::max(c0, c1) + r[c]) * scale);
+
+			int cellPos[3];
+			cellPos[a] = i;
+			for (int j = cmin; j <= cmax; j++)
+			{
+				cellPos[c] = j;
+				for (int k = bmin; k <= bmax; k++)
+				{
+					cellPos[b] = k;
+					for (const Cell* cell = FirstCell(GetBucketId(level, cellPos[0], cellPos[1], cellPos[2])); cell; cell = NextCell(cell))
+					{
+						for (UActor* actor : *cell)
+						{
+							if (!callback(actor))
+								return false;
+						}
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
@@ -20,32 +20,14 @@ CollisionHitList OverlapCylinderLevel::TestOverlap(ULevel* level, const vec3& lo
 		double dheight = height;
 		dvec3 dlocation = to_dvec3(location);
 
-		ivec3 start = Level->Hash.GetStartExtents(location, extents);
-		ivec3 end = Level->Hash.GetEndExtents(location, extents);
-		if (end.x - start.x < 100 && end.y - start.y < 100 && end.z - start.z < 100)
-		{
-			for (int z = start.z; z < end.z; z++)
+		Level->Hash.ForEachActor(location - extents, location + extents, [&](UActor* actor) {
+			if (Level->Hash.CylinderActorOverlap(dlocation, dheight, dradius, actor))
 			{
-				for (int y = start.y; y < end.y; y++)
-				{
-					for (int x = start.x; x < end.x; x++)
-					{
-						auto it = Level->Hash.CollisionActors.find(Level->Hash.GetBucketId(x, y, z));
-						if (it != Level->Hash.CollisionActors.end())
-						{
-							for (UActor* actor : it->second)
-							{
-								if (Level->Hash.CylinderActorOverlap(dlocation, dheight, dradius, actor))
-								{
-									vec3 normal(0.0f); // To do: do we need the normal for contact tests?
-									hits.push_back({ 0.0f, normal, actor, nullptr });
-								}
-							}
-						}
-					}
-				}
+				vec3 normal(0.0f); // To do: do we need the normal for contact tests?
+				hits.push_back({ 0.0f, normal, actor, nullptr });
 			}
-		}
+			return true;
+		});
 	}
 
 	if (testWorld)
@@ -31,81 +31,57 @@ CollisionHitList TraceCylinderLevel::Trace(ULevel* level, const vec3& from, cons
 		double dradius = radius;
 		double dheight = height;
 		vec3 extents = { radius, radius, height };
-
-		ivec3 start = Level->Hash.GetSweepStartExtents(from, to, extents);
-		ivec3 end = Level->Hash.GetSweepEndExtents(from, to, extents);
-		if (end.x - start.x < 100 && end.y - start.y < 100 && end.z - start.z < 100)
-		{
-			for (int z = start.z; z < end.z; z++)
+		Level->Hash.ForEachActorInSweep(from, to, extents, [&](UActor* actor) {
+			double t = actor->TraceTest(level, origin, tmin, direction, tmax, dheight, dradius);
+			if (t < tmax)
 			{
-				for (int y = start.y; y < end.y; y++)
-				{
-					for (int x = start.x; x < end.x; x++)
-					{
-						auto it = Level->Hash.CollisionActors.find(Level->Hash.GetBucketId(x, y, z));
-						if (it != Level->Hash.CollisionActors.end())
-						{
-							for (UActor* actor : it->second)
-							{
-								double t = actor->TraceTest(level, origin, tmin, direction, tmax, dheight, dradius);
-								if (t < tmax)
-								{
-									dvec3 hitpos = origin + direction * t;
-									hits.push_back({ (float)t, normalize(to_vec3(hitpos) - actor->Location()), actor, nullptr });
-								}
-							}
-						}
-					}
-				}
+				dvec3 hitpos = origin + direction * t;
+				hits.push_back({ (float)t, normalize(to_vec3(hitpos) - actor->Location()), actor, nullptr });
 			}
-		}
+			return true;
+		});
 	}
 
 	if (traceWorld)
 	{
+		// Only the closest world hit can ever be used, as nothing passes through the world
+		CollisionHit worldHit;
 		if (radius == 0.0 && height == 0.0)
 		{
 			// Line/triangle intersect
 			TraceRayModel tracemodel;
-			CollisionHitList worldHits = tracemodel.Trace(Level->Model, origin, tmin, direction, tmax, visibilityOnly);
-			hits.push_back(worldHits);
+			if (tracemodel.TraceFirstHit(Level->Model, origin, tmin, direction, tmax, visibilityOnly, worldHit))
+				hits.push_back(worldHit);
 		}
 		else
 		{
 			// AABB/Triangle intersect
 			TraceAABBModel tracemodel;
 			dvec3 extents = { (double)radius, (double)radius, (double)height };
-			CollisionHitList worldHits = tracemodel.Trace(Level->Model, origin, tmin, direction, tmax, extents, visibilityOnly);
-			hits.push_back(worldHits);
+			if (tracemodel.TraceFirstHit(Level->Model, origin, tmin, direction, tmax, extents, visibilityOnly, worldHit))
+				hits.push_back(worldHit);
 		}
 	}
 
-	// Sort by closest hit and only include the first hit for each actor
-
-	std::stable_sort(hits.begin(), hits.end(), [](const auto& a, const auto& b) { return a.Fraction < b.Fraction; });
-	std::set<UActor*> seenActors;
-	CollisionHitList uniqueHits;
-	for (auto& hit : hits)
+	// Sort by closest hit. Insertion sort keeps equal hits in order without allocating, and the lists are short.
+	// Every actor is only in one collision hash cell, so there are no duplicate actor hits to remove.
+	for (auto it = hits.begin(); it != hits.end(); ++it)
 	{
-		if (hit.Actor)
+		CollisionHit hit = *it;
+		auto pos = it;
+		while (pos != hits.begin() && (pos - 1)->Fraction > hit.Fraction)
 		{
-			if (seenActors.find(hit.Actor) == seenActors.end())
-			{
-				seenActors.insert(hit.Actor);
-				uniqueHits.push_back(hit);
-			}
-		}
-		else
-		{
-			uniqueHits.push_back(hit);
+			*pos = *(pos - 1);
+			--pos;
 		}
+		*pos = hit;
 	}
 
 	tmax -= margin;
-	for (auto& hit : uniqueHits)
+	for (auto& hit : hits)
 	{
 		hit.Fraction = (float)(std::max(hit.Fraction - margin, 0.0f) / tmax);
 	}
 
-	return uniqueHits;
+	return hits;
 }
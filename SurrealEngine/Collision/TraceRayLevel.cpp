@@ -6,54 +6,151 @@
 
 bool TraceRayLevel::TraceAnyHit(ULevel* level, vec3 from, vec3 to, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly)
 {
-	if (from == to || (!traceActors && !traceWorld))
+	if (!traceActors && !traceWorld)
 		return false;
 
 	Level = level;
 
-	dvec3 origin = to_dvec3(from);
-	dvec3 direction = to_dvec3(to) - origin;
-	double tmin = 0.01f;
-	double tmax = length(direction);
+	dvec3 origin, direction;
+	double tmin, tmax;
+	if (!SetupRay(from, to, origin, tmin, direction, tmax))
+		return false;
+
+	if (traceActors)
+	{
+		bool hit = false;
+		Level->Hash.ForEachActorInSweep(from, to, vec3(0.0f), [&](UActor* actor) {
+			if (actor != tracingActor && actor->bBlockActors() && Level->Hash.RayActorTrace(origin, tmin, direction, tmax, actor) < tmax)
+				hit = true;
+			return !hit;
+		});
+		if (hit)
+			return true;
+	}
+
+	if (traceWorld)
+	{
+		TraceRayModel tracemodel;
+		return tracemodel.TraceAnyHit(Level->Model, origin, tmin, direction, tmax, visibilityOnly);
+	}
+
+	return false;
+}
+
+void TraceRayLevel::TraceAnyHit(ULevel* level, const TraceLine* lines, size_t count, uint8_t* hits, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly)
+{
+	if (!traceActors && !traceWorld)
+	{
+		std::fill(hits, hits + count, 0);
+		return;
+	}
+
+	Level = level;
+
+	TraceRayModel tracemodel;
+	for (size_t start = 0; start < count; start += TraceRayModel::RayPacket::Size)
+	{
+		int lanes = (int)std::min(count - start, (size_t)TraceRayModel::RayPacket::Size);
+
+		// Lines that cannot hit anything stay out of the mask
+		TraceRayModel::RayPacket packet = {};
+		int mask = 0;
+		for (int i = 0; i < lanes; i++)
+		{
+			dvec3 origin, direction;
+			double tmin, tmax;
+			if (SetupRay(lines[start + i].From, lines[start + i].To, origin, tmin, direction, tmax))
+			{
+				packet.Set(i, origin, tmin, direction, tmax);
+				mask |= 1 << i;
+			}
+		}
+
+		int hitMask = 0;
+		if (traceActors && mask != 0)
+			hitMask |= TraceActors(packet, mask, tracingActor);
+		if (traceWorld && (mask & ~hitMask) != 0)
+			hitMask |= tracemodel.TraceAnyHit(Level->Model, packet, mask & ~hitMask, visibilityOnly);
+
+		for (int i = 0; i < lanes; i++)
+			hits[start + i] = (hitMask >> i) & 1;
+	}
+}
+
+// Returns false for a line too short to hit anything. The ray runs a little past the end of the line.
+bool TraceRayLevel::SetupRay(const vec3& from, const vec3& to, dvec3& origin, double& tmin, dvec3& direction, double& tmax)
+{
+	if (from == to)
+		return false;
+
+	origin = to_dvec3(from);
+	direction = to_dvec3(to) - origin;
+	tmin = 0.01f;
+	tmax = length(direction);
 	if (tmax < tmin)
 		return false;
 	direction *= 1.0f / tmax;
 
 	float margin = 1.0f;
 	tmax += margin;
+	return true;
+}
 
-	if (traceActors)
+// Returns the mask of the lanes blocked by an actor. Each actor found in the grid has its cylinder tested against all the lanes still open.
+int TraceRayLevel::TraceActors(const TraceRayModel::RayPacket& packet, int mask, UActor* tracingActor)
+{
+	using RayPacket = TraceRayModel::RayPacket;
+
+	int hitMask = 0;
+	auto traceActor = [&](UActor* actor) {
+		if (actor == tracingActor || !actor->bBlockActors())
+			return true;
+		for (int i = 0; i < RayPacket::Size; i++)
+		{
+			int bit = 1 << i;
+			if ((mask & ~hitMask & bit) == 0)
+				continue;
+			dvec3 origin(packet.OriginX[i], packet.OriginY[i], packet.OriginZ[i]);
+			dvec3 dirNormalized(packet.DirX[i], packet.DirY[i], packet.DirZ[i]);
+			if (CollisionHash::RayActorTrace(origin, packet.TMin[i], dirNormalized, packet.TMax[i], actor) < packet.TMax[i])
+				hitMask |= bit;
+		}
+		return (mask & ~hitMask) != 0;
+	};
+
+	// Rays gathered from one point span a small box. Walking the cells of that box once beats one sweep per ray.
+	vec3 mins(FLT_MAX), maxs(-FLT_MAX);
+	float sweepCells = 0.0f;
+	for (int i = 0; i < RayPacket::Size; i++)
 	{
-		ivec3 start = Level->Hash.GetRayStartExtents(from, to);
-		ivec3 end = Level->Hash.GetRayEndExtents(from, to);
-		if (end.x - start.x < 100 && end.y - start.y < 100 && end.z - start.z < 100)
+		if ((mask & (1 << i)) == 0)
+			continue;
+		vec3 from((float)packet.OriginX[i], (float)packet.OriginY[i], (float)packet.OriginZ[i]);
+		vec3 to((float)packet.EndX[i], (float)packet.EndY[i], (float)packet.EndZ[i]);
+		for (int j = 0; j < 3; j++)
 		{
-			for (int z = start.z; z < end.z; z++)
-			{
-				for (int y = start.y; y < end.y; y++)
-				{
-					for (int x = start.x; x < end.x; x++)
-					{
-						auto it = Level->Hash.CollisionActors.find(Level->Hash.GetBucketId(x, y, z));
-						if (it != Level->Hash.CollisionActors.end())
-						{
-							for (UActor* actor : it->second)
-							{
-								if (actor != tracingActor && actor->bBlockActors() && Level->Hash.RayActorTrace(origin, tmin, direction, tmax, actor) < tmax)
-									return true;
-							}
-						}
-					}
-				}
-			}
+			mins[j] = std::min(mins[j], std::min(from[j], to[j]));
+			maxs[j] = std::max(maxs[j], std::max(from[j], to[j]));
 		}
+		sweepCells += (length(to - from) / CollisionHash::GetCellSize(0) + 2.0f) * 9.0f;
 	}
 
-	if (traceWorld)
+	// ForEachActor skips grid levels where the box spans 100 cells or more, so only small boxes may take that path
+	vec3 boxCells = (maxs - mins) / CollisionHash::GetCellSize(0) + 2.0f;
+	if (boxCells.x < 96.0f && boxCells.y < 96.0f && boxCells.z < 96.0f && boxCells.x * boxCells.y * boxCells.z <= sweepCells)
 	{
-		TraceRayModel tracemodel;
-		return tracemodel.TraceAnyHit(Level->Model, origin, tmin, direction, tmax, visibilityOnly);
+		Level->Hash.ForEachActor(mins, maxs, traceActor);
 	}
-
-	return false;
+	else
+	{
+		for (int i = 0; i < RayPacket::Size && (mask & ~hitMask) != 0; i++)
+		{
+			if ((mask & ~hitMask & (1 << i)) == 0)
+				continue;
+			vec3 from((float)packet.OriginX[i], (float)packet.OriginY[i], (float)packet.OriginZ[i]);
+			vec3 to((float)packet.EndX[i], (float)packet.EndY[i], (float)packet.EndZ[i]);
+			Level->Hash.ForEachActorInSweep(from, to, vec3(0.0f), traceActor);
+		}
+	}
+	return hitMask;
 }
@@ -1,12 +1,17 @@
 #pragma once
 
 #include "UObject/ULevel.h"
+#include "TraceRayModel.h"
 
 class TraceRayLevel
 {
 public:
 	bool TraceAnyHit(ULevel* level, vec3 from, vec3 to, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly);
+	void TraceAnyHit(ULevel* level, const TraceLine* lines, size_t count, uint8_t* hits, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly);
 
 private:
+	static bool SetupRay(const vec3& from, const vec3& to, dvec3& origin, double& tmin, dvec3& direction, double& tmax);
+	int TraceActors(const TraceRayModel::RayPacket& packet, int mask, UActor* tracingActor);
+
 	ULevel* Level = nullptr;
 };
@@ -1,14 +1,17 @@
 
 #include "Precomp.h"
 #include "TraceRayModel.h"
+#ifndef NO_SSE
+#include <emmintrin.h>
+#endif
 
-CollisionHitList TraceRayModel::Trace(UModel* model, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly)
+bool TraceRayModel::TraceFirstHit(UModel* model, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, CollisionHit& hit)
 {
 	Model = model;
-	CollisionHitList hits;
-	Trace(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes.front(), hits);
-	std::stable_sort(hits.begin(), hits.end(), [](const auto& a, const auto& b) { return a.Fraction < b.Fraction; });
-	return hits;
+	hit = {};
+	hit.Fraction = (float)tmax;
+	TraceFirstHit(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes.front(), hit);
+	return hit.Node != nullptr;
 }
 
 bool TraceRayModel::TraceAnyHit(UModel* model, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly)
@@ -17,20 +20,20 @@ bool TraceRayModel::TraceAnyHit(UModel* model, const dvec3& origin, double tmin,
 	return TraceAnyHit(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes.front());
 }
 
-void TraceRayModel::Trace(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, BspNode* node, CollisionHitList& hits)
+void TraceRayModel::TraceFirstHit(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, BspNode* node, CollisionHit& hit)
 {
 	BspNode* polynode = node;
 	while (true)
 	{
 		if (!visibilityOnly || (polynode->NodeFlags & NF_NotVisBlocking) == 0)
 		{
-			double t = NodeRayIntersect(origin, tmin, dirNormalized, tmax, polynode);
-			if (t >= tmin && t < tmax)
+			double limit = std::min(tmax, (double)hit.Fraction);
+			double t = NodeRayIntersect(origin, tmin, dirNormalized, limit, polynode);
+			if (t >= tmin && t < limit)
 			{
-				CollisionHit hit = { (float)t, vec3(node->PlaneX, node->PlaneY, node->PlaneZ), nullptr, polynode };
+				hit = { (float)t, vec3(node->PlaneX, node->PlaneY, node->PlaneZ), nullptr, polynode };
 				if (dot(to_dvec3(hit.Normal), dirNormalized) > 0.0)
 					hit.Normal = -hit.Normal;
-				hits.push_back(hit);
 			}
 		}
 
@@ -38,14 +41,21 @@ void TraceRayModel::Trace(const dvec3& origin, double tmin, const dvec3& dirNorm
 		polynode = &Model->Nodes[polynode->Plane];
 	}
 
+	// Visit the side the ray starts on first. The far side only needs to be visited if the ray still reaches it before the closest hit.
 	dvec4 plane = { node->PlaneX, node->PlaneY, node->PlaneZ, -node->PlaneW };
 	double fromSide = dot(dvec4(origin, 1.0), plane);
-	double toSide = dot(dvec4(origin + dirNormalized * tmax, 1.0), plane);
+	int nearChild = fromSide >= 0.0 ? node->Front : node->Back;
+	int farChild = fromSide >= 0.0 ? node->Back : node->Front;
 
-	if (node->Front >= 0 && (fromSide >= 0.0 || toSide >= 0.0))
-		Trace(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes[node->Front], hits);
-	if (node->Back >= 0 && (fromSide <= 0.0 || toSide <= 0.0))
-		Trace(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes[node->Back], hits);
+	if (nearChild >= 0)
+		TraceFirstHit(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes[nearChild], hit);
+
+	if (farChild >= 0)
+	{
+		double toSide = dot(dvec4(origin + dirNormalized * std::min(tmax, (double)hit.Fraction), 1.0), plane);
+		if (fromSide == 0.0 || (fromSide > 0.0 ? toSide <= 0.0 : toSide >= 0.0))
+			TraceFirstHit(origin, tmin, dirNormalized, tmax, visibilityOnly, &Model->Nodes[farChild], hit);
+	}
 }
 
 bool TraceRayModel::TraceAnyHit(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, BspNode* node)
@@ -76,6 +86,254 @@ bool TraceRayModel::TraceAnyHit(const dvec3& origin, double tmin, const dvec3& d
 		return false;
 }
 
+void TraceRayModel::RayPacket::Set(int lane, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax)
+{
+	dvec3 end = origin + dirNormalized * tmax;
+	OriginX[lane] = origin.x;
+	OriginY[lane] = origin.y;
+	OriginZ[lane] = origin.z;
+	DirX[lane] = dirNormalized.x;
+	DirY[lane] = dirNormalized.y;
+	DirZ[lane] = dirNormalized.z;
+	EndX[lane] = end.x;
+	EndY[lane] = end.y;
+	EndZ[lane] = end.z;
+	TMin[lane] = tmin;
+	TMax[lane] = tmax;
+}
+
+int TraceRayModel::TraceAnyHit(UModel* model, const RayPacket& packet, int mask, bool visibilityOnly)
+{
+	Model = model;
+	if (mask == 0)
+		return 0;
+	return TraceAnyHit(packet, mask, visibilityOnly, &Model->Nodes.front());
+}
+
+// Returns the mask of the rays that hit something
+int TraceRayModel::TraceAnyHit(const RayPacket& packet, int mask, bool visibilityOnly, BspNode* node)
+{
+	// Once the lanes have split up there is nothing left to share
+	if ((mask & (mask - 1)) == 0)
+	{
+		int i = 0;
+		while ((mask & (1 << i)) == 0) i++;
+		dvec3 origin(packet.OriginX[i], packet.OriginY[i], packet.OriginZ[i]);
+		dvec3 dirNormalized(packet.DirX[i], packet.DirY[i], packet.DirZ[i]);
+		return TraceAnyHit(origin, packet.TMin[i], dirNormalized, packet.TMax[i], visibilityOnly, node) ? mask : 0;
+	}
+
+	int frontMask, backMask, crossMask;
+	PlaneSides(packet, node, frontMask, backMask, crossMask);
+
+	int hitMask = 0;
+	BspNode* polynode = node;
+	while (true)
+	{
+		if (!visibilityOnly || (polynode->NodeFlags & NF_NotVisBlocking) == 0)
+		{
+			int polyCrossMask = crossMask;
+			if (polynode != node)
+			{
+				int polyFrontMask, polyBackMask;
+				PlaneSides(packet, polynode, polyFrontMask, polyBackMask, polyCrossMask);
+			}
+
+			hitMask |= NodeRayIntersect(packet, mask & ~hitMask & polyCrossMask, polynode);
+			if ((mask & ~hitMask) == 0)
+				return hitMask;
+		}
+
+		if (polynode->Plane < 0) break;
+		polynode = &Model->Nodes[polynode->Plane];
+	}
+	mask &= ~hitMask;
+
+	frontMask &= mask;
+	backMask &= mask;
+
+	if (node->Front >= 0 && frontMask != 0)
+	{
+		hitMask |= TraceAnyHit(packet, frontMask, visibilityOnly, &Model->Nodes[node->Front]);
+		backMask &= ~hitMask;
+	}
+
+	if (node->Back >= 0 && backMask != 0)
+	{
+		hitMask |= TraceAnyHit(packet, backMask, visibilityOnly, &Model->Nodes[node->Back]);
+	}
+
+	return hitMask;
+}
+
+// Which lanes start or end on the front side, start or end on the back side, and cross or touch the plane.
+// The sums are done in the same order as the single ray dot products, so both give identical results.
+void TraceRayModel::PlaneSides(const RayPacket& packet, BspNode* node, int& frontMask, int& backMask, int& crossMask)
+{
+#ifdef NO_SSE
+	double planeX = node->PlaneX;
+	double planeY = node->PlaneY;
+	double planeZ = node->PlaneZ;
+	double planeW = -node->PlaneW;
+	frontMask = 0;
+	backMask = 0;
+	crossMask = 0;
+	for (int i = 0; i < RayPacket::Size; i++)
+	{
+		double fromSide = packet.OriginX[i] * planeX + packet.OriginY[i] * planeY + packet.OriginZ[i] * planeZ + planeW;
+		double toSide = packet.EndX[i] * planeX + packet.EndY[i] * planeY + packet.EndZ[i] * planeZ + planeW;
+		frontMask |= (int)(fromSide >= 0.0 || toSide >= 0.0) << i;
+		backMask |= (int)(fromSide <= 0.0 || toSide <= 0.0) << i;
+		crossMask |= (int)!((fromSide > 0.0 && toSide > 0.0) || (fromSide < 0.0 && toSide < 0.0)) << i;
+	}
+#else
+	__m128d planeX = _mm_set1_pd(node->PlaneX);
+	__m128d planeY = _mm_set1_pd(node->PlaneY);
+	__m128d planeZ = _mm_set1_pd(node->PlaneZ);
+	__m128d planeW = _mm_set1_pd(-node->PlaneW);
+	__m128d zero = _mm_setzero_pd();
+	frontMask = 0;
+	backMask = 0;
+	crossMask = 0;
+	for (int i = 0; i < RayPacket::Size; i += 2)
+	{
+		__m128d fromSide = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_load_pd(packet.OriginX + i), planeX), _mm_mul_pd(_mm_load_pd(packet.OriginY + i), planeY)), _mm_mul_pd(_mm_load_pd(packet.OriginZ + i), planeZ)), planeW);
+		__m128d toSide = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_load_pd(packet.EndX + i), planeX), _mm_mul_pd(_mm_load_pd(packet.EndY + i), planeY)), _mm_mul_pd(_mm_load_pd(packet.EndZ + i), planeZ)), planeW);
+		__m128d front = _mm_or_pd(_mm_cmpge_pd(fromSide, zero), _mm_cmpge_pd(toSide, zero));
+		__m128d back = _mm_or_pd(_mm_cmple_pd(fromSide, zero), _mm_cmple_pd(toSide, zero));
+		__m128d bothFront = _mm_and_pd(_mm_cmpgt_pd(fromSide, zero), _mm_cmpgt_pd(toSide, zero));
+		__m128d bothBack = _mm_and_pd(_mm_cmplt_pd(fromSide, zero), _mm_cmplt_pd(toSide, zero));
+		frontMask |= _mm_movemask_pd(front) << i;
+		backMask |= _mm_movemask_pd(back) << i;
+		crossMask |= (~_mm_movemask_pd(_mm_or_pd(bothFront, bothBack)) & 3) << i;
+	}
+#endif
+}
+
+// Same tests as the single ray NodeRayIntersect and TriangleRayIntersect, for all lanes at once.
+// The mask must only hold lanes that cross the plane of the node.
+int TraceRayModel::NodeRayIntersect(const RayPacket& packet, int mask, BspNode* node)
+{
+	if (mask == 0 || node->NumVertices < 3 || (node->Surf >= 0 && Model->Surfaces[node->Surf].PolyFlags & PF_NotSolid))
+		return 0;
+
+	BspVert* v = &Model->Vertices[node->VertPool];
+	vec3* points = Model->Points.data();
+
+	dvec3 p0 = to_dvec3(points[v[0].Vertex]);
+	dvec3 p1 = to_dvec3(points[v[1].Vertex]);
+
+	int hitMask = 0;
+	int count = node->NumVertices;
+
+#ifdef NO_SSE
+	// T = origin - p0 is the same for every triangle of the fan
+	double tx[RayPacket::Size], ty[RayPacket::Size], tz[RayPacket::Size];
+	for (int i = 0; i < RayPacket::Size; i++)
+	{
+		tx[i] = packet.OriginX[i] - p0.x;
+		ty[i] = packet.OriginY[i] - p0.y;
+		tz[i] = packet.OriginZ[i] - p0.z;
+	}
+
+	for (int k = 2; k < count; k++)
+	{
+		dvec3 p2 = to_dvec3(points[v[k].Vertex]);
+		dvec3 e1 = p1 - p0;
+		dvec3 e2 = p2 - p0;
+
+		for (int i = 0; i < RayPacket::Size; i++)
+		{
+			if ((mask & (1 << i)) == 0)
+				continue;
+
+			// P = cross(dir, e2)
+			double px = packet.DirY[i] * e2.z - e2.y * packet.DirZ[i];
+			double py = packet.DirZ[i] * e2.x - e2.z * packet.DirX[i];
+			double pz = packet.DirX[i] * e2.y - e2.x * packet.DirY[i];
+			double det = e1.x * px + e1.y * py + e1.z * pz;
+			double inv_det = 1.0 / det;
+
+			double u = (tx[i] * px + ty[i] * py + tz[i] * pz) * inv_det;
+
+			// Q = cross(T, e1)
+			double qx = ty[i] * e1.z - e1.y * tz[i];
+			double qy = tz[i] * e1.x - e1.z * tx[i];
+			double qz = tx[i] * e1.y - e1.x * ty[i];
+			double w = (packet.DirX[i] * qx + packet.DirY[i] * qy + packet.DirZ[i] * qz) * inv_det;
+
+			double t = (e2.x * qx + e2.y * qy + e2.z * qz) * inv_det;
+
+			bool hit = (det <= -FLT_EPSILON || det >= FLT_EPSILON) && u >= 0.0 && u <= 1.0 && w >= 0.0 && u + w <= 1.0 && t > FLT_EPSILON && t >= packet.TMin[i] && t < packet.TMax[i];
+			hitMask |= (int)hit << i;
+		}
+
+		p1 = p2;
+	}
+#else
+	__m128d one = _mm_set1_pd(1.0);
+	__m128d zero = _mm_setzero_pd();
+	__m128d eps = _mm_set1_pd(FLT_EPSILON);
+	__m128d negEps = _mm_set1_pd(-FLT_EPSILON);
+
+	// T = origin - p0 is the same for every triangle of the fan
+	__m128d tx[2], ty[2], tz[2];
+	for (int h = 0; h < 2; h++)
+	{
+		tx[h] = _mm_sub_pd(_mm_load_pd(packet.OriginX + h * 2), _mm_set1_pd(p0.x));
+		ty[h] = _mm_sub_pd(_mm_load_pd(packet.OriginY + h * 2), _mm_set1_pd(p0.y));
+		tz[h] = _mm_sub_pd(_mm_load_pd(packet.OriginZ + h * 2), _mm_set1_pd(p0.z));
+	}
+
+	for (int k = 2; k < count; k++)
+	{
+		dvec3 p2 = to_dvec3(points[v[k].Vertex]);
+		dvec3 e1 = p1 - p0;
+		dvec3 e2 = p2 - p0;
+		__m128d e1x = _mm_set1_pd(e1.x), e1y = _mm_set1_pd(e1.y), e1z = _mm_set1_pd(e1.z);
+		__m128d e2x = _mm_set1_pd(e2.x), e2y = _mm_set1_pd(e2.y), e2z = _mm_set1_pd(e2.z);
+
+		for (int h = 0; h < 2; h++)
+		{
+			if (((mask >> (h * 2)) & 3) == 0)
+				continue;
+
+			__m128d dx = _mm_load_pd(packet.DirX + h * 2);
+			__m128d dy = _mm_load_pd(packet.DirY + h * 2);
+			__m128d dz = _mm_load_pd(packet.DirZ + h * 2);
+
+			// P = cross(dir, e2)
+			__m128d px = _mm_sub_pd(_mm_mul_pd(dy, e2z), _mm_mul_pd(e2y, dz));
+			__m128d py = _mm_sub_pd(_mm_mul_pd(dz, e2x), _mm_mul_pd(e2z, dx));
+			__m128d pz = _mm_sub_pd(_mm_mul_pd(dx, e2y), _mm_mul_pd(e2x, dy));
+			__m128d det = _mm_add_pd(_mm_add_pd(_mm_mul_pd(e1x, px), _mm_mul_pd(e1y, py)), _mm_mul_pd(e1z, pz));
+			__m128d inv_det = _mm_div_pd(one, det);
+
+			__m128d u = _mm_mul_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(tx[h], px), _mm_mul_pd(ty[h], py)), _mm_mul_pd(tz[h], pz)), inv_det);
+
+			// Q = cross(T, e1)
+			__m128d qx = _mm_sub_pd(_mm_mul_pd(ty[h], e1z), _mm_mul_pd(e1y, tz[h]));
+			__m128d qy = _mm_sub_pd(_mm_mul_pd(tz[h], e1x), _mm_mul_pd(e1z, tx[h]));
+			__m128d qz = _mm_sub_pd(_mm_mul_pd(tx[h], e1y), _mm_mul_pd(e1x, ty[h]));
+			__m128d w = _mm_mul_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(dx, qx), _mm_mul_pd(dy, qy)), _mm_mul_pd(dz, qz)), inv_det);
+
+			__m128d t = _mm_mul_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(e2x, qx), _mm_mul_pd(e2y, qy)), _mm_mul_pd(e2z, qz)), inv_det);
+
+			__m128d hit = _mm_or_pd(_mm_cmple_pd(det, negEps), _mm_cmpge_pd(det, eps));
+			hit = _mm_and_pd(hit, _mm_and_pd(_mm_cmpge_pd(u, zero), _mm_cmple_pd(u, one)));
+			hit = _mm_and_pd(hit, _mm_and_pd(_mm_cmpge_pd(w, zero), _mm_cmple_pd(_mm_add_pd(u, w), one)));
+			hit = _mm_and_pd(hit, _mm_cmpgt_pd(t, eps));
+			hit = _mm_and_pd(hit, _mm_and_pd(_mm_cmpge_pd(t, _mm_load_pd(packet.TMin + h * 2)), _mm_cmplt_pd(t, _mm_load_pd(packet.TMax + h * 2))));
+			hitMask |= _mm_movemask_pd(hit) << (h * 2);
+		}
+
+		p1 = p2;
+	}
+#endif
+
+	return hitMask & mask;
+}
+
 double TraceRayModel::NodeRayIntersect(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, BspNode* node)
 {
 	if (node->NumVertices < 3 || (node->Surf >= 0 && Model->Surfaces[node->Surf].PolyFlags & PF_NotSolid))
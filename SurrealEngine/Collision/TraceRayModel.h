@@ -5,13 +5,35 @@
 class TraceRayModel
 {
 public:
-	CollisionHitList Trace(UModel* model, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly);
+	// Closest hit. Children nearest to the origin are visited first and anything beyond the current hit is skipped.
+	bool TraceFirstHit(UModel* model, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, CollisionHit& hit);
+
+	// Returns as soon as any blocking surface is found
 	bool TraceAnyHit(UModel* model, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly);
 
+	// Rays stored lane by lane, so the per node tests run on all lanes at once
+	struct RayPacket
+	{
+		enum { Size = 4 };
+		alignas(16) double OriginX[Size], OriginY[Size], OriginZ[Size];
+		alignas(16) double DirX[Size], DirY[Size], DirZ[Size];
+		alignas(16) double EndX[Size], EndY[Size], EndZ[Size];
+		alignas(16) double TMin[Size], TMax[Size];
+
+		void Set(int lane, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax);
+	};
+
+	// Any-hit test for a packet of rays walking the BSP together. Only the lanes in mask are traced. Returns the mask of the lanes that hit something.
+	int TraceAnyHit(UModel* model, const RayPacket& packet, int mask, bool visibilityOnly);
+
 private:
-	void Trace(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, BspNode* node, CollisionHitList& hits);
+	void TraceFirstHit(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, BspNode* node, CollisionHit& hit);
 	bool TraceAnyHit(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, BspNode* node);
 
+	int TraceAnyHit(const RayPacket& packet, int mask, bool visibilityOnly, BspNode* node);
+	int NodeRayIntersect(const RayPacket& packet, int mask, BspNode* node);
+	static void PlaneSides(const RayPacket& packet, BspNode* node, int& frontMask, int& backMask, int& crossMask);
+
 	double NodeRayIntersect(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, BspNode* node);
 	double TriangleRayIntersect(const dvec3& origin, const dvec3& dirNormalized, double tmax, const dvec3* points);
 
@@ -7,6 +7,7 @@
 #include "Package/PackageManager.h"
 #include "Package/Package.h"
 #include "Editor/Export.h"
+#include "Editor/ExportQueue.h"
 #include "UObject/UClass.h"
 #include "UObject/UTextBuffer.h"
 
@@ -80,14 +81,23 @@ void ExportCommandlet::OnCommand(DebuggerApp* console, const std::string& args)
 	}
 
 	Array<std::string> packages;
+	incremental = false;
 	if (argsStripped.size() != cmdArgs.size())
 	{
-		size_t sep = cmdArgs.find_first_of(' ');
-		do
+		size_t pos = 0;
+		while (pos < cmdArgs.size())
 		{
-			cmdArgs = cmdArgs.substr(0, sep);
-			packages.push_back(cmdArgs);
-		} while (sep != std::string::npos);
+			size_t sep = cmdArgs.find_first_of(' ', pos);
+			if (sep == std::string::npos)
+				sep = cmdArgs.size();
+
+			std::string arg = cmdArgs.substr(pos, sep - pos);
+			if (arg == "--incremental")
+				incremental = true;
+			else if (!arg.empty())
+				packages.push_back(arg);
+			pos = sep + 1;
+		}
 	}
 
 	switch (cmd)
@@ -158,30 +168,27 @@ void ExportCommandlet::ExportScripts(DebuggerApp* console, Array<std::string>& p
 		Package* package = pkgobject.first;
 		std::string& name = pkgobject.second;
 
-		std::string pkgname = package->GetPackageName().ToString();
 		std::string pkgpath = FilePath::combine(engine->LaunchInfo.gameRootFolder, name);
 		std::string classespath = FilePath::combine(pkgpath, "Classes");
-		bool pkgpathcreated = false;
 
 		console->WriteOutput("Exporting scripts from " + ColorEscape(96) + name + ResetEscape() + NewLine());
 
 		Array<UClass*> classes = package->GetAllObjects<UClass>();
 
+		ExportQueue queue;
+		int skipped = 0;
 		for (UClass* cls : classes)
 		{
-			MemoryStreamWriter stream = Exporter::ExportClass(cls);
-			if (stream.Size() > 0)
+			std::string filename = cls->FriendlyName.ToString() + ".uc";
+			if (IsUpToDate(package, FilePath::combine(classespath, filename)))
 			{
-				if (!pkgpathcreated)
-				{
-					Directory::make_directory(pkgpath);
-					Directory::make_directory(classespath);
-					pkgpathcreated = true;
-				}
-				std::string filename = FilePath::combine(classespath, cls->FriendlyName.ToString() + ".uc");
-				File::write_all_bytes(filename, stream.Data(), stream.Size());
+				skipped++;
+				continue;
 			}
+			const UClass* constCls = cls;
+			queue.Add(classespath, filename, [=]() { return Exporter::ExportClass(constCls); });
 		}
+		FinishExport(console, queue, skipped);
 	}
 }
 
@@ -250,15 +257,15 @@ void ExportCommandlet::ExportTextures(DebuggerApp* console, Array<std::string>&
 		Package* package = pkgobject.first;
 		std::string& name = pkgobject.second;
 
-		std::string pkgname = package->GetPackageName().ToString();
 		std::string pkgpath = FilePath::combine(engine->LaunchInfo.gameRootFolder, name);
 		std::string texturespath = FilePath::combine(pkgpath, "Textures");
-		bool pkgpathcreated = false;
 
 		console->WriteOutput("Exporting textures from " + ColorEscape(96) + name + ResetEscape() + NewLine());
 
 		Array<UTexture*> textures = package->GetAllObjects<UTexture>();
 
+		ExportQueue queue;
+		int skipped = 0;
 		for (UTexture* tex : textures)
 		{
 			// TODO: support more formats than just bmp
@@ -268,20 +275,18 @@ void ExportCommandlet::ExportTextures(DebuggerApp* console, Array<std::string>&
 			else
 				ext.assign(desiredExt);
 
-			MemoryStreamWriter stream = Exporter::ExportTexture(tex, ext);
-			if (stream.Size() > 0)
+			std::string filename = tex->Name.ToString() + "." + ext;
+			if (IsUpToDate(package, FilePath::combine(texturespath, filename)))
 			{
-				if (!pkgpathcreated)
-				{
-					Directory::make_directory(pkgpath);
-					Directory::make_directory(texturespath);
-					pkgpathcreated = true;
-				}
-
-				std::string filename = FilePath::combine(texturespath, tex->Name.ToString() + "." + ext);
-				File::write_all_bytes(filename, stream.Data(), stream.Size());
+				skipped++;
+				continue;
 			}
+			// The workers only get const access, so the mip data must be read here
+			tex->LoadMips();
+			const UTexture* constTex = tex;
+			queue.Add(texturespath, filename, [=]() { return Exporter::ExportTexture(constTex, ext); });
 		}
+		FinishExport(console, queue, skipped);
 	}
 }
 
@@ -317,8 +322,30 @@ void ExportCommandlet::ExportLevel(DebuggerApp* console, Array<std::string>& pac
 
 void ExportCommandlet::OnPrintHelp(DebuggerApp* console)
 {
-	console->WriteOutput("Syntax: export <command> (packages)" + NewLine());
+	console->WriteOutput("Syntax: export <command> (packages) (--incremental)" + NewLine());
 	console->WriteOutput("Commands: all scripts textures sounds music meshes level" + NewLine());
+	console->WriteOutput("--incremental skips files that are newer than their package" + NewLine());
+}
+
+bool ExportCommandlet::IsUpToDate(Package* package, const std::string& filename)
+{
+	if (!incremental)
+		return false;
+
+	FileStats packageStats, fileStats;
+	if (!File::try_get_stats(package->GetPackageFilename(), packageStats) || !File::try_get_stats(filename, fileStats))
+		return false;
+	return fileStats.modified >= packageStats.modified;
+}
+
+void ExportCommandlet::FinishExport(DebuggerApp* console, ExportQueue& queue, int skipped)
+{
+	int written = queue.Finish([=](const std::string& filename, const std::string& error) {
+		console->WriteOutput("Could not export " + filename + ": " + error + NewLine());
+	});
+
+	if (skipped > 0)
+		console->WriteOutput(std::to_string(written) + " files written, " + std::to_string(skipped) + " up to date" + NewLine());
 }
 
 void ExportCommandlet::InitExport(Array<std::string>& packages)
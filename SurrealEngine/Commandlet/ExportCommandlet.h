@@ -2,6 +2,9 @@
 
 #include "Commandlet/Commandlet.h"
 
+class Package;
+class ExportQueue;
+
 class ExportCommandlet : public Commandlet
 {
 public:
@@ -20,6 +23,9 @@ private:
 	void ExportLevel(DebuggerApp* console, Array<std::string>& packages);
 
 	void InitExport(Array<std::string>& packages);
+	bool IsUpToDate(Package* package, const std::string& filename);
+	void FinishExport(DebuggerApp* console, ExportQueue& queue, int skipped);
 
 	Array<std::string> packageNames;
+	bool incremental = false;
 };
@@ -63,11 +63,11 @@ void PrintCommandlet::OnCommand(DebuggerApp* console, const std::string& args)
 			if (prop->Name == (*chunk))
 			{
 				void* ptr = ((uint8_t*)obj) + prop->DataOffset.DataOffset;
-				void* val = obj->PropertyData.Ptr(prop);
+				const void* val = std::as_const(obj->PropertyData).Ptr(prop);
 
 				if (UObject::TryCast<UObjectProperty>(prop) || UObject::TryCast<UClassProperty>(prop))
 				{
-					obj = *(UObject**)val;
+					obj = *(UObject* const*)val;
 					bFoundObj = true;
 					break;
 				}
@@ -106,7 +106,7 @@ void PrintCommandlet::OnCommand(DebuggerApp* console, const std::string& args)
 	std::stable_sort(props.begin(), props.end(), [](UProperty* a, UProperty* b) { return a->Name < b->Name; });
 	for (UProperty* prop : props)
 	{
-		void* ptr = obj->PropertyData.Ptr(prop);
+		const void* ptr = std::as_const(obj->PropertyData).Ptr(prop);
 
 		std::string name = prop->Name.ToString();
 		std::string value = prop->PrintValue(ptr);
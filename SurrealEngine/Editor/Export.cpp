@@ -13,7 +13,7 @@ static void UnpackRgba(uint32_t rgba, uint32_t& r, uint32_t& g, uint32_t& b, uin
 
 /////////////////////////////////////////////////////////////////////////////
 
-std::string Exporter::ExportObject(UObject* obj, int tablevel, bool bInline)
+std::string Exporter::ExportObject(const UObject* obj, int tablevel, bool bInline)
 {
 	std::string txt = "";
 	for (UProperty* prop : obj->Class->Properties)
@@ -23,7 +23,7 @@ std::string Exporter::ExportObject(UObject* obj, int tablevel, bool bInline)
 			if (AnyFlags(prop->Flags, ObjectFlags::TagExp))
 			{
 				// Get default property from super class
-				UObject* defobj = nullptr;
+				const UObject* defobj = nullptr;
 				if (obj->Class == obj->Class->Class)
 					defobj = obj->Class->BaseStruct;
 				else
@@ -49,7 +49,7 @@ std::string Exporter::ExportObject(UObject* obj, int tablevel, bool bInline)
 
 /////////////////////////////////////////////////////////////////////////////
 
-MemoryStreamWriter Exporter::ExportClass(UClass* cls)
+MemoryStreamWriter Exporter::ExportClass(const UClass* cls)
 {
 	MemoryStreamWriter text;
 	if (!cls->ScriptText)
@@ -63,7 +63,7 @@ MemoryStreamWriter Exporter::ExportClass(UClass* cls)
 
 /////////////////////////////////////////////////////////////////////////////
 
-MemoryStreamWriter Exporter::ExportTexture(UTexture* tex, const std::string& ext)
+MemoryStreamWriter Exporter::ExportTexture(const UTexture* tex, const std::string& ext)
 {
 	if (!tex)
 		return MemoryStreamWriter();
@@ -71,19 +71,19 @@ MemoryStreamWriter Exporter::ExportTexture(UTexture* tex, const std::string& ext
 	const std::string& className = tex->Class->Name.ToString();
 	if (className.compare("FireTexture") == 0)
 	{
-		return ExportFireTexture(reinterpret_cast<UFireTexture*>(tex));
+		return ExportFireTexture(static_cast<const UFireTexture*>(tex));
 	}
 	else if (className.compare("WetTexture") == 0)
 	{
-		return ExportWetTexture(reinterpret_cast<UWetTexture*>(tex));
+		return ExportWetTexture(static_cast<const UWetTexture*>(tex));
 	}
 	else if (className.compare("WaveTexture") == 0)
 	{
-		return ExportWaveTexture(reinterpret_cast<UWaveTexture*>(tex));
+		return ExportWaveTexture(static_cast<const UWaveTexture*>(tex));
 	}
 	else if (className.compare("IceTexture") == 0)
 	{
-		return ExportIceTexture(reinterpret_cast<UIceTexture*>(tex));
+		return ExportIceTexture(static_cast<const UIceTexture*>(tex));
 	}
 
 	if (tex->ActualFormat == TextureFormat::P8)
@@ -100,7 +100,7 @@ MemoryStreamWriter Exporter::ExportTexture(UTexture* tex, const std::string& ext
 
 /////////////////////////////////////////////////////////////////////////////
 
-MemoryStreamWriter Exporter::ExportFireTexture(UFireTexture* tex)
+MemoryStreamWriter Exporter::ExportFireTexture(const UFireTexture* tex)
 {
 	MemoryStreamWriter data;
 	data << "BEGIN OBJECT CLASS=FireTexture USIZE=" << std::to_string(tex->USize()) << " VSIZE=" << std::to_string(tex->VSize()) << "\r\n";
@@ -108,7 +108,7 @@ MemoryStreamWriter Exporter::ExportFireTexture(UFireTexture* tex)
 	data << ExportObject(tex, 1, false);
 
 	// 5-color interpolated palette, this is what 227/469 UnrealEd recognizes
-	UPalette* palette = tex->Palette();
+	const UPalette* palette = tex->Palette();
 	for (int i = 0; i < 5; i++)
 	{
 		uint32_t r, g, b, a;
@@ -140,7 +140,7 @@ MemoryStreamWriter Exporter::ExportFireTexture(UFireTexture* tex)
 	return data;
 }
 
-MemoryStreamWriter Exporter::ExportWaveTexture(UWaveTexture* tex)
+MemoryStreamWriter Exporter::ExportWaveTexture(const UWaveTexture* tex)
 {
 	MemoryStreamWriter data;
 	data << "BEGIN OBJECT CLASS=WaveTexture USIZE=" + std::to_string(tex->USize()) + " VSIZE=" + std::to_string(tex->VSize()) + "\r\n";
@@ -148,7 +148,7 @@ MemoryStreamWriter Exporter::ExportWaveTexture(UWaveTexture* tex)
 	data << ExportObject(tex, 1, false);
 
 	// 5-color interpolated palette, this is what 227/469 UnrealEd recognizes
-	UPalette* palette = tex->Palette();
+	const UPalette* palette = tex->Palette();
 	for (int i = 0; i < 5; i++)
 	{
 		uint32_t r, g, b, a;
@@ -180,7 +180,7 @@ MemoryStreamWriter Exporter::ExportWaveTexture(UWaveTexture* tex)
 	return data;
 }
 
-MemoryStreamWriter Exporter::ExportWetTexture(UWetTexture* tex)
+MemoryStreamWriter Exporter::ExportWetTexture(const UWetTexture* tex)
 {
 	MemoryStreamWriter data;
 	data << "BEGIN OBJECT CLASS=WetTexture USIZE=" + std::to_string(tex->USize()) + " VSIZE=" + std::to_string(tex->VSize()) + "\r\n";
@@ -188,7 +188,7 @@ MemoryStreamWriter Exporter::ExportWetTexture(UWetTexture* tex)
 	data << ExportObject(tex, 1, false);
 
 	// 5-color interpolated palette, this is what 227/469 UnrealEd recognizes
-	UPalette* palette = tex->Palette();
+	const UPalette* palette = tex->Palette();
 	for (int i = 0; i < 5; i++)
 	{
 		uint32_t r, g, b, a;
@@ -220,7 +220,7 @@ MemoryStreamWriter Exporter::ExportWetTexture(UWetTexture* tex)
 	return data;
 }
 
-MemoryStreamWriter Exporter::ExportIceTexture(UIceTexture* tex)
+MemoryStreamWriter Exporter::ExportIceTexture(const UIceTexture* tex)
 {
 	MemoryStreamWriter data;
 	data << "BEGIN OBJECT CLASS=IceTexture USIZE=" << std::to_string(tex->USize()) << " VSIZE=" << std::to_string(tex->VSize()) << "\r\n";
@@ -228,7 +228,7 @@ MemoryStreamWriter Exporter::ExportIceTexture(UIceTexture* tex)
 	data << ExportObject(tex, 1, false);
 
 	// 5-color interpolated palette, this is what 227/469 UnrealEd recognizes
-	UPalette* palette = tex->Palette();
+	const UPalette* palette = tex->Palette();
 	for (int i = 0; i < 5; i++)
 	{
 		uint32_t r, g, b, a;
@@ -303,7 +303,7 @@ MemoryStreamWriter& operator<<(MemoryStreamWriter& s, BmpHeaderV3& bmp)
 	return s;
 }
 
-MemoryStreamWriter Exporter::ExportBmpIndexed(UTexture* tex)
+MemoryStreamWriter Exporter::ExportBmpIndexed(const UTexture* tex)
 {
 	MemoryStreamWriter data;
 	BmpHeaderV3 hdr = { 0 };
@@ -328,7 +328,7 @@ MemoryStreamWriter Exporter::ExportBmpIndexed(UTexture* tex)
 
 	data << hdr;
 
-	UPalette* palette = tex->Palette();
+	const UPalette* palette = tex->Palette();
 
 	// Assuming 8-bit color palette
 	for (int i = 0; i < 256; i++)
@@ -342,7 +342,7 @@ MemoryStreamWriter Exporter::ExportBmpIndexed(UTexture* tex)
 
 	hdr.pixelOffset = (uint32_t)data.Tell();
 
-	uint8_t *pixels = tex->Mipmaps[0].Data.data();
+	const uint8_t* pixels = tex->Mipmaps[0].Data.data();
 	for (int y = vsize; y > 0; y--)
 	{
 		for (int x = 0; x < usize; x++)
@@ -358,7 +358,7 @@ MemoryStreamWriter Exporter::ExportBmpIndexed(UTexture* tex)
 	return data;
 }
 
-MemoryStreamWriter Exporter::ExportPng(UTexture* tex)
+MemoryStreamWriter Exporter::ExportPng(const UTexture* tex)
 {
 	MemoryStreamWriter image = GetImage(tex);
 	MemoryStreamWriter data;
@@ -367,10 +367,11 @@ MemoryStreamWriter Exporter::ExportPng(UTexture* tex)
 	void* png = tdefl_write_image_to_png_file_in_memory_ex(image.Data(), tex->USize(), tex->VSize(), 4, &pLen, MZ_BEST_COMPRESSION, 0);
 
 	data.Write(png, pLen);
+	mz_free(png);
 	return data;
 }
 
-MemoryStreamWriter Exporter::GetImage(UTexture* tex)
+MemoryStreamWriter Exporter::GetImage(const UTexture* tex)
 {
 	switch (tex->ActualFormat)
 	{
@@ -381,11 +382,11 @@ MemoryStreamWriter Exporter::GetImage(UTexture* tex)
 	}
 }
 
-MemoryStreamWriter Exporter::GetImageP8(UTexture* tex)
+MemoryStreamWriter Exporter::GetImageP8(const UTexture* tex)
 {
 	MemoryStreamWriter data;
-	UPalette* palette = tex->Palette();
-	uint8_t* pixels = tex->Mipmaps[0].Data.data();
+	const UPalette* palette = tex->Palette();
+	const uint8_t* pixels = tex->Mipmaps[0].Data.data();
 
 	int usize = tex->USize();
 	int vsize = tex->VSize();
@@ -4,23 +4,25 @@
 #include "UObject/UClass.h"
 #include "UObject/UTexture.h"
 
+// Exporters only read objects through const access, which never copies data shared with the class defaults.
+// This is what makes it safe to run them on the export queue's worker threads.
 class Exporter
 {
 public:
-	static std::string ExportObject(UObject* obj, int tablevel, bool bInline);
+	static std::string ExportObject(const UObject* obj, int tablevel, bool bInline);
 
-	static MemoryStreamWriter ExportClass(UClass* cls);
-	static MemoryStreamWriter ExportTexture(UTexture* tex, const std::string& ext);
+	static MemoryStreamWriter ExportClass(const UClass* cls);
+	static MemoryStreamWriter ExportTexture(const UTexture* tex, const std::string& ext);
 
 private:
-	static MemoryStreamWriter ExportFireTexture(UFireTexture* tex);
-	static MemoryStreamWriter ExportWaveTexture(UWaveTexture* tex);
-	static MemoryStreamWriter ExportWetTexture(UWetTexture* tex);
-	static MemoryStreamWriter ExportIceTexture(UIceTexture* tex);
+	static MemoryStreamWriter ExportFireTexture(const UFireTexture* tex);
+	static MemoryStreamWriter ExportWaveTexture(const UWaveTexture* tex);
+	static MemoryStreamWriter ExportWetTexture(const UWetTexture* tex);
+	static MemoryStreamWriter ExportIceTexture(const UIceTexture* tex);
 
-	static MemoryStreamWriter ExportBmpIndexed(UTexture* tex);
-	static MemoryStreamWriter ExportPng(UTexture* tex);
+	static MemoryStreamWriter ExportBmpIndexed(const UTexture* tex);
+	static MemoryStreamWriter ExportPng(const UTexture* tex);
 
-	static MemoryStreamWriter GetImage(UTexture* tex);
-	static MemoryStreamWriter GetImageP8(UTexture* tex);
+	static MemoryStreamWriter GetImage(const UTexture* tex);
+	static MemoryStreamWriter GetImageP8(const UTexture* tex);
 };
\ No newline at end of file
@@ -0,0 +1,124 @@
+
+#include "Precomp.h"
+#include "ExportQueue.h"
+#include "Utils/File.h"
+
+ExportQueue::ExportQueue(size_t maxPendingWrites) : maxPendingWrites(maxPendingWrites)
+{
+	int count = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+	for (int i = 0; i < count; i++)
+	{
+		threads.push_back(std::thread([this]() { WorkerMain(); }));
+	}
+}
+
+ExportQueue::~ExportQueue()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	stopFlag = true;
+	lock.unlock();
+	taskAdded.notify_all();
+	writeRemoved.notify_all();
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void ExportQueue::Add(const std::string& folder, const std::string& filename, std::function<MemoryStreamWriter()> encode)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	Task task;
+	task.Folder = folder;
+	task.Filename = filename;
+	task.Encode = std::move(encode);
+	tasks.push_back(std::move(task));
+	pending++;
+	lock.unlock();
+	taskAdded.notify_one();
+}
+
+int ExportQueue::Finish(const std::function<void(const std::string& filename, const std::string& error)>& onError)
+{
+	int written = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	while (pending > 0)
+	{
+		writeAdded.wait(lock, [&]() { return !writes.empty(); });
+
+		std::list<Result> finished;
+		finished.splice(finished.end(), writes);
+		pending -= (int)finished.size();
+		lock.unlock();
+		writeRemoved.notify_all();
+
+		for (Result& result : finished)
+		{
+			std::string filename = FilePath::combine(result.Folder, result.Filename);
+			try
+			{
+				if (!result.Error.empty())
+					Exception::Throw(result.Error);
+
+				if (result.Data.Size() == 0)
+					continue;
+
+				if (std::find(createdFolders.begin(), createdFolders.end(), result.Folder) == createdFolders.end())
+				{
+					Directory::make_directory(FilePath::remove_last_component(result.Folder));
+					Directory::make_directory(result.Folder);
+					createdFolders.push_back(result.Folder);
+				}
+
+				File::write_all_bytes(filename, result.Data.Data(), result.Data.Size());
+				written++;
+			}
+			catch (const std::exception& e)
+			{
+				onError(filename, e.what());
+			}
+		}
+
+		lock.lock();
+	}
+	return written;
+}
+
+MemoryStreamWriter ExportQueue::Encode(Task& task, std::string& error)
+{
+	try
+	{
+		return task.Encode();
+	}
+	catch (const std::exception& e)
+	{
+		error = e.what();
+		return MemoryStreamWriter();
+	}
+}
+
+void ExportQueue::WorkerMain()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		taskAdded.wait(lock, [&]() { return stopFlag || !tasks.empty(); });
+		if (stopFlag)
+			break;
+
+		Task task = std::move(tasks.front());
+		tasks.pop_front();
+		lock.unlock();
+
+		std::string error;
+		MemoryStreamWriter data = Encode(task, error);
+
+		// Bound how many encoded files can wait for the writer
+		lock.lock();
+		writeRemoved.wait(lock, [&]() { return stopFlag || writes.size() < maxPendingWrites; });
+		if (stopFlag)
+			break;
+
+		writes.emplace_back(task, std::move(data));
+		writes.back().Error = std::move(error);
+		writeAdded.notify_one();
+	}
+}
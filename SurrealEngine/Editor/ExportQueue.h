@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Utils/MemoryStreamWriter.h"
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <list>
+
+// Encodes exported objects on worker threads while the calling thread writes the finished files to disk.
+// The encode functions may only read from objects that are already fully loaded, and only through const access.
+// The non-const property accessors copy data shared with the class defaults and would race with other workers.
+class ExportQueue
+{
+public:
+	ExportQueue(size_t maxPendingWrites = 16);
+	~ExportQueue();
+
+	// Queue an object export. Nothing is written if the encoded stream is empty.
+	void Add(const std::string& folder, const std::string& filename, std::function<MemoryStreamWriter()> encode);
+
+	// Write files as they finish encoding until all queued exports are done. Returns the number of files written.
+	int Finish(const std::function<void(const std::string& filename, const std::string& error)>& onError);
+
+private:
+	struct Task
+	{
+		std::string Folder;
+		std::string Filename;
+		std::function<MemoryStreamWriter()> Encode;
+	};
+
+	struct Result
+	{
+		Result(Task& task, MemoryStreamWriter data) : Folder(std::move(task.Folder)), Filename(std::move(task.Filename)), Data(std::move(data)) { }
+
+		std::string Folder;
+		std::string Filename;
+		MemoryStreamWriter Data;
+		std::string Error;
+	};
+
+	void WorkerMain();
+	static MemoryStreamWriter Encode(Task& task, std::string& error);
+
+	size_t maxPendingWrites = 0;
+	int pending = 0;
+
+	std::mutex mutex;
+	std::condition_variable taskAdded;
+	std::condition_variable writeAdded;
+	std::condition_variable writeRemoved;
+	std::list<Task> tasks;
+	std::list<Result> writes;
+	Array<std::thread> threads;
+	Array<std::string> createdFolders;
+	bool stopFlag = false;
+};
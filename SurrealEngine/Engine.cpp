@@ -10,7 +10,6 @@
 #include "UObject/UFont.h"
 #include "UObject/UMesh.h"
 #include "UObject/UActor.h"
-#include "UObject/ObjectTravelInfo.h"
 #include "UObject/UTexture.h"
 #include "UObject/UMusic.h"
 #include "UObject/USound.h"
@@ -103,6 +102,7 @@ void Engine::Run()
 		LevelInfo->TimeSeconds() += levelElapsed;
 		Logger::Get()->SetTimeSeconds(LevelInfo->TimeSeconds());
 
+		ReplayPendingInput();
 		UpdateInput(realTimeElapsed);
 
 		CallEvent(console, EventName::Tick, { ExpressionValue::FloatValue(levelElapsed) });
@@ -125,7 +125,10 @@ void Engine::Run()
 			{
 				if (LevelInfo->NextURL() == "?RESTART")
 				{
-					LoadMap(LevelInfo->URL, Level->TravelInfo);
+					// Copies, as loading the map destroys the current level
+					UnrealURL url = LevelInfo->URL;
+					auto travelInfo = Level->TravelInfo;
+					LoadMap(url, travelInfo);
 					LoginPlayer();
 				}
 				else if (LevelInfo->bNextItems())
@@ -136,15 +139,9 @@ void Engine::Run()
 						UPlayerPawn* pawn = UObject::TryCast<UPlayerPawn>(actor);
 						if (pawn && pawn->Player())
 						{
-							Array<ObjectTravelInfo> actorTravelInfo;
-							for (UInventory* item = pawn->Inventory(); item != nullptr; item = item->Inventory())
-							{
-								ObjectTravelInfo objInfo(item);
-								actorTravelInfo.push_back(std::move(objInfo));
-							}
 							std::string playerName = pawn->PlayerReplicationInfo()->PlayerName();
 							LogMessage("Adding travel data for player '" + playerName + "'");
-							travelInfo[playerName] = ObjectTravelInfo::ToString(actorTravelInfo);
+							travelInfo[playerName] = CreateTravelSnapshot(pawn, true, false);
 						}
 					}
 					LoadMap(UnrealURL(LevelInfo->URL, LevelInfo->NextURL()), travelInfo);
@@ -170,19 +167,8 @@ void Engine::Run()
 				UPlayerPawn* pawn = UObject::TryCast<UPlayerPawn>(actor);
 				if (pawn && pawn->Player())
 				{
-					Array<ObjectTravelInfo> actorTravelInfo;
-					if (ClientTravelInfo.TransferItems)
-					{
-						for (UInventory* item = pawn->Inventory(); item != nullptr; item = item->Inventory())
-						{
-							ObjectTravelInfo objInfo(item);
-							actorTravelInfo.push_back(std::move(objInfo));
-						}
-					}
-					// Add the pawn itself last
-					actorTravelInfo.push_back(ObjectTravelInfo(pawn));
 					std::string playerName = pawn->PlayerReplicationInfo()->PlayerName();
-					travelInfo[playerName] = ObjectTravelInfo::ToString(actorTravelInfo);
+					travelInfo[playerName] = CreateTravelSnapshot(pawn, ClientTravelInfo.TransferItems, true);
 				}
 			}
 
@@ -215,6 +201,8 @@ void Engine::Run()
 		ViewportWidth = engine->window->GetPixelWidth();
 		ViewportHeight = engine->window->GetPixelHeight();
 		render->DrawGame(levelElapsed);
+
+		packages->FlushIniFiles();
 	}
 
 	window->UnlockCursor();
@@ -291,12 +279,30 @@ void Engine::UnloadMap()
 	if (!LevelPackage)
 		return;
 
+	// The playing sounds and the camera refer to actors in the level
+	audio->StopSounds();
+	CameraActor = nullptr;
+
 	LevelInfo = nullptr;
 	Level = nullptr;
 	packages->UnloadMap(std::move(LevelPackage));
 }
 
-void Engine::LoadMap(const UnrealURL& url, const std::map<std::string, std::string>& travelInfo)
+ObjectSnapshot Engine::CreateTravelSnapshot(UPlayerPawn* pawn, bool includeInventory, bool includePawn)
+{
+	ObjectSnapshot snapshot(LevelPackage.get());
+	if (includeInventory)
+	{
+		for (UInventory* item = pawn->Inventory(); item != nullptr; item = item->Inventory())
+			snapshot.Add(item, true);
+	}
+	// Add the pawn itself last
+	if (includePawn)
+		snapshot.Add(pawn, true, TravelPlayerPawn);
+	return snapshot;
+}
+
+void Engine::LoadMap(const UnrealURL& url, const std::map<std::string, ObjectSnapshot>& travelInfo)
 {
 	ClientTravelInfo.URL.Map.clear();
 
@@ -308,9 +314,25 @@ void Engine::LoadMap(const UnrealURL& url, const std::map<std::string, std::stri
 
 	UnloadMap();
 
-	// Load map objects
+	struct LoadingMapScope
+	{
+		LoadingMapScope(Engine* engine) : engine(engine) { engine->LoadingMap = true; engine->LoadingProgress = 0.0f; }
+		~LoadingMapScope() { engine->LoadingMap = false; engine->packages->SetDelayLoadCallback({}); }
+		Engine* engine;
+	} loadingScope(this);
+
+	// Package IO happens in the background, object loading and level setup on this thread
+	LevelPackage = packages->LoadMap(url.Map, [&](float progress) { UpdateLoadingScreen(progress * 0.5f); });
+
+	int exportCount = std::max(LevelPackage->GetExportCount(), 1);
+	int objectsLoadedBefore = -1;
+	packages->SetDelayLoadCallback([&](int objectsLoaded) {
+		if (objectsLoadedBefore == -1)
+			objectsLoadedBefore = objectsLoaded;
+		UpdateLoadingScreen(0.5f + 0.4f * std::min((objectsLoaded - objectsLoadedBefore) / (float)exportCount, 1.0f));
+	});
 
-	LevelPackage = packages->LoadMap(url.Map);
+	// Load map objects
 
 	LevelInfo = UObject::Cast<ULevelInfo>(LevelPackage->GetUObject("LevelInfo", "LevelInfo0"));
 	if (packages->IsUnreal1())
@@ -338,6 +360,11 @@ void Engine::LoadMap(const UnrealURL& url, const std::map<std::string, std::stri
 
 	Level->TravelInfo = travelInfo; // Initially used travel info for level restart
 
+	packages->SetDelayLoadCallback({});
+	UpdateLoadingScreen(0.9f);
+
+	PrecacheSounds();
+
 	// Remove the actors meant for the editor (to do: should we do this at the package manager level?)
 	for (UActor*& actor : Level->Actors)
 	{
@@ -440,10 +467,71 @@ void Engine::LoadMap(const UnrealURL& url, const std::map<std::string, std::stri
 	audio->StopSounds();
 }
 
+void Engine::PrecacheSounds()
+{
+	// The sounds in the map package and the ones the level's actors refer to. Anything else is decoded when it is first played.
+	std::set<USound*> seen;
+	Array<USound*> sounds;
+	auto addSound = [&](USound* sound) { if (sound && seen.insert(sound).second) sounds.push_back(sound); };
+
+	for (USound* sound : LevelPackage->GetCreatedObjects<USound>())
+		addSound(sound);
+
+	for (UActor* actor : Level->Actors)
+	{
+		if (!actor)
+			continue;
+
+		for (UProperty* prop : actor->PropertyData.Class->Properties)
+		{
+			if (!UObject::TryCast<UObjectProperty>(prop))
+				continue;
+
+			auto values = static_cast<UObject* const*>(std::as_const(actor->PropertyData).Ptr(prop));
+			for (int i = 0; i < prop->ArrayDimension; i++)
+				addSound(UObject::TryCast<USound>(values[i]));
+		}
+	}
+
+	for (USound* sound : sounds)
+		sound->LoadNow();
+
+	audio->PrecacheSounds(sounds);
+}
+
+void Engine::UpdateLoadingScreen(float progress)
+{
+	using namespace std::chrono;
+
+	LoadingProgress = progress;
+	if (!window || !render)
+		return;
+
+	// Keep the window responsive without spending the load time on redrawing
+	uint64_t currentTime = duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+	if (currentTime - lastLoadingScreenUpdate < 33'000)
+		return;
+	lastLoadingScreenUpdate = currentTime;
+
+	// Sounds decode on the decoder's worker threads during the load. Collecting them here keeps that work off the end of the load.
+	audio->UpdateWhileLoading();
+
+	// This runs from inside object loading, so objects of the map can be half deserialized. None of them are reached from here:
+	// key and button events are buffered while LoadingMap is set, mouse movement only updates the viewport and
+	// DrawGame only draws the progress bar, which uses no textures, fonts or actors.
+	GameWindow::ProcessEvents();
+
+	ViewportX = 0;
+	ViewportY = 0;
+	ViewportWidth = window->GetPixelWidth();
+	ViewportHeight = window->GetPixelHeight();
+	render->DrawGame(0.0f);
+}
+
 void Engine::LoginPlayer()
 {
 	UnrealURL url = LevelInfo->URL;
-	std::map<std::string, std::string> travelInfo = Level->TravelInfo;
+	const std::map<std::string, ObjectSnapshot>& travelInfo = Level->TravelInfo;
 
 	UStringProperty stringProp("", nullptr, ObjectFlags::NoFlags);
 	std::string error, failcode;
@@ -486,7 +574,7 @@ void Engine::LoginPlayer()
 
 	CallEvent(pawn, EventName::TravelPreAccept);
 
-	Array<std::pair<UActor*, ObjectTravelInfo>> acceptedActors;
+	Array<UActor*> acceptedActors;
 	if (actorActuallySpawned)
 	{
 		std::string playerName = url.GetOption("Name");
@@ -496,39 +584,33 @@ void Engine::LoginPlayer()
 		auto it = travelInfo.find(playerName);
 		if (!playerName.empty() && it != travelInfo.end())
 		{
-			for (const ObjectTravelInfo& objInfo : ObjectTravelInfo::Parse(it->second))
+			const ObjectSnapshot& snapshot = it->second;
+
+			// Spawn all actors before restoring so that references between them can be fixed up
+			Array<UObject*> targets;
+			for (int i = 0; i < snapshot.GetObjectCount(); i++)
 			{
-				if (objInfo.isPlayerPawn)
+				UActor* acceptedActor = nullptr;
+				if (snapshot.GetFlags(i) & TravelPlayerPawn)
 				{
-					acceptedActors.push_back({ pawn, objInfo });
+					acceptedActor = pawn;
 				}
 				else
 				{
-					UClass* cls = packages->FindClass(objInfo.ClassName);
-					UActor* acceptedActor = nullptr;
-
+					UClass* cls = packages->FindClass(snapshot.GetClassName(i));
 					if (cls)
 						acceptedActor = pawn->Spawn(cls, nullptr, NameString(), nullptr, nullptr);
-
-					if (acceptedActor)
-						acceptedActors.push_back({ acceptedActor, objInfo });
-					else
-						LogMessage("Could not spawn travelling actor " + objInfo.ClassName);
+					if (!acceptedActor)
+						LogMessage("Could not spawn travelling actor " + snapshot.GetClassName(i).ToString());
 				}
-			}
 
-			for (auto& it : acceptedActors)
-			{
-				UActor* acceptedActor = it.first;
-				const ObjectTravelInfo& objInfo = it.second;
-
-				for (auto it = objInfo.Properties.begin(); it != objInfo.Properties.end(); it++)
-				{
-					LogMessage("Travelling '" + objInfo.ClassName + "' property '" + it->first + "': " + it->second);
-					UProperty* prop = acceptedActor->GetMemberProperty(it->first);
-					acceptedActor->SetPropertyFromString(it->first, it->second);
-				}
+				targets.push_back(acceptedActor);
+				if (acceptedActor)
+					acceptedActors.push_back(acceptedActor);
 			}
+
+			LogMessage("Travelling actors for player '" + playerName + "':\n" + snapshot.ToText());
+			snapshot.Restore(targets, packages.get(), LevelPackage.get());
 		}
 		else
 		{
@@ -542,12 +624,12 @@ void Engine::LoginPlayer()
 	}
 
 	for (auto it = acceptedActors.rbegin(); it != acceptedActors.rend(); ++it)
-		CallEvent((*it).first, EventName::TravelPreAccept);
+		CallEvent(*it, EventName::TravelPreAccept);
 
 	CallEvent(LevelInfo->Game(), EventName::AcceptInventory, { ExpressionValue::ObjectValue(pawn) });
 
 	for (auto it = acceptedActors.rbegin(); it != acceptedActors.rend(); ++it)
-		CallEvent((*it).first, EventName::TravelPostAccept);
+		CallEvent(*it, EventName::TravelPostAccept);
 
 	CallEvent(pawn, EventName::TravelPostAccept);
 	CallEvent(LevelInfo->Game(), EventName::PostLogin, { ExpressionValue::ObjectValue(pawn) });
@@ -1086,17 +1168,47 @@ void Engine::Key(std::string key)
 	if (Frame::RunState != FrameRunState::Running)
 		return;
 
+	if (LoadingMap)
+	{
+		pendingInput.push_back({ std::move(key) });
+		return;
+	}
+
 	for (char c : key)
 	{
 		CallEvent(console, EventName::KeyType, { ExpressionValue::ByteValue(c) });
 	}
 }
 
+void Engine::ReplayPendingInput()
+{
+	if (pendingInput.empty() || LoadingMap)
+		return;
+
+	Array<PendingInput> events;
+	events.swap(pendingInput);
+	for (PendingInput& e : events)
+	{
+		if (e.Type == IST_None)
+			Key(std::move(e.Text));
+		else
+			InputEvent(e.Key, e.Type, e.Delta);
+	}
+}
+
 void Engine::InputEvent(EInputKey key, EInputType type, int delta)
 {
 	if (Frame::RunState != FrameRunState::Running)
 		return;
 
+	if (LoadingMap)
+	{
+		// Mouse movement during the load is dropped. Replaying it would spin the view once the level starts.
+		if (type != IST_Axis)
+			pendingInput.push_back({ {}, key, type, delta });
+		return;
+	}
+
 	bool handled = CallEvent(console, EventName::KeyEvent, { ExpressionValue::ByteValue(key), ExpressionValue::ByteValue(type), ExpressionValue::FloatValue((float)delta) }).ToBool();
 	
 	if (!handled)
@@ -8,6 +8,7 @@
 #include "GameWindow.h"
 #include "UObject/UObject.h"
 #include "UObject/UnrealURL.h"
+#include "UObject/ObjectSnapshot.h"
 #include "GameFolder.h"
 #include <set>
 #include <list>
@@ -63,15 +64,22 @@ public:
 	void ClientTravel(const std::string& URL, uint8_t travelType, bool transferItems);
 	UnrealURL GetDefaultURL(const std::string& map);
 	void LoadEntryMap();
-	void LoadMap(const UnrealURL& url, const std::map<std::string, std::string>& travelInfo = {});
+	void LoadMap(const UnrealURL& url, const std::map<std::string, ObjectSnapshot>& travelInfo = {});
+	void UpdateLoadingScreen(float progress);
+	void PrecacheSounds();
 	void UnloadMap();
 	void LoginPlayer();
 
+	// Snapshot flag marking the player pawn itself
+	enum { TravelPlayerPawn = 1 };
+	ObjectSnapshot CreateTravelSnapshot(UPlayerPawn* pawn, bool includeInventory, bool includePawn);
+
 	UObject* FindObject(NameString name, NameString className);
 
 	std::string ConsoleCommand(UObject* context, const std::string& command, BitfieldBool& found);
 
 	void UpdateInput(float timeElapsed);
+	void ReplayPendingInput();
 	void InputCommand(const std::string& command, EInputKey key, int delta);
 
 	void LockCursor();
@@ -165,6 +173,11 @@ public:
 
 	bool quit = false;
 
+	// Set while LoadMap runs. Script objects must not be touched by window events or rendering then.
+	bool LoadingMap = false;
+	float LoadingProgress = 0.0f;
+	uint64_t lastLoadingScreenUpdate = 0;
+
 	uint64_t lastTime = 0;
 
 	void LoadEngineSettings();
@@ -183,6 +196,16 @@ public:
 	std::map<std::string, EInputKey> activeInputButtons;
 	std::map<std::string, ActiveInputAxis> activeInputAxes;
 
+	// Key presses, releases and typed text received while a map loads. Replayed in order once the level is running again.
+	struct PendingInput
+	{
+		std::string Text;
+		EInputKey Key = IK_None;
+		EInputType Type = IST_None;
+		int Delta = 0;
+	};
+	Array<PendingInput> pendingInput;
+
 	std::function<void()> tickDebugger;
 };
 
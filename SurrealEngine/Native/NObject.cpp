@@ -533,7 +533,7 @@ void NObject::GetPropertyText(UObject* Self, const std::string& PropName, std::s
 	{
 		if (prop->Name == PropName)
 		{
-			void* data = Self->PropertyData.Ptr(prop);
+			const void* data = std::as_const(Self->PropertyData).Ptr(prop);
 			ReturnValue = prop->PrintValue(data);
 			return;
 		}
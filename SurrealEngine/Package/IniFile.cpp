@@ -79,6 +79,7 @@ IniFile::IniFile(const IniFile& other)
 {
 	ini_file_path = other.ini_file_path;
 	sections = other.sections;
+	sectionIndex = other.sectionIndex;
 }
 
 bool IniFile::ReadLine(const std::string& text, size_t& pos, std::string& line)
@@ -193,7 +194,7 @@ void IniFile::SaveTo(const std::string& filename)
 	}
 
 	// Overwrite whatever is there
-	File::write_all_text(filename, ini_text);
+	File::write_all_text_atomic(filename, ini_text);
 
 	if (filename != ini_file_path)
 		ini_file_path = filename;
@@ -352,7 +353,7 @@ void IniFile::UpdateFile(const std::string& filename)
 			final_text += "\n";
 	}
 	
-	File::write_all_text(filename, final_text);
+	File::write_all_text_atomic(filename, final_text);
 
 	if (filename != ini_file_path)
 		ini_file_path = filename;
@@ -371,26 +372,19 @@ void IniFile::UpdateIfExists(const std::string& filename)
 IniSection& IniFile::AddUniqueSection(const std::string& sectionName)
 {
 	uint32_t sectionHash = HashIniString(sectionName);
-	for (auto& section : sections)
-	{
-		if (section.GetHash() == sectionHash)
-			return section;
-	}
+	auto it = sectionIndex.find(sectionHash);
+	if (it != sectionIndex.end())
+		return sections[it->second];
 
+	sectionIndex[sectionHash] = sections.size();
 	sections.push_back(std::move(IniSection(sectionName, sectionHash)));
 	return sections.back();
 }
 
 const IniSection* IniFile::FindSection(const std::string& sectionName) const
 {
-	uint32_t sectionHash = HashIniString(sectionName);
-	for (auto& section : sections)
-	{
-		if (section.GetHash() == sectionHash)
-			return &section;
-	}
-
-	return nullptr;
+	auto it = sectionIndex.find(HashIniString(sectionName));
+	return it != sectionIndex.end() ? &sections[it->second] : nullptr;
 }
 
 //====================================================================
@@ -406,6 +400,7 @@ IniSection::IniSection(const IniSection& other)
 	name = other.name;
 	hash = other.hash;
 	keys = other.keys;
+	keyIndex = other.keyIndex;
 }
 
 const std::string& IniSection::GetName() const
@@ -423,19 +418,26 @@ const Array<IniKey>& IniSection::GetKeys() const
 	return keys;
 }
 
+IniKey* IniSection::FindKey(uint32_t keyHash)
+{
+	auto it = keyIndex.find(keyHash);
+	return it != keyIndex.end() ? &keys[it->second] : nullptr;
+}
+
+const IniKey* IniSection::FindKey(uint32_t keyHash) const
+{
+	auto it = keyIndex.find(keyHash);
+	return it != keyIndex.end() ? &keys[it->second] : nullptr;
+}
+
 std::string IniSection::GetValue(const NameString& keyName, const std::string& defaultValue, const int index) const
 {
-	uint32_t keyHash = HashIniString(keyName.ToString());
-	for (auto& key : keys)
+	const IniKey* key = FindKey(HashIniString(keyName.ToString()));
+	if (key)
 	{
-		if (key.GetHash() == keyHash)
-		{
-			std::string value = key.GetValue(index);
-			if (value.size() == 0)
-				break;
-
+		std::string value = key->GetValue(index);
+		if (value.size() != 0)
 			return value;
-		}
 	}
 
 	return defaultValue;
@@ -443,66 +445,49 @@ std::string IniSection::GetValue(const NameString& keyName, const std::string& d
 
 Array<std::string> IniSection::GetValues(const NameString& keyName, const Array<std::string>& defaultValues) const
 {
-	uint32_t keyHash = HashIniString(keyName.ToString());
-	for (auto& key : keys)
-	{
-		if (key.GetHash() == keyHash)
-			return key.GetValues();
-	}
+	const IniKey* key = FindKey(HashIniString(keyName.ToString()));
+	if (key)
+		return key->GetValues();
 
 	return defaultValues;
 }
 
 bool IniSection::SetValue(const NameString& keyName, const std::string& newValue, const int index, const bool indexed)
 {
-	int result = -1;
 	uint32_t keyHash = HashIniString(keyName.ToString());
-	for (auto& key : keys)
-	{
-		if (key.GetHash() == keyHash)
-		{
-			result = key.SetValue(newValue, index);
-			result |= key.SetIndexed(indexed);
-			break;
-		}
-	}
-
-	if (result < 0)
+	IniKey* key = FindKey(keyHash);
+	if (key)
 	{
-		IniKey newKey(keyName.ToString(), keyHash);
-		newKey.SetValue(newValue, index);
-		newKey.SetIndexed(indexed);
-		keys.push_back(std::move(newKey));
-		return true;
+		int result = key->SetValue(newValue, index);
+		result |= key->SetIndexed(indexed);
+		return result == 1;
 	}
 
-	return result == 1;
+	IniKey newKey(keyName.ToString(), keyHash);
+	newKey.SetValue(newValue, index);
+	newKey.SetIndexed(indexed);
+	keyIndex[keyHash] = keys.size();
+	keys.push_back(std::move(newKey));
+	return true;
 }
 
 bool IniSection::SetValues(const NameString& keyName, const Array<std::string>& newValues, const bool indexed)
 {
-	int result = -1;
 	uint32_t keyHash = HashIniString(keyName.ToString());
-	for (auto& key : keys)
-	{
-		if (key.GetHash() == keyHash)
-		{
-			result = key.SetValues(newValues);
-			result |= key.SetIndexed(indexed);
-			break;
-		}
-	}
-
-	if (result < 0)
+	IniKey* key = FindKey(keyHash);
+	if (key)
 	{
-		IniKey newKey(keyName.ToString(), keyHash);
-		newKey.SetValues(newValues);
-		newKey.SetIndexed(indexed);
-		keys.push_back(std::move(newKey));
-		return true;
+		int result = key->SetValues(newValues);
+		result |= key->SetIndexed(indexed);
+		return result == 1;
 	}
 
-	return result == 1;
+	IniKey newKey(keyName.ToString(), keyHash);
+	newKey.SetValues(newValues);
+	newKey.SetIndexed(indexed);
+	keyIndex[keyHash] = keys.size();
+	keys.push_back(std::move(newKey));
+	return true;
 }
 
 //====================================================================
@@ -580,7 +565,7 @@ int IniKey::SetValues(const Array<std::string>& newValues)
 
 int IniKey::SetIndexed(bool newIndexed)
 {
-	bool result = !((int)indexed ^ (int)newIndexed);
+	int result = indexed != newIndexed ? 1 : 0;
 	indexed = newIndexed;
 	return result;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "NameString.h"
 #include <map>
+#include <unordered_map>
 
 class IniKey
 {
@@ -47,9 +48,13 @@ public:
 	bool SetValues(const NameString& keyName, const Array<std::string>& newValues, const bool indexed = false);
 
 private:
+	IniKey* FindKey(uint32_t keyHash);
+	const IniKey* FindKey(uint32_t keyHash) const;
+
 	std::string name;
 	uint32_t hash;
 	Array<IniKey> keys;
+	std::unordered_map<uint32_t, size_t> keyIndex; // Key hash to index in keys
 };
 
 class IniFile
@@ -92,4 +97,5 @@ private:
 	bool isModified = false;
 	std::string ini_file_path;
 	Array<IniSection> sections;
+	std::unordered_map<uint32_t, size_t> sectionIndex; // Section hash to index in sections
 };
\ No newline at end of file
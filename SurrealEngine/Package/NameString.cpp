@@ -1,7 +1,255 @@
 
 #include "Precomp.h"
 #include "NameString.h"
+#include <mutex>
 
-Array<std::string> NameString::Names;
-std::unordered_map<std::string, int> NameString::CompareStringToIndex;
-std::unordered_map<std::string, std::pair<int, int>> NameString::SpellStringToIndex;
+std::atomic<std::string*> NameString::NameBlocks[MaxNameBlocks];
+
+// Concurrent string to index map.
+//
+// Readers never lock: each shard publishes an open addressing table of entry pointers and entries are immutable once inserted.
+// Writers lock the shard, insert into the table and publish a larger table when it gets too full. Old tables are kept alive
+// since a reader may still be probing them - names are never freed so this costs at most the size of the current table.
+class NameHashMap
+{
+public:
+	struct Entry
+	{
+		size_t hash;
+		std::string key;
+		int compareIndex;
+		int spelledIndex;
+	};
+
+	const Entry* Find(size_t hash, std::string_view key) const
+	{
+		return FindInTable(GetShard(hash).table.load(std::memory_order_acquire), hash, key);
+	}
+
+	// Returns the existing entry for the key, or inserts the entry returned by createEntry
+	template<typename CreateFunc>
+	const Entry* FindOrInsert(size_t hash, std::string_view key, const CreateFunc& createEntry)
+	{
+		Shard& shard = GetShard(hash);
+		std::unique_lock<std::mutex> lock(shard.mutex);
+
+		Table* table = shard.table.load(std::memory_order_relaxed);
+		if (const Entry* entry = FindInTable(table, hash, key))
+			return entry;
+
+		if (!table || (table->count + 1) * 2 > table->mask + 1)
+		{
+			table = Grow(shard, table);
+		}
+
+		Entry* entry = createEntry();
+		size_t i = hash & table->mask;
+		while (table->slots[i].load(std::memory_order_relaxed))
+			i = (i + 1) & table->mask;
+		table->slots[i].store(entry, std::memory_order_release);
+		table->count++;
+		return entry;
+	}
+
+private:
+	struct Table
+	{
+		Table(size_t size) : mask(size - 1), slots(new std::atomic<Entry*>[size]) { for (size_t i = 0; i < size; i++) slots[i].store(nullptr, std::memory_order_relaxed); }
+
+		size_t mask = 0;
+		size_t count = 0;
+		std::unique_ptr<std::atomic<Entry*>[]> slots;
+		Table* retired = nullptr;
+	};
+
+	struct Shard
+	{
+		std::mutex mutex;
+		std::atomic<Table*> table{ nullptr };
+	};
+
+	enum { ShardCount = 16 };
+
+	// Use the top bits for the shard so they do not correlate with the slot index
+	Shard& GetShard(size_t hash) { return Shards[hash >> (sizeof(size_t) * 8 - 4)]; }
+	const Shard& GetShard(size_t hash) const { return Shards[hash >> (sizeof(size_t) * 8 - 4)]; }
+
+	static const Entry* FindInTable(const Table* table, size_t hash, std::string_view key)
+	{
+		if (!table)
+			return nullptr;
+
+		size_t i = hash & table->mask;
+		while (true)
+		{
+			const Entry* entry = table->slots[i].load(std::memory_order_acquire);
+			if (!entry)
+				return nullptr;
+			if (entry->hash == hash && entry->key == key)
+				return entry;
+			i = (i + 1) & table->mask;
+		}
+	}
+
+	static Table* Grow(Shard& shard, Table* oldTable)
+	{
+		Table* table = new Table(oldTable ? (oldTable->mask + 1) * 2 : 256);
+		if (oldTable)
+		{
+			for (size_t j = 0; j <= oldTable->mask; j++)
+			{
+				Entry* entry = oldTable->slots[j].load(std::memory_order_relaxed);
+				if (entry)
+				{
+					size_t i = entry->hash & table->mask;
+					while (table->slots[i].load(std::memory_order_relaxed))
+						i = (i + 1) & table->mask;
+					table->slots[i].store(entry, std::memory_order_relaxed);
+				}
+			}
+			table->count = oldTable->count;
+			table->retired = oldTable;
+		}
+		shard.table.store(table, std::memory_order_release);
+		return table;
+	}
+
+	Shard Shards[ShardCount];
+};
+
+class NameTable
+{
+public:
+	static size_t Hash(std::string_view value)
+	{
+		// 64-bit FNV-1a
+		uint64_t hash = 14695981039346656037ULL;
+		for (char c : value)
+		{
+			hash ^= (uint8_t)c;
+			hash *= 1099511628211ULL;
+		}
+		return (size_t)(hash ^ (hash >> 32));
+	}
+
+	static void GetIndex(std::string_view value, int& compareIndex, int& spelledIndex)
+	{
+		// Have we seen this spelling before?
+		size_t hash = Hash(value);
+		if (const NameHashMap::Entry* entry = SpellStringToIndex.Find(hash, value))
+		{
+			compareIndex = entry->compareIndex;
+			spelledIndex = entry->spelledIndex;
+			return;
+		}
+
+		InitNone();
+
+		// Any empty name string means None
+		if (value.empty())
+		{
+			compareIndex = 0;
+			spelledIndex = 0;
+			return;
+		}
+
+		const NameHashMap::Entry* spellEntry = SpellStringToIndex.FindOrInsert(hash, value, [&]() {
+			// Create case insensitive spelling string
+			std::string compareValue(value);
+			for (size_t i = 0, count = compareValue.size(); i < count; i++)
+			{
+				compareValue[i] = (char)stricmptable[(uint8_t)compareValue[i]];
+			}
+
+			// Do we have a compare index?
+			size_t compareHash = Hash(compareValue);
+			const NameHashMap::Entry* compareEntry = CompareStringToIndex.FindOrInsert(compareHash, compareValue, [&]() {
+				int index = AllocName(compareValue);
+				return new NameHashMap::Entry{ compareHash, compareValue, index, index };
+			});
+
+			// Create spellstring index
+			return new NameHashMap::Entry{ hash, std::string(value), compareEntry->compareIndex, AllocName(value) };
+		});
+
+		compareIndex = spellEntry->compareIndex;
+		spelledIndex = spellEntry->spelledIndex;
+	}
+
+	// Initialize list with None as index 0
+	static void InitNone()
+	{
+		std::call_once(NoneInitialized, []() {
+			int index = AllocName("None");
+			CompareStringToIndex.FindOrInsert(Hash("NONE"), "NONE", [&]() { return new NameHashMap::Entry{ Hash("NONE"), "NONE", index, index }; });
+			SpellStringToIndex.FindOrInsert(Hash("None"), "None", [&]() { return new NameHashMap::Entry{ Hash("None"), "None", index, index }; });
+		});
+	}
+
+private:
+	static int AllocName(std::string_view value)
+	{
+		int index = NameCount.fetch_add(1, std::memory_order_relaxed);
+		int blockIndex = index >> NameString::NameBlockBits;
+		if (blockIndex >= NameString::MaxNameBlocks)
+			Exception::Throw("Too many names");
+
+		std::atomic<std::string*>& blockPtr = NameString::NameBlocks[blockIndex];
+		std::string* block = blockPtr.load(std::memory_order_acquire);
+		if (!block)
+		{
+			std::string* newBlock = new std::string[NameString::NameBlockSize];
+			if (blockPtr.compare_exchange_strong(block, newBlock, std::memory_order_acq_rel))
+				block = newBlock;
+			else
+				delete[] newBlock;
+		}
+
+		// The entry referencing this index is published with a release store, which makes this write visible to readers
+		block[index & (NameString::NameBlockSize - 1)] = value;
+		return index;
+	}
+
+	static const int stricmptable[256];
+
+	static std::atomic<int> NameCount;
+	static std::once_flag NoneInitialized;
+	static NameHashMap CompareStringToIndex;
+	static NameHashMap SpellStringToIndex;
+};
+
+const int NameTable::stricmptable[256] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+	0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+	0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+	0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+	0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+	0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+	0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+	0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+std::atomic<int> NameTable::NameCount{ 0 };
+std::once_flag NameTable::NoneInitialized;
+NameHashMap NameTable::CompareStringToIndex;
+NameHashMap NameTable::SpellStringToIndex;
+
+// Default constructed names refer to index 0, so it must exist before any of them can be printed
+static struct NoneNameInitializer
+{
+	NoneNameInitializer() { NameTable::InitNone(); }
+} NoneNameInit;
+
+void NameString::GetIndex(std::string_view value)
+{
+	NameTable::GetIndex(value, CompareIndex, SpelledIndex);
+}
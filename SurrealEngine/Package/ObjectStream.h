@@ -3,6 +3,7 @@
 #include "Package.h"
 #include <string.h>
 #include "Utils/Exception.h"
+#include "Utils/File.h"
 
 enum class ObjectFlags : uint32_t;
 class UClass;
@@ -13,6 +14,9 @@ class ObjectStream
 public:
 	ObjectStream(Package* package, std::unique_ptr<uint64_t[]> buf, size_t startoffset, size_t size, ObjectFlags flags, const NameString& name, UClass* base) : package(package), buffer(std::move(buf)), data(reinterpret_cast<const uint8_t*>(buffer.get())), startoffset(startoffset), size(size), flags(flags), name(name), base(base) { }
 
+	// Reads directly from the memory mapped package file without copying the object
+	ObjectStream(Package* package, std::shared_ptr<MappedFile> mapping, size_t startoffset, size_t size, ObjectFlags flags, const NameString& name, UClass* base) : package(package), mapping(std::move(mapping)), data(this->mapping->data() + startoffset), startoffset(startoffset), size(size), flags(flags), name(name), base(base) { }
+
 	void ReadBytes(void* d, uint32_t s)
 	{
 		if (pos + s > size)
@@ -165,6 +169,7 @@ public:
 private:
 	Package* package = nullptr;
 	std::unique_ptr<uint64_t[]> buffer;
+	std::shared_ptr<MappedFile> mapping;
 	const uint8_t* data = nullptr;
 	size_t startoffset = 0;
 	size_t size = 0;
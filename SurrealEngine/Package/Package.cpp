@@ -2,6 +2,7 @@
 #include "Precomp.h"
 #include "Package.h"
 #include "PackageStream.h"
+#include "PackageHeaderCache.h"
 #include "PackageManager.h"
 #include "UObject/UObject.h"
 #include "UObject/UClass.h"
@@ -177,6 +178,7 @@ Package::Package(PackageManager* packageManager, const NameString& name, const s
 	RegisterNativeClass<UUdpLink>(ipdrvPackage, "UdpLink", "InternetLink");
 
 	Objects.resize(ExportTable.size());
+	ImportObjects.resize(ImportTable.size(), nullptr);
 }
 
 Package::~Package()
@@ -261,6 +263,11 @@ UObject* Package::GetUObject(int objref)
 	else if (objref < 0) // Import table object
 	{
 		ImportTableEntry* entry = GetImportEntry(objref);
+
+		int importIndex = -objref - 1;
+		if (ImportObjects[importIndex])
+			return ImportObjects[importIndex];
+
 		ImportTableEntry* entrypackage = GetImportEntry(entry->ObjPackage);
 
 		NameString groupName;
@@ -283,6 +290,8 @@ UObject* Package::GetUObject(int objref)
 		else if (!obj && packageName == "UnrealShare")
 			obj = Packages->GetPackage("UnrealI")->GetUObject(className, objectName, groupName);
 
+		// Failed imports are not remembered, so they are retried once the package or class they need has been loaded
+		ImportObjects[importIndex] = obj;
 		return obj;
 	}
 	else
@@ -297,15 +306,28 @@ UObject* Package::GetUObject(const NameString& className, const NameString& obje
 }
 
 int Package::FindObjectReference(const NameString& className, const NameString& objectName, const NameString& groupName)
+{
+	ObjectReferenceKey key = { className, objectName, groupName };
+	auto it = ObjectReferences.find(key);
+	if (it != ObjectReferences.end())
+		return it->second;
+
+	int objref = 0;
+	auto candidates = ExportsByName.find(objectName);
+	if (candidates != ExportsByName.end())
+		objref = FindObjectReference(candidates->second, className, groupName);
+
+	ObjectReferences[key] = objref;
+	return objref;
+}
+
+int Package::FindObjectReference(const Array<int>& candidates, const NameString& className, const NameString& groupName)
 {
 	bool isClass = className == "Class";
 
-	size_t count = ExportTable.size();
-	for (size_t index = 0; index < count; index++)
+	for (int index : candidates)
 	{
 		ExportTableEntry& entry = ExportTable[index];
-		if (GetName(entry.ObjName) != objectName)
-			continue;
 
 		if (!groupName.IsNone())
 		{
@@ -399,6 +421,18 @@ ImportTableEntry* Package::GetImportEntry(int objref)
 
 void Package::ReadTables()
 {
+	Array<std::string_view> cachedNames;
+	Array<uint32_t> cachedNameFlags;
+	if (Packages->headerCache->Read(Filename, Version, Flags, cachedNames, cachedNameFlags, ExportTable, ImportTable))
+	{
+		for (size_t i = 0; i < cachedNames.size(); i++)
+			AddName(NameString(cachedNames[i]), cachedNameFlags[i]);
+
+		for (int i = 0, count = (int)ExportTable.size(); i < count; i++)
+			ExportsByName[GetName(ExportTable[i].ObjName)].push_back(i);
+		return;
+	}
+
 	auto stream = Packages->GetStream(this);
 	stream->Seek(0);
 
@@ -443,11 +477,9 @@ void Package::ReadTables()
 	stream->Seek(nameOffset);
 	for (uint32_t i = 0; i < nameCount; i++)
 	{
-		NameTableEntry entry;
-		entry.Name = stream->ReadString();
-		entry.Flags = stream->ReadInt32();
-		NameTable.push_back(entry);
-		NameHash[entry.Name] = i;
+		NameString name = stream->ReadString();
+		uint32_t flags = stream->ReadInt32();
+		AddName(name, flags);
 	}
 
 	stream->Seek(exportOffset);
@@ -461,7 +493,7 @@ void Package::ReadTables()
 		entry.ObjFlags = (ObjectFlags)stream->ReadInt32();
 		entry.ObjSize = stream->ReadIndex();
 		entry.ObjOffset = (entry.ObjSize > 0) ? stream->ReadIndex() : -1;
-		ExportTable.push_back(entry);
+		AddExport(entry);
 	}
 
 	stream->Seek(importOffset);
@@ -474,6 +506,30 @@ void Package::ReadTables()
 		entry.ObjName = stream->ReadIndex();
 		ImportTable.push_back(entry);
 	}
+
+	Packages->headerCache->Store(Filename, Version, Flags, NameTable, ExportTable, ImportTable);
+}
+
+int Package::AddName(const NameString& name, uint32_t flags)
+{
+	NameTableEntry entry;
+	entry.Name = name;
+	entry.Flags = flags;
+	NameTable.push_back(entry);
+
+	int index = (int)NameTable.size() - 1;
+	NameHash[name] = index;
+	return index;
+}
+
+void Package::AddExport(const ExportTableEntry& entry)
+{
+	ExportTable.push_back(entry);
+	ExportsByName[GetName(entry.ObjName)].push_back((int)ExportTable.size() - 1);
+
+	// A lookup may have failed because this export did not exist yet
+	if (!ObjectReferences.empty())
+		ObjectReferences.clear();
 }
 
 std::unique_ptr<ObjectStream> Package::OpenObjectStream(int index, const NameString& name, UClass* base)
@@ -481,8 +537,11 @@ std::unique_ptr<ObjectStream> Package::OpenObjectStream(int index, const NameStr
 	const auto& entry = ExportTable[index];
 	if (entry.ObjSize > 0)
 	{
-		std::unique_ptr<uint64_t[]> buffer(new uint64_t[(entry.ObjSize + 7) / 8]);
 		auto stream = Packages->GetStream(this);
+		if (auto mapping = stream->GetMappedRange(entry.ObjOffset, entry.ObjSize))
+			return std::make_unique<ObjectStream>(this, std::move(mapping), entry.ObjOffset, entry.ObjSize, entry.ObjFlags, name, base);
+
+		std::unique_ptr<uint64_t[]> buffer(new uint64_t[(entry.ObjSize + 7) / 8]);
 		stream->Seek(entry.ObjOffset);
 		stream->ReadBytes(buffer.get(), entry.ObjSize);
 		return std::make_unique<ObjectStream>(this, std::move(buffer), entry.ObjOffset, entry.ObjSize, entry.ObjFlags, name, base);
@@ -493,18 +552,26 @@ std::unique_ptr<ObjectStream> Package::OpenObjectStream(int index, const NameStr
 	}
 }
 
-std::string Package::GetExportName(int objref)
+void Package::ReadBytes(uint32_t offset, void* data, uint32_t size)
+{
+	auto stream = Packages->GetStream(this);
+	stream->Seek(offset);
+	stream->ReadBytes(data, size);
+}
+
+std::string Package::GetExportName(int exportIndex) const
 {
-	if (objref <= 0)
+	if (exportIndex < 0 || (size_t)exportIndex >= ExportTable.size())
 		return "None";
 
-	ExportTableEntry& entry = ExportTable[objref];
-	std::string objname = NameTable[entry.ObjName].Name.ToString();
+	// Read only, as export workers call this from several threads at once
+	const ExportTableEntry* entry = &ExportTable[exportIndex];
+	std::string objname = NameTable[entry->ObjName].Name.ToString();
 
-	while (entry.ObjPackage != 0)
+	while (entry->ObjPackage > 0 && (size_t)entry->ObjPackage <= ExportTable.size())
 	{
-		entry = ExportTable[entry.ObjPackage - 1];
-		objname = NameTable[entry.ObjName].Name.ToString() + '.' + objname;
+		entry = &ExportTable[entry->ObjPackage - 1];
+		objname = NameTable[entry->ObjName].Name.ToString() + '.' + objname;
 	}
 
 	objname = Name.ToString() + '.' + objname;
@@ -4,6 +4,7 @@
 #include "ObjectFlags.h"
 #include "NameString.h"
 #include <functional>
+#include <unordered_map>
 
 class PackageManager;
 class PackageStream;
@@ -52,6 +53,7 @@ public:
 
 	const NameString& GetName(int index) const;
 	int GetVersion() const { return Version; }
+	int GetExportCount() const { return (int)ExportTable.size(); }
 	NameString GetPackageName() const { return Name; }
 	std::string GetPackageFilename() const { return Filename; }
 
@@ -61,14 +63,24 @@ public:
 	ImportTableEntry* GetImportEntry(int objref);
 	int FindObjectReference(const NameString& className, const NameString& objectName, const NameString& groupName = {});
 
-	std::string GetExportName(int objref);
+	// Full name of an export, package and groups included
+	std::string GetExportName(int exportIndex) const;
 
 	template<class T> Array<T*> GetAllObjects();
 
+	// Objects that have been created so far, without creating the rest of the export table
+	template<class T> Array<T*> GetCreatedObjects();
+
+	// Reads bytes straight from the package file. Used for data that is skipped when an object is loaded and read when first needed.
+	void ReadBytes(uint32_t offset, void* data, uint32_t size);
+
 private:
 	void ReadTables();
+	int AddName(const NameString& name, uint32_t flags);
+	void AddExport(const ExportTableEntry& entry);
 	std::unique_ptr<ObjectStream> OpenObjectStream(int index, const NameString& name, UClass* base);
 	void LoadExportObject(int index);
+	int FindObjectReference(const Array<int>& candidates, const NameString& className, const NameString& groupName);
 
 	template<typename T>
 	void RegisterNativeClass(bool registerInPackage, const NameString& className, const NameString& baseClass = {});
@@ -83,16 +95,42 @@ private:
 	Array<ExportTableEntry> ExportTable;
 	Array<ImportTableEntry> ImportTable;
 
-	std::map<NameString, int> NameHash;
+	std::unordered_map<NameString, int> NameHash;
+
+	// Export table indexes by object name, in table order
+	std::unordered_map<NameString, Array<int>> ExportsByName;
+
+	struct ObjectReferenceKey
+	{
+		NameString ClassName;
+		NameString ObjectName;
+		NameString GroupName;
+		bool operator==(const ObjectReferenceKey& other) const { return ClassName == other.ClassName && ObjectName == other.ObjectName && GroupName == other.GroupName; }
+	};
+
+	struct ObjectReferenceKeyHash
+	{
+		std::size_t operator()(const ObjectReferenceKey& key) const noexcept
+		{
+			std::hash<NameString> hash;
+			return hash(key.ObjectName) ^ (hash(key.ClassName) * 31) ^ (hash(key.GroupName) * 1031);
+		}
+	};
+
+	std::unordered_map<ObjectReferenceKey, int, ObjectReferenceKeyHash> ObjectReferences;
 
 	Array<std::unique_ptr<UObject>> Objects;
 
+	// Resolved import table objects. Resolving walks the package chain so it is only done once per import that was found.
+	Array<UObject*> ImportObjects;
+
 	std::map<NameString, std::function<UObject*(const NameString& name, UClass* cls, ObjectFlags flags)>> NativeClasses;
 
 	Package(const Package&) = delete;
 	Package& operator=(const Package&) = delete;
 
 	friend class PackageManager;
+	friend class PackagePreloader;
 	friend class UObject;
 };
 
@@ -115,24 +153,18 @@ void Package::RegisterNativeClass(bool registerInPackage, const NameString& clas
 		int objref = FindObjectReference("Class", className);
 		if (objref == 0)
 		{
-			if (NameHash.find(className) == NameHash.end())
-			{
-				NameTableEntry nameentry;
-				nameentry.Flags = 0;
-				nameentry.Name = className;
-				NameTable.push_back(nameentry);
-				NameHash[className] = (int)NameTable.size() - 1;
-			}
+			auto it = NameHash.find(className);
+			int nameIndex = (it != NameHash.end()) ? it->second : AddName(className, 0);
 
 			ExportTableEntry entry;
 			entry.ObjClass = 0;
 			entry.ObjBase = baseClass.IsNone() ? 0 : FindObjectReference("Class", baseClass);
 			entry.ObjPackage = 0;
-			entry.ObjName = NameHash[className];
+			entry.ObjName = nameIndex;
 			entry.ObjFlags = ObjectFlags::Native;
 			entry.ObjSize = 0;
 			entry.ObjOffset = 0;
-			ExportTable.push_back(entry);
+			AddExport(entry);
 		}
 	}
 }
@@ -0,0 +1,191 @@
+
+#include "Precomp.h"
+#include "PackageHeaderCache.h"
+#include "Utils/MemoryStreamWriter.h"
+#include "Utils/MemoryStreamReader.h"
+#include "Utils/Logger.h"
+#include <string.h>
+
+static_assert(sizeof(ExportTableEntry) == 7 * sizeof(int32_t), "ExportTableEntry is stored as raw data in the cache");
+static_assert(sizeof(ImportTableEntry) == 4 * sizeof(int32_t), "ImportTableEntry is stored as raw data in the cache");
+
+namespace
+{
+	const uint32_t CacheSignature = 0x43504553; // "SEPC"
+	const uint32_t CacheVersion = 2;
+}
+
+PackageHeaderCache::PackageHeaderCache(const std::string& cacheFilename) : cacheFilename(cacheFilename)
+{
+}
+
+bool PackageHeaderCache::Read(const std::string& packageFilename, int& version, PackageFlags& flags, Array<std::string_view>& names, Array<uint32_t>& nameFlags, Array<ExportTableEntry>& exports, Array<ImportTableEntry>& imports)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (!loaded)
+		Load();
+
+	auto it = entries.find(packageFilename);
+	if (it == entries.end())
+		return false;
+
+	FileStats stats;
+	const Entry& entry = it->second;
+	if (!File::try_get_stats(packageFilename, stats) || stats.size != entry.Stats.size || stats.modified != entry.Stats.modified)
+		return false;
+
+	version = entry.Version;
+	flags = entry.Flags;
+	names = entry.Names;
+	nameFlags = entry.NameFlags;
+	exports = entry.Exports;
+	imports = entry.Imports;
+	return true;
+}
+
+void PackageHeaderCache::Store(const std::string& packageFilename, int version, PackageFlags flags, const Array<NameTableEntry>& names, const Array<ExportTableEntry>& exports, const Array<ImportTableEntry>& imports)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (!loaded)
+		Load();
+
+	Entry entry;
+	if (!File::try_get_stats(packageFilename, entry.Stats))
+		return;
+
+	entry.Version = version;
+	entry.Flags = flags;
+	entry.Names.reserve(names.size());
+	entry.NameFlags.reserve(names.size());
+	for (const NameTableEntry& name : names)
+	{
+		// NameString spellings never move or get freed
+		const std::string& spelling = name.Name.ToString();
+		entry.Names.push_back(std::string_view(spelling));
+		entry.NameFlags.push_back(name.Flags);
+	}
+	entry.Exports = exports;
+	entry.Imports = imports;
+
+	entries[packageFilename] = std::move(entry);
+	dirty = true;
+}
+
+void PackageHeaderCache::Load()
+{
+	loaded = true;
+
+	FileStats stats;
+	if (cacheFilename.empty() || !File::try_get_stats(cacheFilename, stats))
+		return;
+
+	std::unordered_map<std::string, Entry> fileEntries;
+	try
+	{
+		Array<uint8_t> data = File::read_all_bytes(cacheFilename);
+
+		MemoryStreamReader reader(data.data(), data.size());
+		if (reader.Read<uint32_t>() != CacheSignature || reader.Read<uint32_t>() != CacheVersion)
+			throw std::runtime_error("Package header cache has the wrong version");
+
+		uint32_t entryCount = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < entryCount; i++)
+		{
+			std::string packageFilename(reader.ReadString());
+
+			Entry entry;
+			entry.Stats.size = reader.Read<uint64_t>();
+			entry.Stats.modified = reader.Read<int64_t>();
+			entry.Version = reader.Read<int32_t>();
+			entry.Flags = (PackageFlags)reader.Read<uint32_t>();
+
+			uint32_t nameCount = reader.Read<uint32_t>();
+			uint32_t exportCount = reader.Read<uint32_t>();
+			uint32_t importCount = reader.Read<uint32_t>();
+
+			entry.Names.reserve(nameCount);
+			entry.NameFlags.reserve(nameCount);
+			for (uint32_t j = 0; j < nameCount; j++)
+			{
+				entry.Names.push_back(reader.ReadString());
+				entry.NameFlags.push_back(reader.Read<uint32_t>());
+			}
+
+			entry.Exports.resize(exportCount);
+			reader.ReadBytes(entry.Exports.data(), exportCount * sizeof(ExportTableEntry));
+
+			entry.Imports.resize(importCount);
+			reader.ReadBytes(entry.Imports.data(), importCount * sizeof(ImportTableEntry));
+
+			fileEntries[packageFilename] = std::move(entry);
+		}
+
+		if (!reader.AtEnd())
+			throw std::runtime_error("Unexpected data at the end of the package header cache");
+
+		cacheData.push_back(std::move(data));
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Ignoring package header cache ") + cacheFilename + ": " + e.what());
+		return;
+	}
+
+	entries = std::move(fileEntries);
+}
+
+void PackageHeaderCache::Save()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (!dirty || cacheFilename.empty())
+		return;
+
+	// Drop packages that have been removed from the game folder
+	for (auto it = entries.begin(); it != entries.end();)
+	{
+		FileStats stats;
+		if (!File::try_get_stats(it->first, stats))
+			it = entries.erase(it);
+		else
+			++it;
+	}
+
+	MemoryStreamWriter writer;
+	writer << CacheSignature;
+	writer << CacheVersion;
+	writer << (uint32_t)entries.size();
+	for (auto& it : entries)
+	{
+		const Entry& entry = it.second;
+		writer << (uint32_t)it.first.size();
+		writer.Write(it.first.data(), it.first.size());
+		writer << entry.Stats.size;
+		writer << entry.Stats.modified;
+		writer << (int32_t)entry.Version;
+		writer << (uint32_t)entry.Flags;
+		writer << (uint32_t)entry.Names.size();
+		writer << (uint32_t)entry.Exports.size();
+		writer << (uint32_t)entry.Imports.size();
+		for (size_t i = 0; i < entry.Names.size(); i++)
+		{
+			writer << (uint32_t)entry.Names[i].size();
+			writer.Write(entry.Names[i].data(), entry.Names[i].size());
+			writer << entry.NameFlags[i];
+		}
+		writer.Write(entry.Exports.data(), entry.Exports.size() * sizeof(ExportTableEntry));
+		writer.Write(entry.Imports.data(), entry.Imports.size() * sizeof(ImportTableEntry));
+	}
+
+	try
+	{
+		File::write_all_bytes_atomic(cacheFilename, writer.Data(), writer.Size());
+		dirty = false;
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Could not save package header cache: ") + e.what());
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Package.h"
+#include "Utils/File.h"
+#include <string_view>
+#include <unordered_map>
+#include <mutex>
+
+// Decoded name, import and export tables of packages, kept on disk between sessions.
+// An entry is only used if the size and modification time of the package file still match. Safe to use from any thread.
+// The cache lives in the user's cache folder, as the game folder may be read only. An empty filename disables it.
+class PackageHeaderCache
+{
+public:
+	PackageHeaderCache(const std::string& cacheFilename);
+
+	bool Read(const std::string& packageFilename, int& version, PackageFlags& flags, Array<std::string_view>& names, Array<uint32_t>& nameFlags, Array<ExportTableEntry>& exports, Array<ImportTableEntry>& imports);
+	void Store(const std::string& packageFilename, int version, PackageFlags flags, const Array<NameTableEntry>& names, const Array<ExportTableEntry>& exports, const Array<ImportTableEntry>& imports);
+
+	void Save();
+
+private:
+	void Load();
+
+	struct Entry
+	{
+		FileStats Stats;
+		int Version = 0;
+		PackageFlags Flags = PackageFlags::NoFlags;
+		Array<std::string_view> Names;
+		Array<uint32_t> NameFlags;
+		Array<ExportTableEntry> Exports;
+		Array<ImportTableEntry> Imports;
+	};
+
+	std::mutex mutex;
+	std::string cacheFilename;
+	bool loaded = false;
+	bool dirty = false;
+
+	// Names of loaded entries point into the cache file data. Names of new entries point to NameString spellings.
+	Array<Array<uint8_t>> cacheData;
+	std::unordered_map<std::string, Entry> entries;
+};
@@ -3,8 +3,13 @@
 #include "PackageManager.h"
 #include "Package.h"
 #include "PackageStream.h"
+#include "PackageHeaderCache.h"
+#include "PackagePreloader.h"
+#include "ScanManifest.h"
+#include <future>
 #include "IniFile.h"
 #include "Utils/File.h"
+#include "Utils/Logger.h"
 #include "UObject/UObject.h"
 #include "UObject/UClass.h"
 #include "VM/NativeFunc.h"
@@ -39,6 +44,10 @@
 
 PackageManager::PackageManager(const GameLaunchInfo& launchInfo) : launchInfo(launchInfo)
 {
+	headerCache = std::make_unique<PackageHeaderCache>(OS::cache_filename(launchInfo.gameRootFolder, "PackageCache"));
+
+	scanManifest = std::make_unique<ScanManifest>(OS::cache_filename(launchInfo.gameRootFolder, "ScanManifest"));
+
 	RegisterFunctions();
 	LoadEngineIniFiles();
 	LoadIntFiles();
@@ -46,12 +55,19 @@ PackageManager::PackageManager(const GameLaunchInfo& launchInfo) : launchInfo(la
 	ScanPaths();
 	ScanForMaps();
 
+	scanManifest.reset(); // Saves any changes
+
 	InitPropertyOffsets(this);
 
 	// File::write_all_text("C:\\Development\\UTNativeProps.txt", NativeObjExtractor::Run(this));
 	// File::write_all_text("C:\\Development\\UTNativeFuncs.txt", NativeFuncExtractor::Run(this));
 }
 
+PackageManager::~PackageManager()
+{
+	headerCache->Save();
+}
+
 Package* PackageManager::GetPackage(const NameString& name)
 {
 	auto& package = packages[name];
@@ -71,7 +87,7 @@ Package* PackageManager::GetPackage(const NameString& name)
 	return package.get();
 }
 
-std::unique_ptr<Package> PackageManager::LoadMap(const std::string& path)
+std::unique_ptr<Package> PackageManager::LoadMap(const std::string& path, const std::function<void(float progress)>& onProgress)
 {
 	// Path is relative to the Maps folder?
 	// Or is it relative to the package requesting the map load?
@@ -80,12 +96,29 @@ std::unique_ptr<Package> PackageManager::LoadMap(const std::string& path)
 	// Only one of the above is most likely true. Lets begin with assuming its relative to the Maps folder.
 	std::string name = FilePath::remove_extension(FilePath::last_component(path));
 	std::string absolute_path = FilePath::relative_to_absolute_from_system(FilePath::combine(launchInfo.gameRootFolder, "Maps"), path);
-	return std::make_unique<Package>(this, name, absolute_path);
+
+	if (!preloader)
+		preloader = std::make_unique<PackagePreloader>(this);
+
+	auto result = std::async(std::launch::async, [&]() {
+		auto package = std::make_unique<Package>(this, name, absolute_path);
+		preloader->Run(package.get());
+		return package;
+	});
+
+	// The preloader owns the package list until it is done
+	if (onProgress)
+	{
+		while (result.wait_for(std::chrono::milliseconds(16)) != std::future_status::ready)
+			onProgress(preloader->GetProgress());
+	}
+	return result.get();
 }
 
 void PackageManager::UnloadMap(std::unique_ptr<Package> package)
 {
 	// Remove package from open streams cache:
+	std::unique_lock<std::mutex> lock(openStreamsMutex);
 	auto streamit = openStreams.begin();
 	while (streamit != openStreams.end())
 	{
@@ -104,7 +137,7 @@ void PackageManager::ScanForMaps()
 {
 	for (auto& mapFolderPath : mapFolders)
 	{
-		for (std::string filename : Directory::files(FilePath::combine(mapFolderPath, "*." + mapExtension)))
+		for (std::string filename : scanManifest->GetFiles(mapFolderPath, "*." + mapExtension))
 		{
 			maps.push_back(filename);
 		}
@@ -113,7 +146,7 @@ void PackageManager::ScanForMaps()
 
 void PackageManager::ScanFolder(const std::string& packagedir, const std::string& search)
 {
-	for (std::string filename : Directory::files(FilePath::combine(packagedir, search)))
+	for (std::string filename : scanManifest->GetFiles(packagedir, search))
 	{
 		// Do not add the package again if it exists
 		// This is useful for example when you have HD textures installed in a different folder
@@ -159,8 +192,19 @@ Array<NameString> PackageManager::GetPackageNames() const
 	return names;
 }
 
+Array<Package*> PackageManager::GetLoadedPackages() const
+{
+	Array<Package*> result;
+	for (auto& it : packages)
+	{
+		result.push_back(it.second.get());
+	}
+	return result;
+}
+
 std::shared_ptr<PackageStream> PackageManager::GetStream(Package* package)
 {
+	std::unique_lock<std::mutex> lock(openStreamsMutex);
 	int numStreams = 0;
 	for (auto it = openStreams.begin(); it != openStreams.end(); ++it)
 	{
@@ -179,7 +223,10 @@ std::shared_ptr<PackageStream> PackageManager::GetStream(Package* package)
 
 	OpenStream s;
 	s.Pkg = package;
-	s.Stream = std::make_shared<PackageStream>(package, File::open_existing(package->GetPackageFilename()));
+	if (auto mapping = MappedFile::try_open_existing(package->GetPackageFilename()))
+		s.Stream = std::make_shared<PackageStream>(package, std::move(mapping));
+	else
+		s.Stream = std::make_shared<PackageStream>(package, File::open_existing(package->GetPackageFilename()));
 	openStreams.push_front(s);
 
 	if (numStreams == 10)
@@ -190,13 +237,51 @@ std::shared_ptr<PackageStream> PackageManager::GetStream(Package* package)
 
 void PackageManager::DelayLoadNow()
 {
+	struct DelayLoadEntry
+	{
+		size_t Group;
+		int32_t Offset;
+		UObject* Obj;
+	};
+
+	Array<DelayLoadEntry> batch;
+	Array<Package*> groups;
 	while (!delayLoads.empty())
 	{
 		SetDelayLoadActive delayload(this);
 
-		UObject* obj = delayLoads.back();
-		delayLoads.pop_back();
-		obj->LoadNow();
+		// Load everything queued so far as one batch, grouped by package and in file offset order within each package.
+		// The packages come in the order their newest queued object was queued. Objects queued while this batch loads go into the next one.
+		batch.clear();
+		groups.clear();
+		for (size_t i = delayLoads.size(); i > 0; i--)
+		{
+			UObject* obj = delayLoads[i - 1];
+			if (obj->DelayLoad)
+			{
+				Package* package = obj->DelayLoad->package;
+				size_t group = std::find(groups.begin(), groups.end(), package) - groups.begin();
+				if (group == groups.size())
+					groups.push_back(package);
+				batch.push_back({ group, package->ExportTable[obj->DelayLoad->Index].ObjOffset, obj });
+			}
+		}
+		delayLoads.clear();
+
+		std::sort(batch.begin(), batch.end(), [](const DelayLoadEntry& a, const DelayLoadEntry& b) { return a.Group != b.Group ? a.Group < b.Group : a.Offset < b.Offset; });
+
+		for (const DelayLoadEntry& entry : batch)
+		{
+			// May already have been loaded as a dependency of an earlier object in the batch
+			if (!entry.Obj->DelayLoad)
+				continue;
+
+			entry.Obj->LoadNow();
+
+			delayLoadCount++;
+			if (delayLoadCallback && (delayLoadCount & 63) == 0)
+				delayLoadCallback(delayLoadCount);
+		}
 	}
 }
 
@@ -235,21 +320,9 @@ UClass* PackageManager::FindClass(const NameString& name)
 	}
 }
 
-std::unique_ptr<IniFile> PackageManager::GetIniFile(NameString iniName)
+const IniFile& PackageManager::GetIniFile(NameString iniName)
 {
-	bool userIni = (iniName == "user");
-	if (userIni && launchInfo.engineVersion > 219)
-		iniName = "User";
-	if (iniName == "system" || iniName == "System" || (userIni && launchInfo.engineVersion == 219))
-	{
-		// Clive Barker's Undying uses System.ini instead of ExeName.ini
-		if (IsCliveBarkersUndying())
-			iniName = "System";
-		else
-			iniName = launchInfo.gameExecutableName;
-	}
-
-	return std::make_unique<IniFile>(*iniFiles[iniName]);
+	return *GetSystemIniFile(iniName);
 }
 
 std::unique_ptr<IniFile>& PackageManager::GetSystemIniFile(NameString iniName)
@@ -302,22 +375,49 @@ void PackageManager::SetIniValues(NameString iniName, const NameString& sectionN
 
 void PackageManager::SaveAllIniFiles()
 {
-	const std::string system_folder = FilePath::combine(launchInfo.gameRootFolder, "System");
+	for (auto& iniFile : iniFiles)
+	{
+		SaveIniFile(iniFile.first, *iniFile.second);
+	}
+}
+
+void PackageManager::FlushIniFiles()
+{
+	// The SE- ini file is created at shutdown, once the subsystems have added their entries
+	if (missing_se_system_ini)
+		return;
 
 	for (auto& iniFile : iniFiles)
 	{
-		if (iniFile.first == launchInfo.gameExecutableName)
+		if (iniFile.second->IsModified())
 		{
-			const std::string engine_ini_name = "SE-" + launchInfo.gameExecutableName + ".ini";
-			iniFile.second->UpdateIfExists(FilePath::combine(system_folder, engine_ini_name));
+			try
+			{
+				SaveIniFile(iniFile.first, *iniFile.second);
+			}
+			catch (const std::exception& e)
+			{
+				LogMessage("Could not save " + iniFile.first.ToString() + ".ini: " + e.what());
+			}
 		}
-		else if (iniFile.first == "User")
-			iniFile.second->UpdateIfExists(FilePath::combine(system_folder, "SE-User.ini"));
-		else
-			iniFile.second->UpdateFile();
 	}
 }
 
+void PackageManager::SaveIniFile(const NameString& iniName, IniFile& iniFile)
+{
+	const std::string system_folder = FilePath::combine(launchInfo.gameRootFolder, "System");
+
+	if (iniName == launchInfo.gameExecutableName)
+	{
+		const std::string engine_ini_name = "SE-" + launchInfo.gameExecutableName + ".ini";
+		iniFile.UpdateIfExists(FilePath::combine(system_folder, engine_ini_name));
+	}
+	else if (iniName == "User")
+		iniFile.UpdateIfExists(FilePath::combine(system_folder, "SE-User.ini"));
+	else
+		iniFile.UpdateFile();
+}
+
 void PackageManager::LoadPackageRemaps()
 {
 	auto remap_keys = GetIniKeysFromSection("system", "PackageRemap");
@@ -361,13 +461,24 @@ void PackageManager::LoadEngineIniFiles()
 void PackageManager::LoadIntFiles()
 {
 	std::string systemdir = FilePath::combine(launchInfo.gameRootFolder, "System");
-	for (std::string filename : Directory::files(FilePath::combine(systemdir, "*.int")))
+	for (std::string filename : scanManifest->GetFiles(systemdir, "*.int"))
 	{
 		try
 		{
-			auto intFile = std::make_unique<IniFile>(FilePath::combine(systemdir, filename));
+			std::string intFilename = FilePath::combine(systemdir, filename);
+			intFilenames[FilePath::remove_extension(filename)] = intFilename;
 
-			for (const std::string& value : intFile->GetValues("Public", "Object"))
+			// Only parse the file now if the manifest does not know its objects. Localize loads it when needed.
+			Array<std::string> objects;
+			if (!scanManifest->ReadIntObjects(intFilename, objects))
+			{
+				auto intFile = std::make_unique<IniFile>(intFilename);
+				objects = intFile->GetValues("Public", "Object");
+				scanManifest->StoreIntObjects(intFilename, objects);
+				intFiles[FilePath::remove_extension(filename)] = std::move(intFile);
+			}
+
+			for (const std::string& value : objects)
 			{
 				auto desc = ParseIntPublicValue(value);
 				if (!desc["Name"].empty() && !desc["Class"].empty() && !desc["MetaClass"].empty()) // Used by Actor.GetInt
@@ -402,8 +513,6 @@ void PackageManager::LoadIntFiles()
 					IntObjects[cls].push_back(std::move(obj));
 				}
 			}
-
-			intFiles[FilePath::remove_extension(filename)] = std::move(intFile);
 		}
 		catch (...)
 		{
@@ -434,7 +543,11 @@ std::string PackageManager::Localize(NameString packageName, const NameString& s
 	{
 		try
 		{
-			intFile = std::make_unique<IniFile>(FilePath::combine(launchInfo.gameRootFolder, "System/" + packageName.ToString() + ".int"));
+			auto it = intFilenames.find(packageName);
+			if (it != intFilenames.end())
+				intFile = std::make_unique<IniFile>(it->second);
+			else
+				intFile = std::make_unique<IniFile>(FilePath::combine(launchInfo.gameRootFolder, "System/" + packageName.ToString() + ".int"));
 		}
 		catch (...)
 		{
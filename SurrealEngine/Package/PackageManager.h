@@ -4,8 +4,12 @@
 #include "IniFile.h"
 #include "GameFolder.h"
 #include <list>
+#include <mutex>
 
 class PackageStream;
+class PackageHeaderCache;
+class PackagePreloader;
+class ScanManifest;
 class UObject;
 class UClass;
 
@@ -21,6 +25,7 @@ class PackageManager
 {
 public:
 	PackageManager(const GameLaunchInfo& launchInfo);
+	~PackageManager();
 
 	bool IsUnreal1() const { return launchInfo.gameExecutableName == "Unreal"; }
 	bool IsUnreal1_226() const { return IsUnreal1() && launchInfo.engineVersion == 226; }
@@ -35,8 +40,10 @@ public:
 
 	Package *GetPackage(const NameString& name);
 	Array<NameString> GetPackageNames() const;
+	Array<Package*> GetLoadedPackages() const;
 
-	std::unique_ptr<Package> LoadMap(const std::string& path);
+	// Package IO runs on a background thread. onProgress is called on the calling thread while waiting for it.
+	std::unique_ptr<Package> LoadMap(const std::string& path, const std::function<void(float progress)>& onProgress = {});
 	void UnloadMap(std::unique_ptr<Package> package);
 
 	std::shared_ptr<PackageStream> GetStream(Package* package);
@@ -48,7 +55,7 @@ public:
 
 	std::string GetMapExtension() { return mapExtension; }
 
-	std::unique_ptr<IniFile> GetIniFile(NameString iniName);
+	const IniFile& GetIniFile(NameString iniName);
 	Array<NameString> GetIniKeysFromSection(NameString iniName, const NameString& sectionName);
 	std::string GetIniValue(NameString iniName, const NameString& sectionName, const NameString& keyName, std::string default_value = "", const int index = 0);
 	Array<std::string> GetIniValues(NameString iniName, const NameString& sectionName, const NameString& keyName, Array<std::string> default_values = {});
@@ -56,6 +63,12 @@ public:
 	void SetIniValues(NameString iniName, const NameString& sectionName, const NameString& keyName, const Array<std::string>& newValues);
 	void SaveAllIniFiles();
 
+	// Writes ini files changed since the last flush. Called once per frame so repeated config saves only hit the disk once.
+	void FlushIniFiles();
+
+	// Called every few objects while delay loads are processed. The argument is the total number of objects loaded so far.
+	void SetDelayLoadCallback(std::function<void(int objectsLoaded)> callback) { delayLoadCallback = std::move(callback); }
+
 	std::string Localize(NameString packageName, const NameString& sectionName, const NameString& keyName);
 
 	Array<IntObject>& GetIntObjects(const NameString& metaclass);
@@ -65,6 +78,7 @@ public:
 
 private:
 	std::unique_ptr<IniFile>& GetSystemIniFile(NameString iniName);
+	void SaveIniFile(const NameString& iniName, IniFile& iniFile);
 	void LoadEngineIniFiles();
 	void LoadIntFiles();
 	void LoadPackageRemaps();
@@ -80,11 +94,14 @@ private:
 
 	Array<UObject*> delayLoads;
 	int delayLoadActive = 0;
+	int delayLoadCount = 0;
+	std::function<void(int objectsLoaded)> delayLoadCallback;
 
 	std::map<NameString, std::string> packageFilenames;
 	std::map<NameString, std::unique_ptr<Package>> packages;
 	std::map<NameString, std::unique_ptr<IniFile>> iniFiles;
 	std::map<NameString, std::unique_ptr<IniFile>> intFiles;
+	std::map<NameString, std::string> intFilenames;
 	std::map<std::string, std::string> packageRemaps;
 
 	std::map<NameString, Array<IntObject>> IntObjects;
@@ -104,10 +121,16 @@ private:
 	};
 
 	std::list<OpenStream> openStreams;
+	std::mutex openStreamsMutex;
+
+	std::unique_ptr<PackageHeaderCache> headerCache;
+	std::unique_ptr<ScanManifest> scanManifest;
+	std::unique_ptr<PackagePreloader> preloader;
 
 	GameLaunchInfo launchInfo;
 
 	friend class Package;
+	friend class PackagePreloader;
 	friend struct SetDelayLoadActive;
 };
 
@@ -0,0 +1,228 @@
+
+#include "Precomp.h"
+#include "PackagePreloader.h"
+#include "PackageManager.h"
+#include "Utils/File.h"
+#include <thread>
+
+PackagePreloader::PackagePreloader(PackageManager* packages) : Packages(packages)
+{
+	// The thread calling Run does its share of the work too
+	int threadCount = std::max((int)std::thread::hardware_concurrency(), 1) - 1;
+	for (int i = 0; i < threadCount; i++)
+		threads.push_back(std::thread([this]() { ThreadMain(); }));
+}
+
+PackagePreloader::~PackagePreloader()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	stopFlag = true;
+	lock.unlock();
+	condition.notify_all();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void PackagePreloader::Run(Package* root)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	requested.clear();
+	loaded.clear();
+	pendingObjects.clear();
+	finished = 0;
+
+	// Packages already open can be used by the workers as long as the main thread waits for them
+	for (auto& it : Packages->packages)
+	{
+		if (it.second)
+			loaded[it.first] = it.second.get();
+	}
+
+	Array<PrefetchRange> prefetch;
+	for (const ExportTableEntry& entry : root->ExportTable)
+	{
+		if (entry.ObjSize > 0)
+			prefetch.push_back({ root->GetPackageFilename(), (uint32_t)entry.ObjOffset, (uint32_t)entry.ObjSize });
+	}
+
+	AddPackage(root, prefetch);
+	if (queue.empty())
+		return;
+
+	runCounter++;
+	lock.unlock();
+	condition.notify_all();
+
+	Prefetch(prefetch);
+
+	lock.lock();
+	WorkerMain(lock);
+	condition.wait(lock, [&]() { return workersInRun == 0; });
+
+	for (std::unique_ptr<Package>& package : results)
+	{
+		NameString name = package->GetPackageName();
+		Packages->packages[name] = std::move(package);
+	}
+	results.clear();
+}
+
+float PackagePreloader::GetProgress() const
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	return requested.empty() ? 0.0f : finished / (float)requested.size();
+}
+
+void PackagePreloader::ThreadMain()
+{
+	uint64_t lastRun = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		condition.wait(lock, [&]() { return stopFlag || runCounter != lastRun; });
+		if (stopFlag)
+			break;
+
+		lastRun = runCounter;
+		workersInRun++;
+		WorkerMain(lock);
+		workersInRun--;
+		if (workersInRun == 0)
+			condition.notify_all();
+	}
+}
+
+void PackagePreloader::WorkerMain(std::unique_lock<std::mutex>& lock)
+{
+	while (true)
+	{
+		condition.wait(lock, [&]() { return !queue.empty() || active == 0; });
+		if (queue.empty())
+			break;
+
+		NameString name = queue.back();
+		queue.pop_back();
+		active++;
+		lock.unlock();
+
+		std::unique_ptr<Package> package;
+		try
+		{
+			package = std::make_unique<Package>(Packages, name, Packages->packageFilenames.find(name)->second);
+		}
+		catch (const std::exception&)
+		{
+			// Leave it to the regular load path to report the error
+		}
+
+		Array<PrefetchRange> prefetch;
+		lock.lock();
+		if (package)
+		{
+			AddPackage(package.get(), prefetch);
+			results.push_back(std::move(package));
+		}
+		lock.unlock();
+		condition.notify_all();
+
+		Prefetch(prefetch);
+
+		lock.lock();
+		active--;
+		finished++;
+		if (active == 0 && queue.empty())
+			condition.notify_all();
+	}
+}
+
+void PackagePreloader::AddPackage(Package* package, Array<PrefetchRange>& prefetch)
+{
+	loaded[package->GetPackageName()] = package;
+
+	auto it = pendingObjects.find(package->GetPackageName());
+	if (it != pendingObjects.end())
+	{
+		for (const NameString& objectName : it->second)
+			AddObjectReference({ package->GetPackageName(), objectName }, prefetch);
+		pendingObjects.erase(it);
+	}
+
+	for (const ImportTableEntry& entry : package->ImportTable)
+	{
+		if (entry.ObjPackage > 0 || (size_t)entry.ObjName >= package->NameTable.size())
+			continue;
+
+		if (entry.ObjPackage == 0)
+		{
+			AddObjectReference({ package->GetName(entry.ObjName), {} }, prefetch);
+			continue;
+		}
+
+		const ImportTableEntry* outer = &entry;
+		while (outer && outer->ObjPackage < 0)
+		{
+			size_t outerIndex = -outer->ObjPackage - 1;
+			outer = outerIndex < package->ImportTable.size() ? &package->ImportTable[outerIndex] : nullptr;
+		}
+
+		if (outer && outer->ObjPackage == 0 && (size_t)outer->ObjName < package->NameTable.size())
+			AddObjectReference({ package->GetName(outer->ObjName), package->GetName(entry.ObjName) }, prefetch);
+	}
+}
+
+void PackagePreloader::AddObjectReference(const ObjectReference& objref, Array<PrefetchRange>& prefetch)
+{
+	auto it = loaded.find(objref.PackageName);
+	if (it == loaded.end())
+	{
+		// Queue the package the first time it is seen
+		if (requested.insert(objref.PackageName).second && Packages->packageFilenames.find(objref.PackageName) != Packages->packageFilenames.end())
+			queue.push_back(objref.PackageName);
+		if (!objref.ObjectName.IsNone())
+			pendingObjects[objref.PackageName].push_back(objref.ObjectName);
+		return;
+	}
+
+	if (objref.ObjectName.IsNone())
+		return;
+
+	Package* package = it->second;
+	auto exportsIt = package->ExportsByName.find(objref.ObjectName);
+	if (exportsIt == package->ExportsByName.end())
+		return;
+
+	for (int index : exportsIt->second)
+	{
+		const ExportTableEntry& entry = package->ExportTable[index];
+		if (entry.ObjSize > 0)
+			prefetch.push_back({ package->GetPackageFilename(), (uint32_t)entry.ObjOffset, (uint32_t)entry.ObjSize });
+	}
+}
+
+void PackagePreloader::Prefetch(const Array<PrefetchRange>& ranges)
+{
+	std::string filename;
+	std::shared_ptr<MappedFile> mapping;
+	uint8_t sum = 0;
+	for (const PrefetchRange& range : ranges)
+	{
+		if (range.Filename != filename)
+		{
+			filename = range.Filename;
+			mapping = MappedFile::try_open_existing(filename);
+		}
+
+		if (!mapping || (uint64_t)range.Offset + range.Size > mapping->size())
+			continue;
+
+		// Touch every page so it gets read into the page cache
+		const uint8_t* data = mapping->data() + range.Offset;
+		for (uint32_t i = 0; i < range.Size; i += 4096)
+			sum += data[i];
+		sum += data[range.Size - 1];
+	}
+
+	static std::atomic<uint8_t> sink;
+	sink.fetch_add(sum, std::memory_order_relaxed);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Package.h"
+#include <mutex>
+#include <condition_variable>
+#include <list>
+#include <set>
+#include <thread>
+
+class PackageManager;
+class MappedFile;
+
+// Opens the packages imported by a package, directly or indirectly, on worker threads.
+// The export data of the imported objects is pre-read so the page cache is warm when the objects are loaded.
+// The worker threads are started once and reused for every map load.
+class PackagePreloader
+{
+public:
+	PackagePreloader(PackageManager* packages);
+	~PackagePreloader();
+
+	void Run(Package* root);
+
+	// Fraction of the discovered packages that have been opened. Can be called from any thread.
+	float GetProgress() const;
+
+private:
+	struct ObjectReference
+	{
+		NameString PackageName;
+		NameString ObjectName;
+	};
+
+	struct PrefetchRange
+	{
+		std::string Filename;
+		uint32_t Offset;
+		uint32_t Size;
+	};
+
+	void ThreadMain();
+	void WorkerMain(std::unique_lock<std::mutex>& lock);
+	void AddPackage(Package* package, Array<PrefetchRange>& prefetch);
+	void AddObjectReference(const ObjectReference& objref, Array<PrefetchRange>& prefetch);
+	static void Prefetch(const Array<PrefetchRange>& ranges);
+
+	PackageManager* Packages = nullptr;
+
+	mutable std::mutex mutex;
+	std::condition_variable condition;
+	Array<NameString> queue;
+	int active = 0;
+	int finished = 0;
+
+	Array<std::thread> threads;
+	uint64_t runCounter = 0;
+	int workersInRun = 0;
+	bool stopFlag = false;
+
+	std::set<NameString> requested;
+	std::map<NameString, Package*> loaded;
+	std::map<NameString, Array<NameString>> pendingObjects;
+	std::list<std::unique_ptr<Package>> results;
+};
@@ -6,84 +6,45 @@
 
 PackageStream::PackageStream(Package* package, std::shared_ptr<File> file) : package(package), file(file)
 {
+	fileSize = file->size();
+	readAhead.resize(ReadAheadSize);
+	bufferData = readAhead.data();
 }
 
-void PackageStream::ReadBytes(void* d, uint32_t s)
+PackageStream::PackageStream(Package* package, std::shared_ptr<MappedFile> mapping) : package(package), mapping(mapping)
 {
-	file->read(d, s);
+	fileSize = mapping->size();
+	bufferData = mapping->data();
+	bufferSize = mapping->size();
 }
 
-int8_t PackageStream::ReadInt8()
+void PackageStream::ReadBytesSlow(void* d, uint32_t s)
 {
-	int8_t t;
-	ReadBytes(&t, 1);
-	return t;
-}
-
-int16_t PackageStream::ReadInt16()
-{
-	int16_t t;
-	ReadBytes(&t, 2);
-	return t;
-}
-
-int32_t PackageStream::ReadInt32()
-{
-	int32_t t;
-	ReadBytes(&t, 4);
-	return t;
-}
-
-int64_t PackageStream::ReadInt64()
-{
-	int64_t t;
-	ReadBytes(&t, 8);
-	return t;
-}
-
-float PackageStream::ReadFloat()
-{
-	float t;
-	ReadBytes(&t, 4);
-	return t;
-}
-
-uint8_t PackageStream::ReadUInt8()
-{
-	return ReadInt8();
-}
-
-uint16_t PackageStream::ReadUInt16()
-{
-	return ReadInt16();
-}
-
-uint32_t PackageStream::ReadUInt32()
-{
-	return ReadInt32();
-}
-
-uint64_t PackageStream::ReadUInt64()
-{
-	return ReadInt64();
-}
-
-void PackageStream::Seek(uint32_t offset)
-{
-	file->seek(offset);
-}
-
-void PackageStream::Skip(uint32_t bytes)
-{
-	file->seek(file->tell());
-}
+	if (pos + s > fileSize)
+		Exception::Throw("Unexpected end of file in " + package->GetPackageName().ToString());
 
-uint32_t PackageStream::Tell()
-{
-	return (uint32_t)file->tell();
+	if (mapping)
+	{
+		// The whole file is in the buffer so the fast path always hits unless we hit the end
+		memcpy(d, bufferData + pos, s);
+		pos += s;
+	}
+	else if (s >= ReadAheadSize)
+	{
+		// Big blobs bypass the read ahead buffer
+		file->seek(pos);
+		file->read(d, s);
+		pos += s;
+	}
+	else
+	{
+		FillBuffer();
+		memcpy(d, bufferData, s);
+		pos += s;
+	}
 }
 
-int32_t PackageStream::ReadIndex()
+int32_t PackageStream::ReadIndexSlow()
 {
 	uint8_t value = ReadInt8();
 	bool signbit = value & (1 << 7);
@@ -104,6 +65,14 @@ int32_t PackageStream::ReadIndex()
 	return index;
 }
 
+void PackageStream::FillBuffer()
+{
+	bufferStart = pos;
+	bufferSize = (size_t)std::min(fileSize - pos, (uint64_t)ReadAheadSize);
+	file->seek(pos);
+	file->read(readAhead.data(), bufferSize);
+}
+
 std::string PackageStream::ReadString()
 {
 	if (GetVersion() >= 64)
@@ -137,3 +106,11 @@ int PackageStream::GetVersion() const
 {
 	return package->GetVersion();
 }
+
+std::shared_ptr<MappedFile> PackageStream::GetMappedRange(uint32_t offset, uint32_t size) const
+{
+	if (mapping && (uint64_t)offset + size <= mapping->size())
+		return mapping;
+	else
+		return {};
+}
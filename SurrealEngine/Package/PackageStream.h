@@ -1,35 +1,96 @@
 #pragma once
 
+#include <string.h>
+
 class File;
+class MappedFile;
 class Package;
 
 class PackageStream
 {
 public:
 	PackageStream(Package* package, std::shared_ptr<File> file);
+	PackageStream(Package* package, std::shared_ptr<MappedFile> mapping);
+
+	void ReadBytes(void* d, uint32_t s)
+	{
+		if (pos >= bufferStart && pos - bufferStart + s <= bufferSize)
+		{
+			memcpy(d, bufferData + (pos - bufferStart), s);
+			pos += s;
+		}
+		else
+		{
+			ReadBytesSlow(d, s);
+		}
+	}
+
+	int8_t ReadInt8() { int8_t t; ReadBytes(&t, 1); return t; }
+	int16_t ReadInt16() { int16_t t; ReadBytes(&t, 2); return t; }
+	int32_t ReadInt32() { int32_t t; ReadBytes(&t, 4); return t; }
+	int64_t ReadInt64() { int64_t t; ReadBytes(&t, 8); return t; }
+	float ReadFloat() { float t; ReadBytes(&t, 4); return t; }
+
+	uint8_t ReadUInt8() { return ReadInt8(); }
+	uint16_t ReadUInt16() { return ReadInt16(); }
+	uint32_t ReadUInt32() { return ReadInt32(); }
+	uint64_t ReadUInt64() { return ReadInt64(); }
+
+	int32_t ReadIndex()
+	{
+		// Decode straight from the buffer when the longest possible index fits
+		if (pos >= bufferStart && pos - bufferStart + 5 <= bufferSize)
+		{
+			const uint8_t* p = bufferData + (pos - bufferStart);
+			uint8_t value = p[0];
+			int32_t index = value & 0x3f;
+			size_t length = 1;
+			if (value & (1 << 6))
+			{
+				int shift = 6;
+				uint8_t next;
+				do
+				{
+					next = p[length++];
+					index |= static_cast<int32_t>(next & 0x7f) << shift;
+					shift += 7;
+				} while ((next & (1 << 7)) && shift < 32);
+			}
+			pos += length;
+			return (value & (1 << 7)) ? -index : index;
+		}
+		return ReadIndexSlow();
+	}
 
-	void ReadBytes(void* d, uint32_t s);
-
-	int8_t ReadInt8();
-	int16_t ReadInt16();
-	int32_t ReadInt32();
-	int64_t ReadInt64();
-	float ReadFloat();
-	uint8_t ReadUInt8();
-	uint16_t ReadUInt16();
-	uint32_t ReadUInt32();
-	uint64_t ReadUInt64();
-	int32_t ReadIndex();
 	std::string ReadString();
 
-	void Seek(uint32_t offset);
-	void Skip(uint32_t bytes);
-	uint32_t Tell();
+	void Seek(uint32_t offset) { pos = offset; }
+	void Skip(uint32_t bytes) { pos += bytes; }
+	uint32_t Tell() { return (uint32_t)pos; }
 
 	Package* GetPackage() const;
 	int GetVersion() const;
 
+	// Returns the mapped file if the package is memory mapped and the range is inside it
+	std::shared_ptr<MappedFile> GetMappedRange(uint32_t offset, uint32_t size) const;
+
 private:
+	void ReadBytesSlow(void* d, uint32_t s);
+	int32_t ReadIndexSlow();
+	void FillBuffer();
+
+	enum { ReadAheadSize = 64 * 1024 };
+
 	Package* package;
 	std::shared_ptr<File> file;
+	std::shared_ptr<MappedFile> mapping;
+	uint64_t fileSize = 0;
+
+	// Window of the file currently in memory. For mapped files this is the entire file.
+	const uint8_t* bufferData = nullptr;
+	size_t bufferStart = 0;
+	size_t bufferSize = 0;
+	Array<uint8_t> readAhead;
+
+	size_t pos = 0;
 };
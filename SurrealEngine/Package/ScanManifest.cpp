@@ -0,0 +1,170 @@
+
+#include "Precomp.h"
+#include "ScanManifest.h"
+#include "Utils/MemoryStreamWriter.h"
+#include "Utils/MemoryStreamReader.h"
+#include "Utils/Logger.h"
+#include "TinySHA1/TinySHA1.hpp"
+
+namespace
+{
+	const uint32_t ManifestSignature = 0x4d534553; // "SESM"
+	const uint32_t ManifestVersion = 2;
+}
+
+ScanManifest::ScanManifest(const std::string& manifestFilename) : manifestFilename(manifestFilename)
+{
+	Load();
+}
+
+ScanManifest::~ScanManifest()
+{
+	Save();
+}
+
+Array<std::string> ScanManifest::GetFiles(const std::string& folder, const std::string& search)
+{
+	FileEntry* entry = nullptr;
+	FileStats stats;
+	if (FindEntry(folders, FilePath::combine(folder, search), entry, stats))
+		return entry->Values;
+
+	// Adding, removing or renaming a file updates the modification time of the folder
+	entry->Stats = stats;
+	entry->Values = Directory::files(FilePath::combine(folder, search));
+	dirty = true;
+	return entry->Values;
+}
+
+std::string ScanManifest::GetFileHash(const std::string& filename)
+{
+	FileEntry* entry = nullptr;
+	FileStats stats;
+	if (FindEntry(hashes, filename, entry, stats))
+		return entry->Values.front();
+
+	auto bytes = File::read_all_bytes(filename);
+
+	sha1::SHA1 s;
+	s.processBytes(bytes.data(), bytes.size());
+	uint32_t digest[5];
+	s.getDigest(digest);
+
+	char temp[41];
+	snprintf(temp, 41, "%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+
+	entry->Stats = stats;
+	entry->Values = { temp };
+	dirty = true;
+	return entry->Values.front();
+}
+
+bool ScanManifest::ReadIntObjects(const std::string& filename, Array<std::string>& values)
+{
+	FileEntry* entry = nullptr;
+	FileStats stats;
+	if (!FindEntry(intFiles, filename, entry, stats))
+		return false;
+	values = entry->Values;
+	return true;
+}
+
+void ScanManifest::StoreIntObjects(const std::string& filename, const Array<std::string>& values)
+{
+	FileEntry& entry = intFiles[filename];
+	File::try_get_stats(filename, entry.Stats);
+	entry.Values = values;
+	dirty = true;
+}
+
+bool ScanManifest::FindEntry(std::map<std::string, FileEntry>& entries, const std::string& filename, FileEntry*& entry, FileStats& stats)
+{
+	// Folder entries are keyed by folder and search pattern, but validated against the folder
+	std::string statFilename = (&entries == &folders) ? FilePath::remove_last_component(filename) : filename;
+
+	auto it = entries.find(filename);
+	bool found = it != entries.end();
+	entry = found ? &it->second : &entries[filename];
+	if (!File::try_get_stats(statFilename, stats))
+		return false;
+	return found && stats.size == entry->Stats.size && stats.modified == entry->Stats.modified;
+}
+
+void ScanManifest::Load()
+{
+	FileStats stats;
+	if (manifestFilename.empty() || !File::try_get_stats(manifestFilename, stats))
+		return;
+
+	try
+	{
+		Array<uint8_t> data = File::read_all_bytes(manifestFilename);
+
+		MemoryStreamReader reader(data.data(), data.size());
+		if (reader.Read<uint32_t>() != ManifestSignature || reader.Read<uint32_t>() != ManifestVersion)
+			throw std::runtime_error("Scan manifest has the wrong version");
+
+		for (std::map<std::string, FileEntry>* entries : { &folders, &hashes, &intFiles })
+		{
+			uint32_t entryCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < entryCount; i++)
+			{
+				std::string filename(reader.ReadString());
+
+				FileEntry entry;
+				entry.Stats.size = reader.Read<uint64_t>();
+				entry.Stats.modified = reader.Read<int64_t>();
+
+				uint32_t valueCount = reader.Read<uint32_t>();
+				entry.Values.reserve(valueCount);
+				for (uint32_t j = 0; j < valueCount; j++)
+					entry.Values.push_back(std::string(reader.ReadString()));
+
+				(*entries)[filename] = std::move(entry);
+			}
+		}
+
+		if (!reader.AtEnd())
+			throw std::runtime_error("Unexpected data at the end of the scan manifest");
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Ignoring scan manifest: ") + e.what());
+		folders.clear();
+		hashes.clear();
+		intFiles.clear();
+	}
+}
+
+void ScanManifest::Save()
+{
+	if (!dirty || manifestFilename.empty())
+		return;
+
+	MemoryStreamWriter writer;
+	writer << ManifestSignature;
+	writer << ManifestVersion;
+	for (std::map<std::string, FileEntry>* entries : { &folders, &hashes, &intFiles })
+	{
+		writer << (uint32_t)entries->size();
+		for (auto& it : *entries)
+		{
+			writer.WriteString(it.first);
+			writer << it.second.Stats.size;
+			writer << it.second.Stats.modified;
+			writer << (uint32_t)it.second.Values.size();
+			for (const std::string& value : it.second.Values)
+				writer.WriteString(value);
+		}
+	}
+
+	try
+	{
+		File::write_all_bytes(manifestFilename, writer.Data(), writer.Size());
+		dirty = false;
+	}
+	catch (const std::exception& e)
+	{
+		LogMessage(std::string("Could not save scan manifest: ") + e.what());
+	}
+}
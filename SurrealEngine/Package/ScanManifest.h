@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Utils/File.h"
+#include <map>
+
+// Results of the file system scans done at startup, kept on disk between sessions.
+// Directory listings are reused until the modification time of the directory changes. Per file results are reused while
+// the size and modification time of the file match. Nothing is saved if the manifest filename is empty.
+class ScanManifest
+{
+public:
+	ScanManifest(const std::string& manifestFilename);
+	~ScanManifest();
+
+	// Same as Directory::files
+	Array<std::string> GetFiles(const std::string& folder, const std::string& search);
+
+	// SHA1 of the file contents as a hex string
+	std::string GetFileHash(const std::string& filename);
+
+	// Public Object= values of an .int file
+	bool ReadIntObjects(const std::string& filename, Array<std::string>& values);
+	void StoreIntObjects(const std::string& filename, const Array<std::string>& values);
+
+	void Save();
+
+	// Forget the changes made since the last save, so the destructor does not write them
+	void Discard() { dirty = false; }
+
+private:
+	void Load();
+
+	struct FileEntry
+	{
+		FileStats Stats;
+		Array<std::string> Values;
+	};
+
+	bool FindEntry(std::map<std::string, FileEntry>& entries, const std::string& filename, FileEntry*& entry, FileStats& stats);
+
+	std::string manifestFilename;
+	bool dirty = false;
+
+	std::map<std::string, FileEntry> folders;
+	std::map<std::string, FileEntry> hashes;
+	std::map<std::string, FileEntry> intFiles;
+};
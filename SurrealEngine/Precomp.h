@@ -5,6 +5,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <utility>
 #include "Utils/Array.h"
 #include "Utils/Exception.h"
 
@@ -8,6 +8,27 @@
 #include "Engine.h"
 
 void RenderSubsystem::ResetCanvas()
+{
+	SetupCanvasFrame();
+
+	int sizeX = (int)(engine->ViewportWidth / (float)Canvas.uiscale);
+	int sizeY = (int)(engine->ViewportHeight / (float)Canvas.uiscale);
+	engine->canvas->CurX() = 0.0f;
+	engine->canvas->CurY() = 0.0f;
+	engine->console->FrameX() = (float)sizeX;
+	engine->console->FrameY() = (float)sizeY;
+	engine->canvas->ClipX() = (float)sizeX;
+	engine->canvas->ClipY() = (float)sizeY;
+	engine->canvas->SizeX() = sizeX;
+	engine->canvas->SizeY() = sizeY;
+	//engine->viewport->bShowWindowsMouse() = true; // bShowWindowsMouse is set to true by WindowConsole if mouse cursor should be visible
+	//engine->viewport->bWindowsMouseAvailable() = true; // if true then RenderUWindow updates mouse pos from (WindowsMouseX,WindowsMouseY), otherwise it uses KeyEvent(IK_MouseX, delta) + KeyEvent(IK_MouseY, delta). Maybe used for windowed mode?
+	//engine->viewport->WindowsMouseX() = 10.0f;
+	//engine->viewport->WindowsMouseY() = 200.0f;
+	CallEvent(engine->canvas, EventName::Reset);
+}
+
+void RenderSubsystem::SetupCanvasFrame()
 {
 	Canvas.uiscale = std::max((engine->ViewportHeight + 540) / 1080, 1);
 
@@ -28,22 +49,6 @@ void RenderSubsystem::ResetCanvas()
 	float RFX2 = 2.0f * RProjZ / Canvas.Frame.FX;
 	float RFY2 = 2.0f * RProjZ * Aspect / Canvas.Frame.FY;
 	Canvas.Frame.Projection = mat4::frustum(-RProjZ, RProjZ, -Aspect * RProjZ, Aspect * RProjZ, 1.0f, 32768.0f, handedness::left, clipzrange::zero_positive_w);
-
-	int sizeX = (int)(engine->ViewportWidth / (float)Canvas.uiscale);
-	int sizeY = (int)(engine->ViewportHeight / (float)Canvas.uiscale);
-	engine->canvas->CurX() = 0.0f;
-	engine->canvas->CurY() = 0.0f;
-	engine->console->FrameX() = (float)sizeX;
-	engine->console->FrameY() = (float)sizeY;
-	engine->canvas->ClipX() = (float)sizeX;
-	engine->canvas->ClipY() = (float)sizeY;
-	engine->canvas->SizeX() = sizeX;
-	engine->canvas->SizeY() = sizeY;
-	//engine->viewport->bShowWindowsMouse() = true; // bShowWindowsMouse is set to true by WindowConsole if mouse cursor should be visible
-	//engine->viewport->bWindowsMouseAvailable() = true; // if true then RenderUWindow updates mouse pos from (WindowsMouseX,WindowsMouseY), otherwise it uses KeyEvent(IK_MouseX, delta) + KeyEvent(IK_MouseY, delta). Maybe used for windowed mode?
-	//engine->viewport->WindowsMouseX() = 10.0f;
-	//engine->viewport->WindowsMouseY() = 200.0f;
-	CallEvent(engine->canvas, EventName::Reset);
 }
 
 void RenderSubsystem::PreRender()
@@ -152,6 +152,7 @@ void RenderSubsystem::UpdateActorLightList(UActor* actor)
 	if (actor->bUnlit())
 		return;
 
+	Array<UActor*>& lightList = actor->LightInfo.LightList;
 	for (UActor* light : Light.Lights)
 	{
 		if (light && !light->bCorona() && !light->bSpecialLit())
@@ -162,12 +163,12 @@ void RenderSubsystem::UpdateActorLightList(UActor* actor)
 			{
 				L.z = 0.0f;
 			}
-			if (dot(L, L) < radius * radius && !engine->Level->TraceRayAnyHit(light->Location(), location, nullptr, false, true, true))
-			{
-				actor->LightInfo.LightList.push_back(light);
-			}
+			if (dot(L, L) < radius * radius)
+				lightList.push_back(light);
 		}
 	}
+
+	engine->Level->RemoveOccludedActors(lightList, location, true, nullptr, true);
 }
 
 vec3 RenderSubsystem::GetVertexLight(UActor* actor, const vec3& location, const vec3& normal, bool unlit)
@@ -17,7 +17,7 @@ void RenderSubsystem::DrawSprite(FSceneNode* frame, UActor* actor)
 
 	if (actor->DrawType() == DT_SpriteAnimOnce)
 	{
-		float t = (1.0f - actor->LifeSpan() / actor->Class->GetDefaultObject<UActor>()->LifeSpan());
+		float t = (1.0f - actor->LifeSpan() / std::as_const(*actor->Class->GetDefaultObject<UActor>()).LifeSpan());
 		int count = texture->GetAnimTextureCount();
 		int index = (int)std::floor(clamp(t, 0.0f, 1.0f) * count);
 		for (int i = 0; i < index; i++)
@@ -13,6 +13,13 @@ RenderSubsystem::RenderSubsystem(RenderDevice* renderdevice) : Device(renderdevi
 
 void RenderSubsystem::DrawGame(float levelTimeElapsed)
 {
+	if (engine->LoadingMap)
+	{
+		// Script objects may be half loaded, so only draw what the engine itself knows about
+		DrawLoadingScreen(engine->LoadingProgress);
+		return;
+	}
+
 	FrameCounter++;
 	LevelTimeElapsed = levelTimeElapsed;
 	AutoUV += levelTimeElapsed * 64.0f;
@@ -30,6 +37,7 @@ void RenderSubsystem::DrawGame(float levelTimeElapsed)
 	}
 
 	Device->Brightness = engine->client->Brightness;
+	Device->TextureMemoryBudget = engine->renderdev->TextureMemoryBudget;
 	Device->Lock(vec4(flashScale, 1.0f), vec4(flashFog, 1.0f), vec4(0.0f));
 
 	ResetCanvas();
@@ -45,6 +53,27 @@ void RenderSubsystem::DrawGame(float levelTimeElapsed)
 	PostRender();
 
 	Device->Unlock(true);
+
+	// The frame's uploads have been copied out of the mip data by now
+	UTexture::EvictMips((uint64_t)std::max(engine->renderdev->TextureCpuMemoryBudget, 16) * 1024 * 1024);
+}
+
+void RenderSubsystem::DrawLoadingScreen(float progress)
+{
+	Device->Brightness = engine->client->Brightness;
+	Device->Lock(vec4(0.5f, 0.5f, 0.5f, 1.0f), vec4(0.0f, 0.0f, 0.0f, 1.0f), vec4(0.0f));
+
+	SetupCanvasFrame();
+	Device->SetSceneNode(&Canvas.Frame);
+
+	float width = Canvas.Frame.FX * 0.5f;
+	float height = 8.0f * Canvas.uiscale;
+	float x = (Canvas.Frame.FX - width) * 0.5f;
+	float y = Canvas.Frame.FY * 0.75f;
+	Device->Draw2DPoint(&Canvas.Frame, vec4(0.2f, 0.2f, 0.2f, 1.0f), x, y, x + width, y + height, 1.0f);
+	Device->Draw2DPoint(&Canvas.Frame, vec4(0.9f, 0.9f, 0.9f, 1.0f), x, y, x + width * clamp(progress, 0.0f, 1.0f), y + height, 1.0f);
+
+	Device->Unlock(true);
 }
 
 void RenderSubsystem::DrawEditorViewport()
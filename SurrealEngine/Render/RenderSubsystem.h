@@ -31,6 +31,7 @@ public:
 	void DrawEditorViewport();
 
 	void DrawGame(float levelTimeElapsed);
+	void DrawLoadingScreen(float progress);
 	void OnMapLoaded();
 
 	void DrawActor(UActor* actor, bool WireFrame, bool ClearZ);
@@ -71,6 +72,7 @@ private:
 	void UpdateFogmapTexture(const LightMapIndex& lmindex, uint32_t* texels, const BspSurface& surface, UZoneInfo* zoneActor, UModel* model);
 
 	void ResetCanvas();
+	void SetupCanvasFrame();
 	void PreRender();
 	void RenderOverlays();
 	void PostRender();
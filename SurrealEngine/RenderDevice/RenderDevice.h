@@ -118,6 +118,7 @@ public:
 	Widget* Viewport = nullptr;
 	bool PrecacheOnFlip = false;
 	float Brightness = 0.5f;
+	int TextureMemoryBudget = 1024; // In megabytes
 };
 
 class RenderDeviceTexture : public CanvasTexture
@@ -10,4 +10,15 @@ public:
 
 	int BindlessIndex[4] = { -1, -1, -1, -1 };
 	int RealtimeChangeCount = 0;
+
+	// Residency
+	uint64_t CacheID = 0;
+	bool Masked = false;
+	int FirstMip = 0; // Finest mip level in the image
+	uint64_t MemorySize = 0;
+	uint64_t LastUsedFrame = 0;
+	bool DetailRequested = false;
+	int RequestedMip = 0; // Finest mip level asked for by the draws of the current frame
+	bool Upgrade = false; // Upload the mip chain from UpgradeMip the next time the texture is used
+	int UpgradeMip = 0;
 };
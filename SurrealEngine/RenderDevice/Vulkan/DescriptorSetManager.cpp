@@ -30,6 +30,7 @@ VulkanDescriptorSet* DescriptorSetManager::GetTextureDescriptorSet(uint32_t Poly
 		if (SceneDescriptorPoolSetsLeft == 0)
 		{
 			SceneDescriptorPool.push_back(DescriptorPoolBuilder()
+				.Flags(VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT)
 				.AddPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1000 * 4)
 				.MaxSets(1000)
 				.DebugName("SceneDescriptorPool")
@@ -65,6 +66,73 @@ void DescriptorSetManager::ClearCache()
 
 	WriteBindless = WriteDescriptors();
 	NextBindlessIndex = 0;
+	FreeBindlessIndices.clear();
+	RemovedBindlessIndices.clear();
+}
+
+void DescriptorSetManager::RemoveTextures(const std::unordered_set<CachedTexture*>& textures)
+{
+	for (auto it = TextureDescriptorSets.begin(); it != TextureDescriptorSets.end();)
+	{
+		const TexDescriptorKey& key = it->first;
+		if (textures.count(key.tex) || textures.count(key.lightmap) || textures.count(key.detailtex) || textures.count(key.macrotex))
+		{
+			renderer->Commands->FrameDeleteList->descriptors.push_back(std::move(it->second));
+			it = TextureDescriptorSets.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	for (CachedTexture* tex : textures)
+	{
+		for (int& index : tex->BindlessIndex)
+		{
+			if (index != -1)
+			{
+				RemovedBindlessIndices.push_back(index);
+				index = -1;
+			}
+		}
+	}
+}
+
+void DescriptorSetManager::RecycleBindlessIndices()
+{
+	for (int index : RemovedBindlessIndices)
+		FreeBindlessIndices.push_back(index);
+	RemovedBindlessIndices.clear();
+}
+
+void DescriptorSetManager::TextureReplaced(CachedTexture* tex)
+{
+	// The old descriptor sets may have been bound earlier in this frame
+	for (auto it = TextureDescriptorSets.begin(); it != TextureDescriptorSets.end();)
+	{
+		const TexDescriptorKey& key = it->first;
+		if (key.tex == tex || key.lightmap == tex || key.detailtex == tex || key.macrotex == tex)
+		{
+			renderer->Commands->FrameDeleteList->descriptors.push_back(std::move(it->second));
+			it = TextureDescriptorSets.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	// Bindless descriptors are written just before the frame is submitted, so the whole frame sees the new image
+	for (int samplermode = 0; samplermode < 4; samplermode++)
+	{
+		int index = tex->BindlessIndex[samplermode];
+		if (index != -1)
+		{
+			VulkanSampler* sampler = renderer->Samplers->Samplers[samplermode].get();
+			WriteBindless.AddCombinedImageSampler(SceneBindlessDescriptorSet.get(), 0, index, tex->imageView.get(), sampler, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		}
+	}
 }
 
 int DescriptorSetManager::GetTextureArrayIndex(uint32_t PolyFlags, CachedTexture* tex, bool clamp)
@@ -80,7 +148,15 @@ int DescriptorSetManager::GetTextureArrayIndex(uint32_t PolyFlags, CachedTexture
 	if (index != -1)
 		return index;
 
-	index = NextBindlessIndex++;
+	if (!FreeBindlessIndices.empty())
+	{
+		index = FreeBindlessIndices.back();
+		FreeBindlessIndices.pop_back();
+	}
+	else
+	{
+		index = NextBindlessIndex++;
+	}
 
 	VulkanSampler* sampler = renderer->Samplers->Samplers[samplermode].get();
 	WriteBindless.AddCombinedImageSampler(SceneBindlessDescriptorSet.get(), 0, index, tex->imageView.get(), sampler, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
@@ -3,6 +3,7 @@
 #include <zvulkan/vulkanobjects.h>
 #include <zvulkan/vulkanbuilders.h>
 #include <unordered_map>
+#include <unordered_set>
 
 class VulkanRenderDevice;
 class CachedTexture;
@@ -54,6 +55,15 @@ public:
 	VulkanDescriptorSet* GetTextureDescriptorSet(uint32_t PolyFlags, CachedTexture* tex, CachedTexture* lightmap = nullptr, CachedTexture* macrotex = nullptr, CachedTexture* detailtex = nullptr, bool clamp = false);
 	void ClearCache();
 
+	// Drops descriptors referencing the textures. They are destroyed with the frame, and their bindless slots are reused after RecycleBindlessIndices.
+	void RemoveTextures(const std::unordered_set<CachedTexture*>& textures);
+
+	// Makes the bindless slots of removed textures available again. Called once the frame that could still use them has finished.
+	void RecycleBindlessIndices();
+
+	// Points descriptors referencing the texture at its new image view
+	void TextureReplaced(CachedTexture* tex);
+
 	int GetTextureArrayIndex(uint32_t PolyFlags, CachedTexture* tex, bool clamp = false);
 	VulkanDescriptorSet* GetBindlessDescriptorSet() { return SceneBindlessDescriptorSet.get(); }
 	void UpdateBindlessDescriptorSet();
@@ -78,6 +88,8 @@ private:
 	std::unique_ptr<VulkanDescriptorSet> SceneBindlessDescriptorSet;
 	WriteDescriptors WriteBindless;
 	int NextBindlessIndex = 0;
+	Array<int> FreeBindlessIndices;
+	Array<int> RemovedBindlessIndices;
 
 	Array<std::unique_ptr<VulkanDescriptorPool>> SceneDescriptorPool;
 	int SceneDescriptorPoolSetsLeft = 0;
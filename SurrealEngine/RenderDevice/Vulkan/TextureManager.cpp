@@ -5,6 +5,8 @@
 #include "CachedTexture.h"
 #include <zvulkan/vulkanbuilders.h>
 #include "UObject/UTexture.h"
+#include <unordered_set>
+#include <cmath>
 
 TextureManager::TextureManager(VulkanRenderDevice* renderer) : renderer(renderer)
 {
@@ -19,11 +21,20 @@ TextureManager::~TextureManager()
 void TextureManager::UpdateTextureRect(FTextureInfo* info, int x, int y, int w, int h)
 {
 	std::unique_ptr<CachedTexture>& tex = TextureCache[0][info->CacheID];
-	if (tex)
+	if (!tex)
+		return;
+
+	if (tex->FirstMip == 0)
 	{
 		renderer->Uploads->UploadTextureRect(tex.get(), *info, x, y, w, h);
 		info->bRealtimeChanged = 0;
 	}
+	else
+	{
+		// The rect is in the top mip level, which the image does not have. Upload the full mip chain on the next use instead.
+		tex->Upgrade = true;
+		tex->UpgradeMip = 0;
+	}
 }
 
 CachedTexture* TextureManager::GetTexture(FTextureInfo* info, bool masked)
@@ -35,7 +46,24 @@ CachedTexture* TextureManager::GetTexture(FTextureInfo* info, bool masked)
 	if (!tex)
 	{
 		tex.reset(new CachedTexture());
+		tex->CacheID = info->CacheID;
+		tex->Masked = masked;
+		tex->FirstMip = GetStreamingFirstMip(*info);
+		renderer->Uploads->UploadTexture(tex.get(), *info, masked);
+		MemoryUsage += tex->MemorySize;
+	}
+	else if (tex->Upgrade)
+	{
+		// Replace the image with one holding the finer mip levels. The old one may already be in use by this frame.
+		tex->Upgrade = false;
+		tex->FirstMip = tex->UpgradeMip;
+		MemoryUsage -= tex->MemorySize;
+		renderer->Commands->FrameDeleteList->images.push_back(std::move(tex->image));
+		renderer->Commands->FrameDeleteList->imageViews.push_back(std::move(tex->imageView));
+		info->bRealtimeChanged = 0;
 		renderer->Uploads->UploadTexture(tex.get(), *info, masked);
+		renderer->DescriptorSets->TextureReplaced(tex.get());
+		MemoryUsage += tex->MemorySize;
 	}
 	else if (info->bRealtimeChanged /*&& (!info->Texture || info->Texture->RealtimeChangeCount != tex->RealtimeChangeCount)*/)
 	{
@@ -44,15 +72,129 @@ CachedTexture* TextureManager::GetTexture(FTextureInfo* info, bool masked)
 		info->bRealtimeChanged = 0;
 		renderer->Uploads->UploadTexture(tex.get(), *info, masked);
 	}
+	tex->LastUsedFrame = FrameNumber;
 	return tex.get();
 }
 
+void TextureManager::RequestDetail(CachedTexture* tex, int mip)
+{
+	if (!tex || mip >= tex->FirstMip || tex->Upgrade)
+		return;
+
+	if (!tex->DetailRequested)
+	{
+		tex->DetailRequested = true;
+		tex->RequestedMip = mip;
+		DetailRequests.push_back(tex);
+	}
+	else
+	{
+		tex->RequestedMip = std::min(tex->RequestedMip, mip);
+	}
+}
+
+int TextureManager::GetDesiredMip(float texelArea, float screenArea)
+{
+	if (screenArea < 0.0f)
+		return 0;
+	if (screenArea == 0.0f)
+		return 31; // Edge on or off screen
+
+	// Each mip level has a quarter of the texels of the one above it. The sampler picks the level where a texel covers about one pixel.
+	float texelsPerPixel = texelArea / screenArea;
+	if (texelsPerPixel < 4.0f)
+		return 0;
+	return (int)(0.5f * std::log2(texelsPerPixel));
+}
+
+void TextureManager::UpdateResidency()
+{
+	uint64_t budget = (uint64_t)std::max(renderer->TextureMemoryBudget, 16) * 1024 * 1024;
+
+	// Evicted textures are no longer referenced by the frame that was just submitted
+	renderer->DescriptorSets->RecycleBindlessIndices();
+
+	// Stream in the most wanted detail first, limited per frame to avoid hitches. Each dropped mip level is a quarter of the size of the one above it.
+	std::sort(DetailRequests.begin(), DetailRequests.end(), [](CachedTexture* a, CachedTexture* b) { return a->FirstMip - a->RequestedMip > b->FirstMip - b->RequestedMip; });
+	uint64_t upgradeBytes = 0;
+	for (CachedTexture* tex : DetailRequests)
+	{
+		tex->DetailRequested = false;
+		if (tex->Upgrade) // Already getting its full mip chain from UpdateTextureRect
+			continue;
+		uint64_t newSize = tex->MemorySize << (2 * (tex->FirstMip - tex->RequestedMip));
+		if ((upgradeBytes == 0 || upgradeBytes + newSize <= MaxUpgradeBytesPerFrame) && MemoryUsage - tex->MemorySize + newSize <= budget)
+		{
+			tex->Upgrade = true;
+			tex->UpgradeMip = tex->RequestedMip;
+			upgradeBytes += newSize;
+		}
+	}
+	DetailRequests.clear();
+
+	if (MemoryUsage > budget)
+		EvictTextures((uint64_t)(budget * EvictionTarget));
+
+	FrameNumber++;
+}
+
+void TextureManager::EvictTextures(uint64_t target)
+{
+	// Textures used by the current frame are never evicted
+	Array<CachedTexture*> candidates;
+	for (auto& cache : TextureCache)
+	{
+		for (auto& it : cache)
+		{
+			if (it.second && it.second->LastUsedFrame < FrameNumber)
+				candidates.push_back(it.second.get());
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [](CachedTexture* a, CachedTexture* b) { return a->LastUsedFrame < b->LastUsedFrame; });
+
+	// Stop at the recently used textures unless the budget cannot be met otherwise. Evicting textures that are still in view only makes them come straight back.
+	std::unordered_set<CachedTexture*> evicted;
+	for (CachedTexture* tex : candidates)
+	{
+		if (MemoryUsage <= target || (tex->LastUsedFrame + EvictionMinAge > FrameNumber && MemoryUsage <= target / EvictionTarget))
+			break;
+		MemoryUsage -= tex->MemorySize;
+		evicted.insert(tex);
+	}
+
+	if (evicted.empty())
+		return;
+
+	// The images are destroyed once the GPU is done with the frame that may still reference them
+	renderer->DescriptorSets->RemoveTextures(evicted);
+	for (CachedTexture* tex : evicted)
+	{
+		auto& cache = TextureCache[(int)tex->Masked];
+		auto it = cache.find(tex->CacheID);
+		renderer->Commands->FrameDeleteList->images.push_back(std::move(it->second->image));
+		renderer->Commands->FrameDeleteList->imageViews.push_back(std::move(it->second->imageView));
+		cache.erase(it);
+	}
+}
+
+int TextureManager::GetStreamingFirstMip(const FTextureInfo& info)
+{
+	// Textures updated in place (such as fire textures) have a single mip level and are never streamed
+	int firstMip = 0;
+	while (firstMip + 1 < info.NumMips && (info.Mips[firstMip].Width > StreamingMipSize || info.Mips[firstMip].Height > StreamingMipSize) && info.Mips[firstMip + 1].HasData())
+		firstMip++;
+	return firstMip;
+}
+
 void TextureManager::ClearCache()
 {
 	for (auto& cache : TextureCache)
 	{
 		cache.clear();
 	}
+	DetailRequests.clear();
+	MemoryUsage = 0;
 }
 
 void TextureManager::CreateNullTexture()
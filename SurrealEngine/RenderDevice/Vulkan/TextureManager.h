@@ -17,6 +17,16 @@ public:
 	void UpdateTextureRect(FTextureInfo* info, int x, int y, int w, int h);
 	CachedTexture* GetTexture(FTextureInfo* info, bool masked);
 
+	// Ask for the mip levels down to the given one for a texture that was uploaded with only its coarser ones
+	void RequestDetail(CachedTexture* tex, int mip);
+
+	// Finest mip level needed to draw something covering texelArea texels of the top mip level over screenArea pixels.
+	// A negative screen area means the size on screen is unknown and the full mip chain is needed.
+	static int GetDesiredMip(float texelArea, float screenArea);
+
+	// Streams in requested detail and evicts the least recently used textures past the memory budget. Called after each frame.
+	void UpdateResidency();
+
 	void ClearCache();
 
 	std::unique_ptr<VulkanImage> NullTexture;
@@ -28,11 +38,29 @@ public:
 	std::unique_ptr<SceneTextures> Scene;
 
 	int GetTexturesInCache() { return (int)(TextureCache[0].size() + TextureCache[1].size()); }
+	uint64_t GetMemoryUsage() const { return MemoryUsage; }
+
+	// Textures larger than this are first uploaded without their finest mip levels
+	static const int StreamingMipSize = 256;
+
+	// Limits how much texture data is streamed in after each frame, so that detail arrives over several frames instead of in one hitch
+	static const uint64_t MaxUpgradeBytesPerFrame = 16 * 1024 * 1024;
+
+	// Eviction starts when the budget is exceeded and continues until usage is below this fraction of it, so it does not run every frame
+	static constexpr float EvictionTarget = 0.875f;
+
+	// Textures drawn within this many frames are only evicted if nothing older is left
+	static const uint64_t EvictionMinAge = 30;
 
 private:
 	void CreateNullTexture();
 	void CreateDitherTexture();
+	void EvictTextures(uint64_t target);
+	static int GetStreamingFirstMip(const FTextureInfo& info);
 
 	VulkanRenderDevice* renderer = nullptr;
 	std::unordered_map<uint64_t, std::unique_ptr<CachedTexture>> TextureCache[2];
+	Array<CachedTexture*> DetailRequests;
+	uint64_t MemoryUsage = 0;
+	uint64_t FrameNumber = 1;
 };
@@ -21,9 +21,13 @@ bool UploadManager::SupportsTextureFormat(TextureFormat Format) const
 
 void UploadManager::UploadTexture(CachedTexture* tex, const FTextureInfo& Info, bool masked)
 {
-	int width = Info.USize;
-	int height = Info.VSize;
-	int mipcount = Info.NumMips;
+	int firstMip = std::max(std::min(tex->FirstMip, Info.NumMips - 1), 0);
+	int width = firstMip > 0 ? Info.Mips[firstMip].Width : Info.USize;
+	int height = firstMip > 0 ? Info.Mips[firstMip].Height : Info.VSize;
+	int mipcount = Info.NumMips - firstMip;
+
+	if (Info.Texture)
+		Info.Texture->LoadMips(firstMip);
 
 	TextureUploader* uploader = TextureUploader::GetUploader(Info.Format);
 
@@ -34,8 +38,10 @@ void UploadManager::UploadTexture(CachedTexture* tex, const FTextureInfo& Info,
 		width = 1;
 		height = 1;
 		mipcount = 1;
+		firstMip = 0;
 		uploader = nullptr;
 	}
+	tex->FirstMip = firstMip;
 
 	VkFormat format = uploader ? uploader->GetVkFormat() : VK_FORMAT_R8G8B8A8_UNORM;
 
@@ -55,13 +61,16 @@ void UploadManager::UploadTexture(CachedTexture* tex, const FTextureInfo& Info,
 	}
 
 	if (uploader)
-		UploadData(tex->image->image, Info, masked, uploader);
+		tex->MemorySize = UploadData(tex->image->image, Info, masked, uploader, firstMip);
 	else
-		UploadWhite(tex->image->image);
+		tex->MemorySize = UploadWhite(tex->image->image);
 }
 
 void UploadManager::UploadTextureRect(CachedTexture* tex, const FTextureInfo& Info, int x, int y, int w, int h)
 {
+	if (Info.Texture)
+		Info.Texture->LoadMips(0);
+
 	TextureUploader* uploader = TextureUploader::GetUploader(Info.Format);
 	if (!uploader || Info.NumMips < 1 || x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > Info.Mips[0].Width || y + h > Info.Mips[0].Height || Info.Mips[0].Data.empty())
 		return;
@@ -87,10 +96,10 @@ void UploadManager::UploadTextureRect(CachedTexture* tex, const FTextureInfo& In
 	UploadBufferPos += pixelsSize;
 }
 
-void UploadManager::UploadData(VkImage image, const FTextureInfo& Info, bool masked, TextureUploader* uploader)
+int UploadManager::UploadData(VkImage image, const FTextureInfo& Info, bool masked, TextureUploader* uploader, int firstMip)
 {
 	int pixelsSize = 0;
-	for (int level = 0; level < Info.NumMips; level++)
+	for (int level = firstMip; level < Info.NumMips; level++)
 	{
 		UnrealMipmap* Mip = &Info.Mips[level];
 		if (!Mip->Data.empty())
@@ -108,7 +117,7 @@ void UploadManager::UploadData(VkImage image, const FTextureInfo& Info, bool mas
 	upload.Index = (int)ImageCopies.size();
 	upload.Count = 0;
 
-	for (int level = 0; level < Info.NumMips; level++)
+	for (int level = firstMip; level < Info.NumMips; level++)
 	{
 		UnrealMipmap* Mip = &Info.Mips[level];
 		if (!Mip->Data.empty())
@@ -119,7 +128,7 @@ void UploadManager::UploadData(VkImage image, const FTextureInfo& Info, bool mas
 			VkBufferImageCopy region = {};
 			region.bufferOffset = UploadBufferPos;
 			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			region.imageSubresource.mipLevel = level;
+			region.imageSubresource.mipLevel = level - firstMip;
 			region.imageSubresource.layerCount = 1;
 			region.imageOffset = { 0, 0, 0 };
 			region.imageExtent = { mipwidth, mipheight, 1 };
@@ -135,9 +144,10 @@ void UploadManager::UploadData(VkImage image, const FTextureInfo& Info, bool mas
 	}
 
 	Uploads.push_back(upload);
+	return pixelsSize;
 }
 
-void UploadManager::UploadWhite(VkImage image)
+int UploadManager::UploadWhite(VkImage image)
 {
 	WaitIfUploadBufferIsFull(16);
 
@@ -158,6 +168,7 @@ void UploadManager::UploadWhite(VkImage image)
 	Uploads.push_back(upload);
 	ImageCopies.push_back(region);
 	UploadBufferPos += 16; // 16-byte aligned
+	return 4;
 }
 
 void UploadManager::WaitIfUploadBufferIsFull(int bytes)
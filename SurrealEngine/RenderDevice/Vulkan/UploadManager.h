@@ -21,8 +21,9 @@ public:
 	void SubmitUploads();
 
 private:
-	void UploadData(VkImage image, const FTextureInfo& Info, bool masked, TextureUploader* uploader);
-	void UploadWhite(VkImage image);
+	// Returns the number of bytes uploaded
+	int UploadData(VkImage image, const FTextureInfo& Info, bool masked, TextureUploader* uploader, int firstMip);
+	int UploadWhite(VkImage image);
 	void WaitIfUploadBufferIsFull(int bytes);
 
 	VulkanRenderDevice* renderer = nullptr;
@@ -385,6 +385,7 @@ void VulkanRenderDevice::Unlock(bool Blit)
 
 	BlitSceneToPostprocess();
 	SubmitAndWait(Blit, Viewport->GetNativePixelWidth(), Viewport->GetNativePixelHeight());
+	Textures->UpdateResidency();
 
 	IsLocked = false;
 }
@@ -415,6 +416,50 @@ void VulkanRenderDevice::DrawBatch(VulkanCommandBuffer* cmdbuffer)
 	}
 }
 
+float VulkanRenderDevice::GetScreenArea(const SceneVertex* vertices, uint32_t count) const
+{
+	// Shoelace formula on the projected polygon. Polygons crossing the near plane have no meaningful screen size.
+	float halfWidth = CurrentFrame->X * 0.5f;
+	float halfHeight = CurrentFrame->Y * 0.5f;
+	vec2 first, prev;
+	float area = 0.0f;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		vec4 clip = pushconstants.objectToProjection * vec4(vertices[i].Position, 1.0f);
+		if (clip.w < 1.0f)
+			return -1.0f;
+		vec2 pos(clip.x / clip.w * halfWidth, clip.y / clip.w * halfHeight);
+		if (i == 0)
+			first = pos;
+		else
+			area += prev.x * pos.y - pos.x * prev.y;
+		prev = pos;
+	}
+	area += prev.x * first.y - first.x * prev.y;
+	return std::abs(area) * 0.5f;
+}
+
+void VulkanRenderDevice::RequestDetail(CachedTexture* tex, const FTextureInfo* info, const SceneVertex* vertices, uint32_t count, vec2 SceneVertex::* texcoord, float screenArea)
+{
+	if (!tex || tex->FirstMip == 0)
+		return;
+
+	// Texture coordinates are normalized, so the area is scaled up to texels of the top mip level
+	vec2 first = vertices[0].*texcoord;
+	vec2 prev = first;
+	float area = 0.0f;
+	for (uint32_t i = 1; i < count; i++)
+	{
+		vec2 uv = vertices[i].*texcoord;
+		area += prev.x * uv.y - uv.x * prev.y;
+		prev = uv;
+	}
+	area += prev.x * first.y - first.x * prev.y;
+	float texelArea = std::abs(area) * 0.5f * info->USize * info->VSize;
+
+	Textures->RequestDetail(tex, TextureManager::GetDesiredMip(texelArea, screenArea));
+}
+
 void VulkanRenderDevice::DrawComplexSurface(FSceneNode* Frame, FSurfaceInfo& Surface, FSurfaceFacet& Facet)
 {
 	CachedTexture* tex = Textures->GetTexture(Surface.Texture, !!(Surface.PolyFlags & PF_Masked));
@@ -527,6 +572,17 @@ void VulkanRenderDevice::DrawComplexSurface(FSceneNode* Frame, FSurfaceInfo& Sur
 		*(iptr++) = i;
 	}
 
+	const SceneVertex* vertices = Buffers->SceneVertices + vpos;
+	bool streamDetail = !fogmap && detailtex && detailtex->FirstMip > 0;
+	if ((tex && tex->FirstMip > 0) || (macrotex && macrotex->FirstMip > 0) || streamDetail)
+	{
+		float screenArea = GetScreenArea(vertices, vcount);
+		RequestDetail(tex, Surface.Texture, vertices, vcount, &SceneVertex::TexCoord, screenArea);
+		RequestDetail(macrotex, Surface.MacroTexture, vertices, vcount, &SceneVertex::TexCoord3, screenArea);
+		if (streamDetail)
+			RequestDetail(detailtex, Surface.DetailTexture, vertices, vcount, &SceneVertex::TexCoord4, screenArea);
+	}
+
 	vpos += vcount;
 	icount += (vcount - 2) * 3;
 
@@ -623,6 +679,12 @@ void VulkanRenderDevice::DrawGouraudPolygon(FSceneNode* Frame, FTextureInfo& Inf
 	uint32_t istart = SceneIndexPos;
 	uint32_t icount = (vcount - 2) * 3;
 
+	if (tex && tex->FirstMip > 0)
+	{
+		const SceneVertex* vertices = Buffers->SceneVertices + vstart;
+		RequestDetail(tex, &Info, vertices, vcount, &SceneVertex::TexCoord, GetScreenArea(vertices, vcount));
+	}
+
 	uint32_t* iptr = Buffers->SceneIndexes + istart;
 	for (uint32_t i = vstart + 2; i < vstart + vcount; i++)
 	{
@@ -654,6 +716,10 @@ void VulkanRenderDevice::DrawTile(FSceneNode* Frame, FTextureInfo& Info, float X
 
 	CachedTexture* tex = Textures->GetTexture(&Info, !!(PolyFlags & PF_Masked));
 
+	// Only stream in finer mips if the tile is drawn larger than the mips already uploaded
+	if (tex && tex->FirstMip > 0)
+		Textures->RequestDetail(tex, TextureManager::GetDesiredMip(std::abs(UL * VL), std::abs(XL * YL)));
+
 	SetPipeline(RenderPasses->getPipeline(PolyFlags, UsesBindless));
 
 	ivec4 textureBinds;
@@ -97,6 +97,10 @@ private:
 	void SetPipeline(VulkanPipeline* pipeline);
 	void SetDescriptorSet(VulkanDescriptorSet* descriptorSet, bool bindless);
 	void DrawBatch(VulkanCommandBuffer* cmdbuffer);
+
+	// Texture streaming. Asks for the mip levels a polygon needs from the texels it covers compared to its size on screen.
+	float GetScreenArea(const SceneVertex* vertices, uint32_t count) const;
+	void RequestDetail(CachedTexture* tex, const FTextureInfo* info, const SceneVertex* vertices, uint32_t count, vec2 SceneVertex::* texcoord, float screenArea);
 	void SubmitAndWait(bool present, int presentWidth, int presentHeight);
 
 	struct
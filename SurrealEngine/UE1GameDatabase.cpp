@@ -1,7 +1,7 @@
 #include "UE1GameDatabase.h"
 
 #include "Utils/File.h"
-#include "TinySHA1/TinySHA1.hpp"
+#include "Package/ScanManifest.h"
 #include <filesystem>
 
 std::pair<KnownUE1Games, std::string> FindUE1GameInPath(const std::string& ue1_game_root_folder_path)
@@ -21,23 +21,20 @@ std::pair<KnownUE1Games, std::string> FindUE1GameInPath(const std::string& ue1_g
 		if (File::try_open_existing(executable_path))
 		{
 			// Such executable exists, let's try to take SHA1Sum of it
-			auto bytes = File::read_all_bytes(executable_path);
-
-			sha1::SHA1 s;
-			s.processBytes(bytes.data(), bytes.size());
-			uint32_t digest[5];
-			s.getDigest(digest);
-
-			char temp[41];
-			snprintf(temp, 41, "%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
-
-			std::string sha1sum(temp);
+			// The manifest remembers the hash as long as the executable does not change.
+			// It is the same per user cache file the package manager uses for this game.
+			ScanManifest manifest(OS::cache_filename(ue1_game_root_folder_path, "ScanManifest"));
+			std::string sha1sum = manifest.GetFileHash(executable_path);
 
 			// Now check whether there is a match within the database or not
 			auto it = SHA1Database.find(sha1sum);
 
 			if (it == SHA1Database.end())
+			{
+				// Only remember folders that turned out to be games
+				manifest.Discard();
 				return std::make_pair(KnownUE1Games::UE1_GAME_NOT_FOUND, "");
+			}
 
 			// Hack: Tactical-Ops has a version that contains the exact same UTv469d executable. Handle that here
 			if (it->second == KnownUE1Games::UT99_469d && executable_name == "TacticalOps.exe")
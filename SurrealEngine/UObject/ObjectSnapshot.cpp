@@ -0,0 +1,663 @@
+
+#include "Precomp.h"
+#include "ObjectSnapshot.h"
+#include "UProperty.h"
+#include "UClass.h"
+#include "Package/Package.h"
+#include "Package/PackageManager.h"
+#include "Utils/MemoryStreamReader.h"
+
+namespace
+{
+	const uint32_t SnapshotSignature = 0x53534553; // "SESS"
+	const uint32_t SnapshotVersion = 1;
+
+	// Write a placeholder count and return its position
+	size_t BeginCount(MemoryStreamWriter& writer)
+	{
+		size_t pos = writer.Tell();
+		writer << (uint32_t)0;
+		return pos;
+	}
+
+	void EndCount(MemoryStreamWriter& writer, size_t pos, uint32_t count)
+	{
+		size_t end = writer.Tell();
+		writer.Seek(pos, SEEK_SET);
+		writer << count;
+		writer.Seek(end, SEEK_SET);
+	}
+}
+
+struct ObjectSnapshot::RestoreContext
+{
+	Array<UObject*> References;
+	std::unordered_map<UStruct*, std::unordered_map<NameString, UProperty*>> Properties;
+
+	const std::unordered_map<NameString, UProperty*>& GetProperties(UStruct* structType)
+	{
+		auto& props = Properties[structType];
+		if (props.empty())
+		{
+			for (UProperty* prop : structType->Properties)
+				props[prop->Name] = prop;
+		}
+		return props;
+	}
+};
+
+ObjectSnapshot::ObjectSnapshot(Package* level) : captureLevel(level)
+{
+	AddName(NameString());
+	if (level)
+		LevelName = AddName(level->GetPackageName());
+}
+
+int ObjectSnapshot::Add(UObject* obj, bool travelOnly, uint32_t flags)
+{
+	int index = (int)Objects.size();
+	objectIndices[obj] = index;
+
+	SnapshotObject entry;
+	entry.ClassName = AddName(UObject::GetUClassFullName(obj));
+	entry.ObjectName = AddName(obj->Name);
+	entry.Flags = flags;
+
+	// Save games are restored onto objects created with the class defaults, so values matching them do not need to be stored.
+	// Travel stores every travel property: the arriving actor goes through the new level's spawn and login first, which may
+	// have changed values that were at their defaults when it left.
+	const UObject* source = obj;
+	const UObject* defaults = travelOnly ? nullptr : obj->Class;
+
+	MemoryStreamWriter writer(1024);
+	size_t countPos = BeginCount(writer);
+	uint32_t count = 0;
+	for (UProperty* prop : obj->PropertyData.Class->Properties)
+	{
+		if (travelOnly ? !AnyFlags(prop->PropFlags, PropertyFlags::Travel) : AnyFlags(prop->PropFlags, PropertyFlags::Transient))
+			continue;
+
+		ValueType type;
+		if (!GetValueType(prop, type))
+			continue;
+
+		const uint8_t* data = static_cast<const uint8_t*>(source->GetProperty(prop));
+		const uint8_t* defdata = defaults ? static_cast<const uint8_t*>(defaults->GetProperty(prop)) : nullptr;
+		size_t elementSize = prop->ElementSize();
+		for (int i = 0; i < prop->ArrayDimension; i++)
+		{
+			size_t offset = i * elementSize;
+			if (defdata && prop->Compare((void*)(data + offset), (void*)(defdata + offset)))
+				continue;
+
+			writer << AddName(prop->Name);
+			writer << (uint16_t)i;
+			WriteValue(writer, prop, data + offset);
+			count++;
+		}
+	}
+	EndCount(writer, countPos, count);
+
+	entry.Properties.assign(writer.Data(), writer.Data() + writer.Size());
+	Objects.push_back(std::move(entry));
+	return index;
+}
+
+uint32_t ObjectSnapshot::AddName(const NameString& name)
+{
+	auto it = nameIndices.find(name);
+	if (it != nameIndices.end())
+		return it->second;
+
+	uint32_t index = (uint32_t)Names.size();
+	Names.push_back(name);
+	nameIndices[name] = index;
+	return index;
+}
+
+const NameString& ObjectSnapshot::GetName(uint32_t index) const
+{
+	if (index >= Names.size())
+		Exception::Throw("Invalid name index in object snapshot");
+	return Names[index];
+}
+
+int32_t ObjectSnapshot::AddReference(UObject* obj)
+{
+	if (!obj)
+		return -1;
+
+	auto it = referenceIndices.find(obj);
+	if (it != referenceIndices.end())
+		return it->second;
+
+	Reference ref;
+	ref.Object = obj;
+	ref.InLevel = captureLevel && obj->package == captureLevel;
+	ref.PackageName = obj->package ? AddName(obj->package->GetPackageName()) : 0;
+	ref.ClassName = obj->Class ? AddName(obj->Class->Name) : 0;
+	ref.ObjectName = AddName(obj->Name);
+
+	int32_t index = (int32_t)References.size();
+	References.push_back(ref);
+	referenceIndices[obj] = index;
+	return index;
+}
+
+int32_t ObjectSnapshot::GetSnapshotIndex(const Reference& ref) const
+{
+	if (!ref.Object)
+		return ref.SnapshotIndex;
+
+	// Captured references are matched up with the objects added to the snapshot, in any order
+	auto it = objectIndices.find(ref.Object);
+	return it != objectIndices.end() ? it->second : -1;
+}
+
+bool ObjectSnapshot::GetValueType(UProperty* prop, ValueType& type)
+{
+	switch (prop->ValueType)
+	{
+	case ExpressionValueType::ValueByte: type = ValueType::Byte; return true;
+	case ExpressionValueType::ValueInt: type = ValueType::Int; return true;
+	case ExpressionValueType::ValueBool: type = ValueType::Bool; return true;
+	case ExpressionValueType::ValueFloat: type = ValueType::Float; return true;
+	case ExpressionValueType::ValueName: type = ValueType::Name; return true;
+	case ExpressionValueType::ValueString: type = ValueType::String; return true;
+	case ExpressionValueType::ValueObject: type = ValueType::Object; return true;
+	case ExpressionValueType::ValueVector:
+	case ExpressionValueType::ValueRotator:
+	case ExpressionValueType::ValueColor:
+	case ExpressionValueType::ValueStruct:
+		type = ValueType::Struct;
+		return static_cast<UStructProperty*>(prop)->Struct != nullptr;
+	default:
+		break;
+	}
+
+	ValueType innerType;
+	if (UArrayProperty* arrayprop = UObject::TryCast<UArrayProperty>(prop))
+	{
+		type = ValueType::Array;
+		return arrayprop->Inner && GetValueType(arrayprop->Inner, innerType);
+	}
+	else if (UFixedArrayProperty* fixedprop = UObject::TryCast<UFixedArrayProperty>(prop))
+	{
+		type = ValueType::Array;
+		return fixedprop->Inner && GetValueType(fixedprop->Inner, innerType);
+	}
+
+	// Maps and native pointers are not stored
+	return false;
+}
+
+void ObjectSnapshot::WriteValue(MemoryStreamWriter& writer, UProperty* prop, const void* data)
+{
+	ValueType type;
+	GetValueType(prop, type);
+	writer << (uint8_t)type;
+
+	switch (type)
+	{
+	case ValueType::Byte:
+		writer << *static_cast<const uint8_t*>(data);
+		break;
+	case ValueType::Int:
+		writer << *static_cast<const int32_t*>(data);
+		break;
+	case ValueType::Bool:
+		writer << (uint8_t)(static_cast<UBoolProperty*>(prop)->GetBool(data) ? 1 : 0);
+		break;
+	case ValueType::Float:
+		writer << *static_cast<const float*>(data);
+		break;
+	case ValueType::Name:
+		writer << AddName(*static_cast<const NameString*>(data));
+		break;
+	case ValueType::String:
+		writer.WriteString(*static_cast<const std::string*>(data));
+		break;
+	case ValueType::Object:
+		writer << AddReference(*static_cast<UObject* const*>(data));
+		break;
+	case ValueType::Struct:
+		WriteStruct(writer, static_cast<UStructProperty*>(prop)->Struct, static_cast<const uint8_t*>(data));
+		break;
+	case ValueType::Array:
+		if (UArrayProperty* arrayprop = UObject::TryCast<UArrayProperty>(prop))
+		{
+			auto vec = static_cast<const Array<void*>*>(data);
+			writer << (uint32_t)vec->size();
+			for (void* element : *vec)
+				WriteValue(writer, arrayprop->Inner, element);
+		}
+		else
+		{
+			UFixedArrayProperty* fixedprop = static_cast<UFixedArrayProperty*>(prop);
+			size_t elementSize = fixedprop->Inner->Size();
+			writer << (uint32_t)fixedprop->Count;
+			for (int i = 0; i < fixedprop->Count; i++)
+				WriteValue(writer, fixedprop->Inner, static_cast<const uint8_t*>(data) + i * elementSize);
+		}
+		break;
+	}
+}
+
+void ObjectSnapshot::WriteStruct(MemoryStreamWriter& writer, UStruct* structType, const uint8_t* data)
+{
+	size_t countPos = BeginCount(writer);
+	uint32_t count = 0;
+	for (UProperty* prop : structType->Properties)
+	{
+		ValueType type;
+		if (!GetValueType(prop, type))
+			continue;
+
+		size_t elementSize = prop->ElementSize();
+		for (int i = 0; i < prop->ArrayDimension; i++)
+		{
+			writer << AddName(prop->Name);
+			writer << (uint16_t)i;
+			WriteValue(writer, prop, data + prop->DataOffset.DataOffset + i * elementSize);
+			count++;
+		}
+	}
+	EndCount(writer, countPos, count);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+void ObjectSnapshot::Restore(const Array<UObject*>& targets, PackageManager* packages, Package* level) const
+{
+	RestoreContext context;
+
+	// Resolve the reference table up front
+	bool sameLevel = level && LevelName != 0 && Names[LevelName] == level->GetPackageName();
+	context.References.reserve(References.size());
+	for (const Reference& ref : References)
+	{
+		UObject* obj = nullptr;
+		int32_t index = GetSnapshotIndex(ref);
+		if (index >= 0)
+		{
+			if ((size_t)index < targets.size())
+				obj = targets[index];
+		}
+		else if (ref.PackageName != 0)
+		{
+			try
+			{
+				if (ref.InLevel)
+				{
+					// Objects in another level do not exist anymore
+					if (sameLevel)
+						obj = level->GetUObject(GetName(ref.ClassName), GetName(ref.ObjectName));
+				}
+				else
+				{
+					Package* package = packages->GetPackage(GetName(ref.PackageName));
+					obj = package->GetUObject(GetName(ref.ClassName), GetName(ref.ObjectName));
+				}
+			}
+			catch (const std::exception&)
+			{
+				obj = nullptr;
+			}
+		}
+		context.References.push_back(obj);
+	}
+
+	for (size_t i = 0; i < Objects.size() && i < targets.size(); i++)
+	{
+		UObject* obj = targets[i];
+		if (!obj)
+			continue;
+
+		const Array<uint8_t>& block = Objects[i].Properties;
+		MemoryStreamReader reader(block.data(), block.size());
+		ReadBlock(reader, context, obj->PropertyData.Class, nullptr, obj);
+	}
+}
+
+void ObjectSnapshot::ReadBlock(MemoryStreamReader& reader, RestoreContext& context, UStruct* structType, uint8_t* data, UObject* obj) const
+{
+	const auto& props = context.GetProperties(structType);
+
+	uint32_t count = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const NameString& name = GetName(reader.Read<uint32_t>());
+		uint16_t index = reader.Read<uint16_t>();
+
+		auto it = props.find(name);
+		if (it == props.end() || index >= it->second->ArrayDimension)
+		{
+			// The class changed since the snapshot was made
+			SkipValue(reader, (ValueType)reader.Read<uint8_t>());
+			continue;
+		}
+
+		UProperty* prop = it->second;
+		uint8_t* value = obj ? static_cast<uint8_t*>(obj->GetProperty(prop)) : data + prop->DataOffset.DataOffset;
+		ReadValue(reader, context, prop, value + index * prop->ElementSize());
+	}
+}
+
+void ObjectSnapshot::ReadValue(MemoryStreamReader& reader, RestoreContext& context, UProperty* prop, void* data) const
+{
+	ValueType type = (ValueType)reader.Read<uint8_t>();
+	ValueType propType;
+	if (!GetValueType(prop, propType) || propType != type)
+	{
+		SkipValue(reader, type);
+		return;
+	}
+
+	switch (type)
+	{
+	case ValueType::Byte:
+		*static_cast<uint8_t*>(data) = reader.Read<uint8_t>();
+		break;
+	case ValueType::Int:
+		*static_cast<int32_t*>(data) = reader.Read<int32_t>();
+		break;
+	case ValueType::Bool:
+		static_cast<UBoolProperty*>(prop)->SetBool(data, reader.Read<uint8_t>() != 0);
+		break;
+	case ValueType::Float:
+		*static_cast<float*>(data) = reader.Read<float>();
+		break;
+	case ValueType::Name:
+		*static_cast<NameString*>(data) = GetName(reader.Read<uint32_t>());
+		break;
+	case ValueType::String:
+		*static_cast<std::string*>(data) = std::string(reader.ReadString());
+		break;
+	case ValueType::Object:
+	{
+		int32_t index = reader.Read<int32_t>();
+		if (index < 0)
+		{
+			*static_cast<UObject**>(data) = nullptr;
+		}
+		else if ((size_t)index < context.References.size())
+		{
+			UObject* obj = context.References[index];
+			UClass* objectClass = static_cast<UObjectProperty*>(prop)->ObjectClass;
+			if (obj && (!objectClass || obj->IsA(objectClass->Name)))
+				*static_cast<UObject**>(data) = obj;
+		}
+		break;
+	}
+	case ValueType::Struct:
+		ReadBlock(reader, context, static_cast<UStructProperty*>(prop)->Struct, static_cast<uint8_t*>(data), nullptr);
+		break;
+	case ValueType::Array:
+	{
+		uint32_t count = reader.Read<uint32_t>();
+		if (UArrayProperty* arrayprop = UObject::TryCast<UArrayProperty>(prop))
+		{
+			UProperty* inner = arrayprop->Inner;
+			auto vec = static_cast<Array<void*>*>(data);
+			for (void* element : *vec)
+			{
+				inner->Destruct(element);
+				delete[](int64_t*)element;
+			}
+			vec->clear();
+
+			size_t size = (inner->Size() + 7) / 8;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				int64_t* element = new int64_t[size];
+				inner->Construct(element);
+				vec->push_back(element);
+				ReadValue(reader, context, inner, element);
+			}
+		}
+		else
+		{
+			UFixedArrayProperty* fixedprop = static_cast<UFixedArrayProperty*>(prop);
+			size_t elementSize = fixedprop->Inner->Size();
+			for (uint32_t i = 0; i < count; i++)
+			{
+				if (i < (uint32_t)fixedprop->Count)
+					ReadValue(reader, context, fixedprop->Inner, static_cast<uint8_t*>(data) + i * elementSize);
+				else
+					SkipValue(reader, (ValueType)reader.Read<uint8_t>());
+			}
+		}
+		break;
+	}
+	}
+}
+
+void ObjectSnapshot::SkipValue(MemoryStreamReader& reader, ValueType type) const
+{
+	switch (type)
+	{
+	case ValueType::Byte:
+	case ValueType::Bool:
+		reader.Get(1);
+		break;
+	case ValueType::Int:
+	case ValueType::Float:
+	case ValueType::Name:
+	case ValueType::Object:
+		reader.Get(4);
+		break;
+	case ValueType::String:
+		reader.ReadString();
+		break;
+	case ValueType::Struct:
+	{
+		uint32_t count = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			reader.Get(sizeof(uint32_t) + sizeof(uint16_t));
+			SkipValue(reader, (ValueType)reader.Read<uint8_t>());
+		}
+		break;
+	}
+	case ValueType::Array:
+	{
+		uint32_t count = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < count; i++)
+			SkipValue(reader, (ValueType)reader.Read<uint8_t>());
+		break;
+	}
+	default:
+		Exception::Throw("Invalid value type in object snapshot");
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+MemoryStreamWriter ObjectSnapshot::Save() const
+{
+	MemoryStreamWriter writer(4096);
+	writer << SnapshotSignature;
+	writer << SnapshotVersion;
+
+	writer << (uint32_t)Names.size();
+	for (const NameString& name : Names)
+		writer.WriteString(name.ToString());
+	writer << LevelName;
+
+	writer << (uint32_t)Objects.size();
+	for (const SnapshotObject& obj : Objects)
+	{
+		writer << obj.ClassName;
+		writer << obj.ObjectName;
+		writer << obj.Flags;
+		writer << (uint32_t)obj.Properties.size();
+		writer.Write(obj.Properties.data(), obj.Properties.size());
+	}
+
+	writer << (uint32_t)References.size();
+	for (const Reference& ref : References)
+	{
+		writer << GetSnapshotIndex(ref);
+		writer << (uint8_t)(ref.InLevel ? 1 : 0);
+		writer << ref.PackageName;
+		writer << ref.ClassName;
+		writer << ref.ObjectName;
+	}
+	return writer;
+}
+
+ObjectSnapshot ObjectSnapshot::Load(const void* data, size_t size)
+{
+	ObjectSnapshot snapshot;
+	snapshot.Names.clear();
+
+	try
+	{
+		MemoryStreamReader reader(static_cast<const uint8_t*>(data), size);
+		if (reader.Read<uint32_t>() != SnapshotSignature || reader.Read<uint32_t>() != SnapshotVersion)
+			Exception::Throw("Not an object snapshot or unsupported version");
+
+		uint32_t nameCount = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < nameCount; i++)
+			snapshot.Names.push_back(NameString(reader.ReadString()));
+		snapshot.LevelName = reader.Read<uint32_t>();
+		snapshot.GetName(snapshot.LevelName);
+
+		uint32_t objectCount = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < objectCount; i++)
+		{
+			SnapshotObject obj;
+			obj.ClassName = reader.Read<uint32_t>();
+			obj.ObjectName = reader.Read<uint32_t>();
+			obj.Flags = reader.Read<uint32_t>();
+			uint32_t blockSize = reader.Read<uint32_t>();
+			const uint8_t* block = reader.Get(blockSize);
+			obj.Properties.assign(block, block + blockSize);
+			snapshot.GetName(obj.ClassName);
+			snapshot.GetName(obj.ObjectName);
+			snapshot.Objects.push_back(std::move(obj));
+		}
+
+		uint32_t refCount = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < refCount; i++)
+		{
+			Reference ref;
+			ref.SnapshotIndex = reader.Read<int32_t>();
+			ref.InLevel = reader.Read<uint8_t>() != 0;
+			ref.PackageName = reader.Read<uint32_t>();
+			ref.ClassName = reader.Read<uint32_t>();
+			ref.ObjectName = reader.Read<uint32_t>();
+			snapshot.GetName(ref.PackageName);
+			snapshot.GetName(ref.ClassName);
+			snapshot.GetName(ref.ObjectName);
+			snapshot.References.push_back(ref);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		Exception::Throw(std::string("Could not load object snapshot: ") + e.what());
+	}
+	return snapshot;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+std::string ObjectSnapshot::ToText() const
+{
+	std::string text;
+	if (LevelName != 0)
+		text += "Level " + Names[LevelName].ToString() + "\n";
+
+	for (size_t i = 0; i < Objects.size(); i++)
+	{
+		const SnapshotObject& obj = Objects[i];
+		text += "Object " + std::to_string(i) + ": " + Names[obj.ClassName].ToString() + " " + Names[obj.ObjectName].ToString();
+		if (obj.Flags != 0)
+			text += " flags=" + std::to_string(obj.Flags);
+		text += "\n";
+
+		MemoryStreamReader reader(obj.Properties.data(), obj.Properties.size());
+		DumpBlock(reader, text, "\t");
+	}
+	return text;
+}
+
+void ObjectSnapshot::DumpBlock(MemoryStreamReader& reader, std::string& text, const std::string& indent) const
+{
+	uint32_t count = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const NameString& name = GetName(reader.Read<uint32_t>());
+		uint16_t index = reader.Read<uint16_t>();
+
+		text += indent + name.ToString();
+		if (index != 0)
+			text += "(" + std::to_string(index) + ")";
+		text += "=";
+		DumpValue(reader, text, indent);
+		text += "\n";
+	}
+}
+
+void ObjectSnapshot::DumpValue(MemoryStreamReader& reader, std::string& text, const std::string& indent) const
+{
+	ValueType type = (ValueType)reader.Read<uint8_t>();
+	switch (type)
+	{
+	case ValueType::Byte:
+		text += std::to_string(reader.Read<uint8_t>());
+		break;
+	case ValueType::Int:
+		text += std::to_string(reader.Read<int32_t>());
+		break;
+	case ValueType::Bool:
+		text += reader.Read<uint8_t>() ? "True" : "False";
+		break;
+	case ValueType::Float:
+		text += std::to_string(reader.Read<float>());
+		break;
+	case ValueType::Name:
+		text += GetName(reader.Read<uint32_t>()).ToString();
+		break;
+	case ValueType::String:
+		text += '"' + std::string(reader.ReadString()) + '"';
+		break;
+	case ValueType::Object:
+	{
+		int32_t index = reader.Read<int32_t>();
+		if (index < 0 || (size_t)index >= References.size())
+		{
+			text += "None";
+			break;
+		}
+
+		const Reference& ref = References[index];
+		int32_t snapshotIndex = GetSnapshotIndex(ref);
+		if (snapshotIndex >= 0)
+			text += "Object " + std::to_string(snapshotIndex);
+		else
+			text += GetName(ref.ClassName).ToString() + "'" + GetName(ref.PackageName).ToString() + "." + GetName(ref.ObjectName).ToString() + "'";
+		break;
+	}
+	case ValueType::Struct:
+		text += "(\n";
+		DumpBlock(reader, text, indent + "\t");
+		text += indent + ")";
+		break;
+	case ValueType::Array:
+	{
+		uint32_t count = reader.Read<uint32_t>();
+		text += "[";
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (i != 0)
+				text += ", ";
+			DumpValue(reader, text, indent);
+		}
+		text += "]";
+		break;
+	}
+	default:
+		Exception::Throw("Invalid value type in object snapshot");
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Package/NameString.h"
+#include "Utils/MemoryStreamWriter.h"
+#include <unordered_map>
+
+class UObject;
+class UProperty;
+class UStruct;
+class Package;
+class PackageManager;
+class MemoryStreamReader;
+
+// Binary snapshot of object state, used for travel between levels and for savegames.
+//
+// Each object is stored as its class and name plus a block of tagged property values. References to other
+// objects go through a reference table that is fixed up when the snapshot is restored: objects in the
+// snapshot map to their restored counterparts, objects in other packages are looked up by name.
+class ObjectSnapshot
+{
+public:
+	// References to objects in the level package are only restored into a level with the same name
+	ObjectSnapshot(Package* level = nullptr);
+
+	// Store the state of an object. With travelOnly, all travel properties are stored. Otherwise all non-transient
+	// properties that differ from the class defaults are stored.
+	// Flags are free for the caller to use. Returns the index of the object in the snapshot.
+	int Add(UObject* obj, bool travelOnly, uint32_t flags = 0);
+
+	int GetObjectCount() const { return (int)Objects.size(); }
+	const NameString& GetClassName(int index) const { return Names[Objects[index].ClassName]; } // Full class name, as in Package.Class
+	const NameString& GetObjectName(int index) const { return Names[Objects[index].ObjectName]; }
+	uint32_t GetFlags(int index) const { return Objects[index].Flags; }
+
+	// Write the stored properties onto the targets, one per snapshot object. Null targets are skipped.
+	// References that cannot be resolved leave the current value in place.
+	void Restore(const Array<UObject*>& targets, PackageManager* packages, Package* level = nullptr) const;
+
+	MemoryStreamWriter Save() const;
+	static ObjectSnapshot Load(const void* data, size_t size);
+
+	// Human readable dump of the snapshot, for debugging
+	std::string ToText() const;
+
+private:
+	enum class ValueType : uint8_t
+	{
+		Byte,
+		Int,
+		Bool,
+		Float,
+		Name,
+		String,
+		Object,
+		Struct,
+		Array
+	};
+
+	struct SnapshotObject
+	{
+		uint32_t ClassName = 0;
+		uint32_t ObjectName = 0;
+		uint32_t Flags = 0;
+		Array<uint8_t> Properties;
+	};
+
+	struct Reference
+	{
+		UObject* Object = nullptr; // Only set while capturing
+		int32_t SnapshotIndex = -1;
+		bool InLevel = false;
+		uint32_t PackageName = 0;
+		uint32_t ClassName = 0;
+		uint32_t ObjectName = 0;
+	};
+
+	uint32_t AddName(const NameString& name);
+	const NameString& GetName(uint32_t index) const;
+	int32_t AddReference(UObject* obj);
+	int32_t GetSnapshotIndex(const Reference& ref) const;
+
+	static bool GetValueType(UProperty* prop, ValueType& type);
+	void WriteValue(MemoryStreamWriter& writer, UProperty* prop, const void* data);
+	void WriteStruct(MemoryStreamWriter& writer, UStruct* structType, const uint8_t* data);
+
+	struct RestoreContext;
+	void ReadBlock(MemoryStreamReader& reader, RestoreContext& context, UStruct* structType, uint8_t* data, UObject* obj) const;
+	void ReadValue(MemoryStreamReader& reader, RestoreContext& context, UProperty* prop, void* data) const;
+	void SkipValue(MemoryStreamReader& reader, ValueType type) const;
+	void DumpBlock(MemoryStreamReader& reader, std::string& text, const std::string& indent) const;
+	void DumpValue(MemoryStreamReader& reader, std::string& text, const std::string& indent) const;
+
+	Array<NameString> Names;
+	Array<SnapshotObject> Objects;
+	Array<Reference> References;
+	uint32_t LevelName = 0;
+
+	Package* captureLevel = nullptr;
+	std::unordered_map<NameString, uint32_t> nameIndices;
+	std::unordered_map<UObject*, int32_t> referenceIndices;
+	std::unordered_map<UObject*, int32_t> objectIndices;
+};
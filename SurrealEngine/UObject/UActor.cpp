@@ -60,10 +60,11 @@ UActor* UActor::Spawn(UClass* SpawnClass, UActor* SpawnOwner, NameString SpawnTa
 	vec3 location = SpawnLocation ? *SpawnLocation : Location();
 	Rotator rotation = SpawnRotation ? *SpawnRotation : Rotation();
 
-	float radius = SpawnClass->GetDefaultObject<UActor>()->CollisionRadius();
-	float height = SpawnClass->GetDefaultObject<UActor>()->CollisionHeight();
-	bool bCollideWorld = SpawnClass->GetDefaultObject<UActor>()->bCollideWorld();
-	bool bCollideWhenPlacing = SpawnClass->GetDefaultObject<UActor>()->bCollideWhenPlacing();
+	const UActor* defaults = SpawnClass->GetDefaultObject<UActor>();
+	float radius = defaults->CollisionRadius();
+	float height = defaults->CollisionHeight();
+	bool bCollideWorld = defaults->bCollideWorld();
+	bool bCollideWhenPlacing = defaults->bCollideWhenPlacing();
 	if (bCollideWorld || bCollideWhenPlacing)
 	{
 		auto result = CheckLocation(location, radius, height, bCollideWorld || bCollideWhenPlacing);
@@ -898,7 +899,7 @@ void UActor::TickInterpolating(float elapsed)
 		{
 			pawn->DesiredFlashScale() = mix(target->ScreenFlashScale(), next->ScreenFlashScale(), physAlpha);
 			pawn->DesiredFlashFog() = mix(target->ScreenFlashFog(), next->ScreenFlashFog(), physAlpha);
-			pawn->FovAngle() = mix(target->FovModifier(), next->FovModifier(), physAlpha) * Class->GetDefaultObject<UPlayerPawn>()->FovAngle();
+			pawn->FovAngle() = mix(target->FovModifier(), next->FovModifier(), physAlpha) * std::as_const(*Class->GetDefaultObject<UPlayerPawn>()).FovAngle();
 			pawn->FlashScale() = vec3(pawn->DesiredFlashScale());
 			pawn->FlashFog() = pawn->DesiredFlashFog();
 		}
@@ -1090,11 +1091,10 @@ void UActor::SetPhysics(uint8_t newPhysics)
 
 void UActor::SetCollision(bool newColActors, bool newBlockActors, bool newBlockPlayers)
 {
-	XLevel()->Hash.RemoveFromCollision(this);
 	bCollideActors() = newColActors;
 	bBlockActors() = newBlockActors;
 	bBlockPlayers() = newBlockPlayers;
-	XLevel()->Hash.AddToCollision(this);
+	XLevel()->Hash.UpdateCollision(this);
 }
 
 bool UActor::SetLocation(const vec3& newLocation)
@@ -1103,9 +1103,8 @@ bool UActor::SetLocation(const vec3& newLocation)
 	if (!result.first)
 		return false;
 
-	XLevel()->Hash.RemoveFromCollision(this);
 	Location() = result.second;
-	XLevel()->Hash.AddToCollision(this);
+	XLevel()->Hash.UpdateCollision(this);
 
 	if (Level()->bBegunPlay())
 	{
@@ -1144,10 +1143,9 @@ bool UActor::SetCollisionSize(float newRadius, float newHeight)
 {
 	// To do: return false if there isn't room
 
-	XLevel()->Hash.RemoveFromCollision(this);
 	CollisionRadius() = newRadius;
 	CollisionHeight() = newHeight;
-	XLevel()->Hash.AddToCollision(this);
+	XLevel()->Hash.UpdateCollision(this);
 	return true;
 }
 
@@ -1266,9 +1264,8 @@ CollisionHit UActor::TryMove(const vec3& delta, bool dryRun)
 	vec3 actuallyMoved = delta * blockingHit.Fraction;
 	vec3 OldLocation = Location();
 
-	XLevel()->Hash.RemoveFromCollision(this);
 	Location() += actuallyMoved;
-	XLevel()->Hash.AddToCollision(this);
+	XLevel()->Hash.UpdateCollision(this);
 
 	// Based actors needs to move with us
 	if (StandingCount() > 0)
@@ -1976,6 +1973,15 @@ bool UPawn::PointReachable(vec3 aPoint)
 	return TryMove(delta, true).Fraction == 1.0f;
 }
 
+// Traces the eye to the center, top and bottom of the other actor as one packet, instead of one FastTrace after another
+static bool TraceSightLines(ULevel* level, UPawn* pawn, const vec3& eye_pos, const vec3& origin, const vec3& top, const vec3& bottom)
+{
+	TraceLine lines[3] = { { eye_pos, origin }, { eye_pos, top }, { eye_pos, bottom } };
+	uint8_t hits[3];
+	level->TraceRayAnyHit(lines, 3, hits, pawn, false, true, false);
+	return !hits[0] || !hits[1] || !hits[2];
+}
+
 bool UPawn::LineOfSightTo(UActor* other)
 {
 	if (!other)
@@ -1988,7 +1994,7 @@ bool UPawn::LineOfSightTo(UActor* other)
 	auto top = origin + vec3{ 0.f, 0.f, other->CollisionHeight() / 2 };
 	auto bottom = origin - vec3{ 0.f, 0.f, other->CollisionHeight() / 2 };
 
-	return FastTrace(origin, eye_pos) || FastTrace(top, eye_pos) || FastTrace(bottom, eye_pos);
+	return TraceSightLines(XLevel(), this, eye_pos, origin, top, bottom);
 }
 
 bool UPawn::CanSee(UActor* other)
@@ -2025,7 +2031,7 @@ bool UPawn::CanSee(UActor* other)
 	if (peripheralVision > 0.0f && abs(cosine) > peripheralVision)
 		return false;
 
-	return FastTrace(origin, eye_pos) || FastTrace(top, eye_pos) || FastTrace(bottom, eye_pos);
+	return TraceSightLines(XLevel(), this, eye_pos, origin, top, bottom);
 }
 
 bool UPawn::CanHearNoise(UActor* source, float loudness)
@@ -2487,11 +2493,11 @@ UObject* UDecal::AttachDecal(float traceDistance, const vec3& decalDir)
 		dirNormalized = normalize(decalDir);
 	}
 
-	CollisionHitList hits = XLevel()->Model->TraceRay(to_dvec3(Location()), 0.1f, to_dvec3(dirNormalized), traceDistance, false);
-	if (hits.empty()) return nullptr;
+	CollisionHit hit;
+	if (!XLevel()->Model->TraceRayFirstHit(to_dvec3(Location()), 0.1f, to_dvec3(dirNormalized), traceDistance, false, hit))
+		return nullptr;
 
 	// Do not attempt to create a decal if we hit a surface that's invisible or a fake backdrop
-	auto& hit = hits.front();
 	if (hit.Node && (XLevel()->Model->Surfaces[hit.Node->Surf].PolyFlags & PF_FakeBackdrop 
 		|| XLevel()->Model->Surfaces[hit.Node->Surf].PolyFlags & PF_Invisible))
 		return nullptr;
@@ -2541,24 +2547,23 @@ void UDecal::DetachDecal()
 
 double UMover::TraceTest(ULevel* level, const dvec3& origin, double tmin, const dvec3& direction, double tmax, double height, double radius)
 {
-	CollisionHitList worldHits;
+	CollisionHit hit;
 
 	if (radius == 0.0 && height == 0.0)
 	{
 		// Line/triangle intersect
 		TraceRayModel tracemodel;
-		worldHits = tracemodel.Trace(Brush(), origin, tmin, direction, tmax, false);
+		if (!tracemodel.TraceFirstHit(Brush(), origin, tmin, direction, tmax, false, hit))
+			return tmax;
 	}
 	else
 	{
 		// AABB/Triangle intersect
 		TraceAABBModel tracemodel;
 		dvec3 extents = { (double)radius, (double)radius, (double)height };
-		worldHits = tracemodel.Trace(Brush(), origin, tmin, direction, tmax, extents, false);
+		if (!tracemodel.TraceFirstHit(Brush(), origin, tmin, direction, tmax, extents, false, hit))
+			return tmax;
 	}
 
-	if (worldHits.empty())
-		return tmax;
-
-	return worldHits.front().Fraction;
+	return hit.Fraction;
 }
\ No newline at end of file
@@ -225,9 +225,8 @@ public:
 	struct
 	{
 		bool Inserted = false;
-		vec3 Location = { 0.0f };
-		float Height = 0.0f;
-		float Radius = 0.0f;
+		int GridLevel = 0; // -1 if too large for the grid
+		uint32_t BucketId = 0;
 	} CollisionHashInfo;
 
 	// Lights touching this actor
@@ -290,194 +289,194 @@ public:
 	float WorldVolumetricRadius() { return ((int)VolumeRadius() + 1) * 25.0f; }
 	float WorldLightRadius() { return ((int)LightRadius() + 1) * 25.0f; }
 
-	vec3& Acceleration() { return Value<vec3>(PropOffsets_Actor.Acceleration); }
-	uint8_t& AmbientGlow() { return Value<uint8_t>(PropOffsets_Actor.AmbientGlow); }
-	USound*& AmbientSound() { return Value<USound*>(PropOffsets_Actor.AmbientSound); }
-	float& AnimFrame() { return Value<float>(PropOffsets_Actor.AnimFrame); }
-	float& AnimLast() { return Value<float>(PropOffsets_Actor.AnimLast); }
-	float& AnimMinRate() { return Value<float>(PropOffsets_Actor.AnimMinRate); }
-	float& AnimRate() { return Value<float>(PropOffsets_Actor.AnimRate); }
-	NameString& AnimSequence() { return Value<NameString>(PropOffsets_Actor.AnimSequence); }
-	NameString& AttachTag() { return Value<NameString>(PropOffsets_Actor.AttachTag); }
-	UActor*& ActorBase() { return Value<UActor*>(PropOffsets_Actor.Base); }
-	UModel*& Brush() { return Value<UModel*>(PropOffsets_Actor.Brush); }
-	float& Buoyancy() { return Value<float>(PropOffsets_Actor.Buoyancy); }
-	vec3& ColLocation() { return Value<vec3>(PropOffsets_Actor.ColLocation); }
-	float& CollisionHeight() { return Value<float>(PropOffsets_Actor.CollisionHeight); }
-	float& CollisionRadius() { return Value<float>(PropOffsets_Actor.CollisionRadius); }
-	int& CollisionTag() { return Value<int>(PropOffsets_Actor.CollisionTag); }
-	UActor*& Deleted() { return Value<UActor*>(PropOffsets_Actor.Deleted); }
-	Rotator& DesiredRotation() { return Value<Rotator>(PropOffsets_Actor.DesiredRotation); }
-	uint8_t& DodgeDir() { return Value<uint8_t>(PropOffsets_Actor.DodgeDir); }
-	float& DrawScale() { return Value<float>(PropOffsets_Actor.DrawScale); }
-	uint8_t& DrawType() { return Value<uint8_t>(PropOffsets_Actor.DrawType); }
-	NameString& Event() { return Value<NameString>(PropOffsets_Actor.Event); }
-	int& ExtraTag() { return Value<int>(PropOffsets_Actor.ExtraTag); }
-	uint8_t& Fatness() { return Value<uint8_t>(PropOffsets_Actor.Fatness); }
-	NameString& Group() { return Value<NameString>(PropOffsets_Actor.Group); }
-	UActor*& HitActor() { return Value<UActor*>(PropOffsets_Actor.HitActor); }
-	NameString& InitialState() { return Value<NameString>(PropOffsets_Actor.InitialState); }
-	UPawn*& Instigator() { return Value<UPawn*>(PropOffsets_Actor.Instigator); }
-	UInventory*& Inventory() { return Value<UInventory*>(PropOffsets_Actor.Inventory); }
-	float& LODBias() { return Value<float>(PropOffsets_Actor.LODBias); }
-	UActor*& LatentActor() { return Value<UActor*>(PropOffsets_Actor.LatentActor); }
-	uint8_t& LatentByte() { return Value<uint8_t>(PropOffsets_Actor.LatentByte); }
-	float& LatentFloat() { return Value<float>(PropOffsets_Actor.LatentFloat); }
-	int& LatentInt() { return Value<int>(PropOffsets_Actor.LatentInt); }
-	ULevelInfo*& Level() { return Value<ULevelInfo*>(PropOffsets_Actor.Level); }
-	float& LifeSpan() { return Value<float>(PropOffsets_Actor.LifeSpan); }
-	uint8_t& LightBrightness() { return Value<uint8_t>(PropOffsets_Actor.LightBrightness); }
-	uint8_t& LightCone() { return Value<uint8_t>(PropOffsets_Actor.LightCone); }
-	uint8_t& LightEffect() { return Value<uint8_t>(PropOffsets_Actor.LightEffect); }
-	uint8_t& LightHue() { return Value<uint8_t>(PropOffsets_Actor.LightHue); }
-	uint8_t& LightPeriod() { return Value<uint8_t>(PropOffsets_Actor.LightPeriod); }
-	uint8_t& LightPhase() { return Value<uint8_t>(PropOffsets_Actor.LightPhase); }
-	uint8_t& LightRadius() { return Value<uint8_t>(PropOffsets_Actor.LightRadius); }
-	uint8_t& LightSaturation() { return Value<uint8_t>(PropOffsets_Actor.LightSaturation); }
-	uint8_t& LightType() { return Value<uint8_t>(PropOffsets_Actor.LightType); }
-	int& LightingTag() { return Value<int>(PropOffsets_Actor.LightingTag); }
-	vec3& Location() { return Value<vec3>(PropOffsets_Actor.Location); }
-	float& Mass() { return Value<float>(PropOffsets_Actor.Mass); }
-	UMesh*& Mesh() { return Value<UMesh*>(PropOffsets_Actor.Mesh); }
-	uint8_t& MiscNumber() { return Value<uint8_t>(PropOffsets_Actor.MiscNumber); }
-	UTexture*& MultiSkins() { return Value<UTexture*>(PropOffsets_Actor.MultiSkins); }
-	float& NetPriority() { return Value<float>(PropOffsets_Actor.NetPriority); }
-	int& NetTag() { return Value<int>(PropOffsets_Actor.NetTag); }
-	float& NetUpdateFrequency() { return Value<float>(PropOffsets_Actor.NetUpdateFrequency); }
-	float& OddsOfAppearing() { return Value<float>(PropOffsets_Actor.OddsOfAppearing); }
-	float& OldAnimRate() { return Value<float>(PropOffsets_Actor.OldAnimRate); }
-	vec3& OldLocation() { return Value<vec3>(PropOffsets_Actor.OldLocation); }
-	int& OtherTag() { return Value<int>(PropOffsets_Actor.OtherTag); }
-	UActor*& Owner() { return Value<UActor*>(PropOffsets_Actor.Owner); }
-	UActor*& PendingTouch() { return Value<UActor*>(PropOffsets_Actor.PendingTouch); }
-	float& PhysAlpha() { return Value<float>(PropOffsets_Actor.PhysAlpha); }
-	float& PhysRate() { return Value<float>(PropOffsets_Actor.PhysRate); }
-	uint8_t& Physics() { return Value<uint8_t>(PropOffsets_Actor.Physics); }
-	vec3& PrePivot() { return Value<vec3>(PropOffsets_Actor.PrePivot); }
-	PointRegion& Region() { return Value<PointRegion>(PropOffsets_Actor.Region); }
-	uint8_t& RemoteRole() { return Value<uint8_t>(PropOffsets_Actor.RemoteRole); }
+	PROPERTY_VALUE(vec3, Acceleration, PropOffsets_Actor.Acceleration)
+	PROPERTY_VALUE(uint8_t, AmbientGlow, PropOffsets_Actor.AmbientGlow)
+	PROPERTY_VALUE(USound*, AmbientSound, PropOffsets_Actor.AmbientSound)
+	PROPERTY_VALUE(float, AnimFrame, PropOffsets_Actor.AnimFrame)
+	PROPERTY_VALUE(float, AnimLast, PropOffsets_Actor.AnimLast)
+	PROPERTY_VALUE(float, AnimMinRate, PropOffsets_Actor.AnimMinRate)
+	PROPERTY_VALUE(float, AnimRate, PropOffsets_Actor.AnimRate)
+	PROPERTY_VALUE(NameString, AnimSequence, PropOffsets_Actor.AnimSequence)
+	PROPERTY_VALUE(NameString, AttachTag, PropOffsets_Actor.AttachTag)
+	PROPERTY_VALUE(UActor*, ActorBase, PropOffsets_Actor.Base)
+	PROPERTY_VALUE(UModel*, Brush, PropOffsets_Actor.Brush)
+	PROPERTY_VALUE(float, Buoyancy, PropOffsets_Actor.Buoyancy)
+	PROPERTY_VALUE(vec3, ColLocation, PropOffsets_Actor.ColLocation)
+	PROPERTY_VALUE(float, CollisionHeight, PropOffsets_Actor.CollisionHeight)
+	PROPERTY_VALUE(float, CollisionRadius, PropOffsets_Actor.CollisionRadius)
+	PROPERTY_VALUE(int, CollisionTag, PropOffsets_Actor.CollisionTag)
+	PROPERTY_VALUE(UActor*, Deleted, PropOffsets_Actor.Deleted)
+	PROPERTY_VALUE(Rotator, DesiredRotation, PropOffsets_Actor.DesiredRotation)
+	PROPERTY_VALUE(uint8_t, DodgeDir, PropOffsets_Actor.DodgeDir)
+	PROPERTY_VALUE(float, DrawScale, PropOffsets_Actor.DrawScale)
+	PROPERTY_VALUE(uint8_t, DrawType, PropOffsets_Actor.DrawType)
+	PROPERTY_VALUE(NameString, Event, PropOffsets_Actor.Event)
+	PROPERTY_VALUE(int, ExtraTag, PropOffsets_Actor.ExtraTag)
+	PROPERTY_VALUE(uint8_t, Fatness, PropOffsets_Actor.Fatness)
+	PROPERTY_VALUE(NameString, Group, PropOffsets_Actor.Group)
+	PROPERTY_VALUE(UActor*, HitActor, PropOffsets_Actor.HitActor)
+	PROPERTY_VALUE(NameString, InitialState, PropOffsets_Actor.InitialState)
+	PROPERTY_VALUE(UPawn*, Instigator, PropOffsets_Actor.Instigator)
+	PROPERTY_VALUE(UInventory*, Inventory, PropOffsets_Actor.Inventory)
+	PROPERTY_VALUE(float, LODBias, PropOffsets_Actor.LODBias)
+	PROPERTY_VALUE(UActor*, LatentActor, PropOffsets_Actor.LatentActor)
+	PROPERTY_VALUE(uint8_t, LatentByte, PropOffsets_Actor.LatentByte)
+	PROPERTY_VALUE(float, LatentFloat, PropOffsets_Actor.LatentFloat)
+	PROPERTY_VALUE(int, LatentInt, PropOffsets_Actor.LatentInt)
+	PROPERTY_VALUE(ULevelInfo*, Level, PropOffsets_Actor.Level)
+	PROPERTY_VALUE(float, LifeSpan, PropOffsets_Actor.LifeSpan)
+	PROPERTY_VALUE(uint8_t, LightBrightness, PropOffsets_Actor.LightBrightness)
+	PROPERTY_VALUE(uint8_t, LightCone, PropOffsets_Actor.LightCone)
+	PROPERTY_VALUE(uint8_t, LightEffect, PropOffsets_Actor.LightEffect)
+	PROPERTY_VALUE(uint8_t, LightHue, PropOffsets_Actor.LightHue)
+	PROPERTY_VALUE(uint8_t, LightPeriod, PropOffsets_Actor.LightPeriod)
+	PROPERTY_VALUE(uint8_t, LightPhase, PropOffsets_Actor.LightPhase)
+	PROPERTY_VALUE(uint8_t, LightRadius, PropOffsets_Actor.LightRadius)
+	PROPERTY_VALUE(uint8_t, LightSaturation, PropOffsets_Actor.LightSaturation)
+	PROPERTY_VALUE(uint8_t, LightType, PropOffsets_Actor.LightType)
+	PROPERTY_VALUE(int, LightingTag, PropOffsets_Actor.LightingTag)
+	PROPERTY_VALUE(vec3, Location, PropOffsets_Actor.Location)
+	PROPERTY_VALUE(float, Mass, PropOffsets_Actor.Mass)
+	PROPERTY_VALUE(UMesh*, Mesh, PropOffsets_Actor.Mesh)
+	PROPERTY_VALUE(uint8_t, MiscNumber, PropOffsets_Actor.MiscNumber)
+	PROPERTY_VALUE(UTexture*, MultiSkins, PropOffsets_Actor.MultiSkins)
+	PROPERTY_VALUE(float, NetPriority, PropOffsets_Actor.NetPriority)
+	PROPERTY_VALUE(int, NetTag, PropOffsets_Actor.NetTag)
+	PROPERTY_VALUE(float, NetUpdateFrequency, PropOffsets_Actor.NetUpdateFrequency)
+	PROPERTY_VALUE(float, OddsOfAppearing, PropOffsets_Actor.OddsOfAppearing)
+	PROPERTY_VALUE(float, OldAnimRate, PropOffsets_Actor.OldAnimRate)
+	PROPERTY_VALUE(vec3, OldLocation, PropOffsets_Actor.OldLocation)
+	PROPERTY_VALUE(int, OtherTag, PropOffsets_Actor.OtherTag)
+	PROPERTY_VALUE(UActor*, Owner, PropOffsets_Actor.Owner)
+	PROPERTY_VALUE(UActor*, PendingTouch, PropOffsets_Actor.PendingTouch)
+	PROPERTY_VALUE(float, PhysAlpha, PropOffsets_Actor.PhysAlpha)
+	PROPERTY_VALUE(float, PhysRate, PropOffsets_Actor.PhysRate)
+	PROPERTY_VALUE(uint8_t, Physics, PropOffsets_Actor.Physics)
+	PROPERTY_VALUE(vec3, PrePivot, PropOffsets_Actor.PrePivot)
+	PROPERTY_VALUE(PointRegion, Region, PropOffsets_Actor.Region)
+	PROPERTY_VALUE(uint8_t, RemoteRole, PropOffsets_Actor.RemoteRole)
 	//URenderIterator*& RenderInterface() { return Value<URenderIterator*>(PropOffsets_Actor.RenderInterface); }
-	UClass*& RenderIteratorClass() { return Value<UClass*>(PropOffsets_Actor.RenderIteratorClass); }
-	uint8_t& Role() { return Value<uint8_t>(PropOffsets_Actor.Role); }
-	Rotator& Rotation() { return Value<Rotator>(PropOffsets_Actor.Rotation); }
-	Rotator& RotationRate() { return Value<Rotator>(PropOffsets_Actor.RotationRate); }
-	float& ScaleGlow() { return Value<float>(PropOffsets_Actor.ScaleGlow); }
+	PROPERTY_VALUE(UClass*, RenderIteratorClass, PropOffsets_Actor.RenderIteratorClass)
+	PROPERTY_VALUE(uint8_t, Role, PropOffsets_Actor.Role)
+	PROPERTY_VALUE(Rotator, Rotation, PropOffsets_Actor.Rotation)
+	PROPERTY_VALUE(Rotator, RotationRate, PropOffsets_Actor.RotationRate)
+	PROPERTY_VALUE(float, ScaleGlow, PropOffsets_Actor.ScaleGlow)
 	//Plane& SimAnim() { return Value<Plane>(PropOffsets_Actor.SimAnim); }
-	UAnimation*& SkelAnim() { return Value<UAnimation*>(PropOffsets_Actor.SkelAnim); }
-	UTexture*& Skin() { return Value<UTexture*>(PropOffsets_Actor.Skin); }
-	uint8_t& SoundPitch() { return Value<uint8_t>(PropOffsets_Actor.SoundPitch); }
-	uint8_t& SoundRadius() { return Value<uint8_t>(PropOffsets_Actor.SoundRadius); }
-	uint8_t& SoundVolume() { return Value<uint8_t>(PropOffsets_Actor.SoundVolume); }
-	int& SpecialTag() { return Value<int>(PropOffsets_Actor.SpecialTag); }
-	UTexture*& Sprite() { return Value<UTexture*>(PropOffsets_Actor.Sprite); }
-	float& SpriteProjForward() { return Value<float>(PropOffsets_Actor.SpriteProjForward); }
-	uint8_t& StandingCount() { return Value<uint8_t>(PropOffsets_Actor.StandingCount); }
-	uint8_t& Style() { return Value<uint8_t>(PropOffsets_Actor.Style); }
-	NameString& Tag() { return Value<NameString>(PropOffsets_Actor.Tag); }
-	UActor*& Target() { return Value<UActor*>(PropOffsets_Actor.Target); }
-	UTexture*& Texture() { return Value<UTexture*>(PropOffsets_Actor.Texture); }
-	float& TimerCounter() { return Value<float>(PropOffsets_Actor.TimerCounter); }
-	float& TimerRate() { return Value<float>(PropOffsets_Actor.TimerRate); }
-	UActor** Touching() { return FixedArray<UActor*>(PropOffsets_Actor.Touching); }
-	float& TransientSoundRadius() { return Value<float>(PropOffsets_Actor.TransientSoundRadius); }
-	float& TransientSoundVolume() { return Value<float>(PropOffsets_Actor.TransientSoundVolume); }
-	float& TweenRate() { return Value<float>(PropOffsets_Actor.TweenRate); }
-	vec3& Velocity() { return Value<vec3>(PropOffsets_Actor.Velocity); }
-	float& VisibilityHeight() { return Value<float>(PropOffsets_Actor.VisibilityHeight); }
-	float& VisibilityRadius() { return Value<float>(PropOffsets_Actor.VisibilityRadius); }
-	uint8_t& VolumeBrightness() { return Value<uint8_t>(PropOffsets_Actor.VolumeBrightness); }
-	uint8_t& VolumeFog() { return Value<uint8_t>(PropOffsets_Actor.VolumeFog); }
-	uint8_t& VolumeRadius() { return Value<uint8_t>(PropOffsets_Actor.VolumeRadius); }
-	ULevel*& XLevel() { return Value<ULevel*>(PropOffsets_Actor.XLevel); }
-	BitfieldBool bActorShadows() { return BoolValue(PropOffsets_Actor.bActorShadows); }
-	BitfieldBool bAlwaysRelevant() { return BoolValue(PropOffsets_Actor.bAlwaysRelevant); }
-	BitfieldBool bAlwaysTick() { return BoolValue(PropOffsets_Actor.bAlwaysTick); }
-	BitfieldBool bAnimByOwner() { return BoolValue(PropOffsets_Actor.bAnimByOwner); }
-	BitfieldBool bAnimFinished() { return BoolValue(PropOffsets_Actor.bAnimFinished); }
-	BitfieldBool bAnimLoop() { return BoolValue(PropOffsets_Actor.bAnimLoop); }
-	BitfieldBool bAnimNotify() { return BoolValue(PropOffsets_Actor.bAnimNotify); }
-	BitfieldBool bAssimilated() { return BoolValue(PropOffsets_Actor.bAssimilated); }
-	BitfieldBool bBlockActors() { return BoolValue(PropOffsets_Actor.bBlockActors); }
-	BitfieldBool bBlockPlayers() { return BoolValue(PropOffsets_Actor.bBlockPlayers); }
-	BitfieldBool bBounce() { return BoolValue(PropOffsets_Actor.bBounce); }
-	BitfieldBool bCanTeleport() { return BoolValue(PropOffsets_Actor.bCanTeleport); }
-	BitfieldBool bCarriedItem() { return BoolValue(PropOffsets_Actor.bCarriedItem); }
-	BitfieldBool bClientAnim() { return BoolValue(PropOffsets_Actor.bClientAnim); }
-	BitfieldBool bClientDemoNetFunc() { return BoolValue(PropOffsets_Actor.bClientDemoNetFunc); }
-	BitfieldBool bClientDemoRecording() { return BoolValue(PropOffsets_Actor.bClientDemoRecording); }
-	BitfieldBool bCollideActors() { return BoolValue(PropOffsets_Actor.bCollideActors); }
-	BitfieldBool bCollideWhenPlacing() { return BoolValue(PropOffsets_Actor.bCollideWhenPlacing); }
-	BitfieldBool bCollideWorld() { return BoolValue(PropOffsets_Actor.bCollideWorld); }
-	BitfieldBool bCorona() { return BoolValue(PropOffsets_Actor.bCorona); }
-	BitfieldBool bDeleteMe() { return BoolValue(PropOffsets_Actor.bDeleteMe); }
-	BitfieldBool bDemoRecording() { return BoolValue(PropOffsets_Actor.bDemoRecording); }
-	BitfieldBool bDifficulty0() { return BoolValue(PropOffsets_Actor.bDifficulty0); }
-	BitfieldBool bDifficulty1() { return BoolValue(PropOffsets_Actor.bDifficulty1); }
-	BitfieldBool bDifficulty2() { return BoolValue(PropOffsets_Actor.bDifficulty2); }
-	BitfieldBool bDifficulty3() { return BoolValue(PropOffsets_Actor.bDifficulty3); }
-	BitfieldBool bDirectional() { return BoolValue(PropOffsets_Actor.bDirectional); }
-	BitfieldBool bDynamicLight() { return BoolValue(PropOffsets_Actor.bDynamicLight); }
-	BitfieldBool bEdLocked() { return BoolValue(PropOffsets_Actor.bEdLocked); }
-	BitfieldBool bEdShouldSnap() { return BoolValue(PropOffsets_Actor.bEdShouldSnap); }
-	BitfieldBool bEdSnap() { return BoolValue(PropOffsets_Actor.bEdSnap); }
-	BitfieldBool bFilterByVolume() { return BoolValue(PropOffsets_Actor.bFilterByVolume); }
-	BitfieldBool bFixedRotationDir() { return BoolValue(PropOffsets_Actor.bFixedRotationDir); }
-	BitfieldBool bForcePhysicsUpdate() { return BoolValue(PropOffsets_Actor.bForcePhysicsUpdate); }
-	BitfieldBool bForceStasis() { return BoolValue(PropOffsets_Actor.bForceStasis); }
-	BitfieldBool bGameRelevant() { return BoolValue(PropOffsets_Actor.bGameRelevant); }
-	BitfieldBool bHidden() { return BoolValue(PropOffsets_Actor.bHidden); }
-	BitfieldBool bHiddenEd() { return BoolValue(PropOffsets_Actor.bHiddenEd); }
-	BitfieldBool bHighDetail() { return BoolValue(PropOffsets_Actor.bHighDetail); }
-	BitfieldBool bHighlighted() { return BoolValue(PropOffsets_Actor.bHighlighted); }
-	BitfieldBool bHurtEntry() { return BoolValue(PropOffsets_Actor.bHurtEntry); }
-	BitfieldBool bInterpolating() { return BoolValue(PropOffsets_Actor.bInterpolating); }
-	BitfieldBool bIsItemGoal() { return BoolValue(PropOffsets_Actor.bIsItemGoal); }
-	BitfieldBool bIsKillGoal() { return BoolValue(PropOffsets_Actor.bIsKillGoal); }
-	BitfieldBool bIsMover() { return BoolValue(PropOffsets_Actor.bIsMover); }
-	BitfieldBool bIsPawn() { return BoolValue(PropOffsets_Actor.bIsPawn); }
-	BitfieldBool bIsSecretGoal() { return BoolValue(PropOffsets_Actor.bIsSecretGoal); }
-	BitfieldBool bJustTeleported() { return BoolValue(PropOffsets_Actor.bJustTeleported); }
-	BitfieldBool bLensFlare() { return BoolValue(PropOffsets_Actor.bLensFlare); }
-	BitfieldBool bLightChanged() { return BoolValue(PropOffsets_Actor.bLightChanged); }
-	BitfieldBool bMemorized() { return BoolValue(PropOffsets_Actor.bMemorized); }
-	BitfieldBool bMeshCurvy() { return BoolValue(PropOffsets_Actor.bMeshCurvy); }
-	BitfieldBool bMeshEnviroMap() { return BoolValue(PropOffsets_Actor.bMeshEnviroMap); }
-	BitfieldBool bMovable() { return BoolValue(PropOffsets_Actor.bMovable); }
-	BitfieldBool bNet() { return BoolValue(PropOffsets_Actor.bNet); }
-	BitfieldBool bNetFeel() { return BoolValue(PropOffsets_Actor.bNetFeel); }
-	BitfieldBool bNetHear() { return BoolValue(PropOffsets_Actor.bNetHear); }
-	BitfieldBool bNetInitial() { return BoolValue(PropOffsets_Actor.bNetInitial); }
-	BitfieldBool bNetOptional() { return BoolValue(PropOffsets_Actor.bNetOptional); }
-	BitfieldBool bNetOwner() { return BoolValue(PropOffsets_Actor.bNetOwner); }
-	BitfieldBool bNetRelevant() { return BoolValue(PropOffsets_Actor.bNetRelevant); }
-	BitfieldBool bNetSee() { return BoolValue(PropOffsets_Actor.bNetSee); }
-	BitfieldBool bNetSpecial() { return BoolValue(PropOffsets_Actor.bNetSpecial); }
-	BitfieldBool bNetTemporary() { return BoolValue(PropOffsets_Actor.bNetTemporary); }
-	BitfieldBool bNoDelete() { return BoolValue(PropOffsets_Actor.bNoDelete); }
-	BitfieldBool bNoSmooth() { return BoolValue(PropOffsets_Actor.bNoSmooth); }
-	BitfieldBool bOnlyOwnerSee() { return BoolValue(PropOffsets_Actor.bOnlyOwnerSee); }
-	BitfieldBool bOwnerNoSee() { return BoolValue(PropOffsets_Actor.bOwnerNoSee); }
-	BitfieldBool bParticles() { return BoolValue(PropOffsets_Actor.bParticles); }
-	BitfieldBool bProjTarget() { return BoolValue(PropOffsets_Actor.bProjTarget); }
-	BitfieldBool bRandomFrame() { return BoolValue(PropOffsets_Actor.bRandomFrame); }
-	BitfieldBool bReplicateInstigator() { return BoolValue(PropOffsets_Actor.bReplicateInstigator); }
-	BitfieldBool bRotateToDesired() { return BoolValue(PropOffsets_Actor.bRotateToDesired); }
-	BitfieldBool bScriptInitialized() { return BoolValue(PropOffsets_Actor.bScriptInitialized); }
-	BitfieldBool bSelected() { return BoolValue(PropOffsets_Actor.bSelected); }
-	BitfieldBool bShadowCast() { return BoolValue(PropOffsets_Actor.bShadowCast); }
-	BitfieldBool bSimFall() { return BoolValue(PropOffsets_Actor.bSimFall); }
-	BitfieldBool bSimulatedPawn() { return BoolValue(PropOffsets_Actor.bSimulatedPawn); }
-	BitfieldBool bSinglePlayer() { return BoolValue(PropOffsets_Actor.bSinglePlayer); }
-	BitfieldBool bSpecialLit() { return BoolValue(PropOffsets_Actor.bSpecialLit); }
-	BitfieldBool bStasis() { return BoolValue(PropOffsets_Actor.bStasis); }
-	BitfieldBool bStatic() { return BoolValue(PropOffsets_Actor.bStatic); }
-	BitfieldBool bTempEditor() { return BoolValue(PropOffsets_Actor.bTempEditor); }
-	BitfieldBool bTicked() { return BoolValue(PropOffsets_Actor.bTicked); }
-	BitfieldBool bTimerLoop() { return BoolValue(PropOffsets_Actor.bTimerLoop); }
-	BitfieldBool bTrailerPrePivot() { return BoolValue(PropOffsets_Actor.bTrailerPrePivot); }
-	BitfieldBool bTrailerSameRotation() { return BoolValue(PropOffsets_Actor.bTrailerSameRotation); }
-	BitfieldBool bTravel() { return BoolValue(PropOffsets_Actor.bTravel); }
-	BitfieldBool bUnlit() { return BoolValue(PropOffsets_Actor.bUnlit); }
+	PROPERTY_VALUE(UAnimation*, SkelAnim, PropOffsets_Actor.SkelAnim)
+	PROPERTY_VALUE(UTexture*, Skin, PropOffsets_Actor.Skin)
+	PROPERTY_VALUE(uint8_t, SoundPitch, PropOffsets_Actor.SoundPitch)
+	PROPERTY_VALUE(uint8_t, SoundRadius, PropOffsets_Actor.SoundRadius)
+	PROPERTY_VALUE(uint8_t, SoundVolume, PropOffsets_Actor.SoundVolume)
+	PROPERTY_VALUE(int, SpecialTag, PropOffsets_Actor.SpecialTag)
+	PROPERTY_VALUE(UTexture*, Sprite, PropOffsets_Actor.Sprite)
+	PROPERTY_VALUE(float, SpriteProjForward, PropOffsets_Actor.SpriteProjForward)
+	PROPERTY_VALUE(uint8_t, StandingCount, PropOffsets_Actor.StandingCount)
+	PROPERTY_VALUE(uint8_t, Style, PropOffsets_Actor.Style)
+	PROPERTY_VALUE(NameString, Tag, PropOffsets_Actor.Tag)
+	PROPERTY_VALUE(UActor*, Target, PropOffsets_Actor.Target)
+	PROPERTY_VALUE(UTexture*, Texture, PropOffsets_Actor.Texture)
+	PROPERTY_VALUE(float, TimerCounter, PropOffsets_Actor.TimerCounter)
+	PROPERTY_VALUE(float, TimerRate, PropOffsets_Actor.TimerRate)
+	PROPERTY_FIXEDARRAY(UActor*, Touching, PropOffsets_Actor.Touching)
+	PROPERTY_VALUE(float, TransientSoundRadius, PropOffsets_Actor.TransientSoundRadius)
+	PROPERTY_VALUE(float, TransientSoundVolume, PropOffsets_Actor.TransientSoundVolume)
+	PROPERTY_VALUE(float, TweenRate, PropOffsets_Actor.TweenRate)
+	PROPERTY_VALUE(vec3, Velocity, PropOffsets_Actor.Velocity)
+	PROPERTY_VALUE(float, VisibilityHeight, PropOffsets_Actor.VisibilityHeight)
+	PROPERTY_VALUE(float, VisibilityRadius, PropOffsets_Actor.VisibilityRadius)
+	PROPERTY_VALUE(uint8_t, VolumeBrightness, PropOffsets_Actor.VolumeBrightness)
+	PROPERTY_VALUE(uint8_t, VolumeFog, PropOffsets_Actor.VolumeFog)
+	PROPERTY_VALUE(uint8_t, VolumeRadius, PropOffsets_Actor.VolumeRadius)
+	PROPERTY_VALUE(ULevel*, XLevel, PropOffsets_Actor.XLevel)
+	PROPERTY_BOOL(bActorShadows, PropOffsets_Actor.bActorShadows)
+	PROPERTY_BOOL(bAlwaysRelevant, PropOffsets_Actor.bAlwaysRelevant)
+	PROPERTY_BOOL(bAlwaysTick, PropOffsets_Actor.bAlwaysTick)
+	PROPERTY_BOOL(bAnimByOwner, PropOffsets_Actor.bAnimByOwner)
+	PROPERTY_BOOL(bAnimFinished, PropOffsets_Actor.bAnimFinished)
+	PROPERTY_BOOL(bAnimLoop, PropOffsets_Actor.bAnimLoop)
+	PROPERTY_BOOL(bAnimNotify, PropOffsets_Actor.bAnimNotify)
+	PROPERTY_BOOL(bAssimilated, PropOffsets_Actor.bAssimilated)
+	PROPERTY_BOOL(bBlockActors, PropOffsets_Actor.bBlockActors)
+	PROPERTY_BOOL(bBlockPlayers, PropOffsets_Actor.bBlockPlayers)
+	PROPERTY_BOOL(bBounce, PropOffsets_Actor.bBounce)
+	PROPERTY_BOOL(bCanTeleport, PropOffsets_Actor.bCanTeleport)
+	PROPERTY_BOOL(bCarriedItem, PropOffsets_Actor.bCarriedItem)
+	PROPERTY_BOOL(bClientAnim, PropOffsets_Actor.bClientAnim)
+	PROPERTY_BOOL(bClientDemoNetFunc, PropOffsets_Actor.bClientDemoNetFunc)
+	PROPERTY_BOOL(bClientDemoRecording, PropOffsets_Actor.bClientDemoRecording)
+	PROPERTY_BOOL(bCollideActors, PropOffsets_Actor.bCollideActors)
+	PROPERTY_BOOL(bCollideWhenPlacing, PropOffsets_Actor.bCollideWhenPlacing)
+	PROPERTY_BOOL(bCollideWorld, PropOffsets_Actor.bCollideWorld)
+	PROPERTY_BOOL(bCorona, PropOffsets_Actor.bCorona)
+	PROPERTY_BOOL(bDeleteMe, PropOffsets_Actor.bDeleteMe)
+	PROPERTY_BOOL(bDemoRecording, PropOffsets_Actor.bDemoRecording)
+	PROPERTY_BOOL(bDifficulty0, PropOffsets_Actor.bDifficulty0)
+	PROPERTY_BOOL(bDifficulty1, PropOffsets_Actor.bDifficulty1)
+	PROPERTY_BOOL(bDifficulty2, PropOffsets_Actor.bDifficulty2)
+	PROPERTY_BOOL(bDifficulty3, PropOffsets_Actor.bDifficulty3)
+	PROPERTY_BOOL(bDirectional, PropOffsets_Actor.bDirectional)
+	PROPERTY_BOOL(bDynamicLight, PropOffsets_Actor.bDynamicLight)
+	PROPERTY_BOOL(bEdLocked, PropOffsets_Actor.bEdLocked)
+	PROPERTY_BOOL(bEdShouldSnap, PropOffsets_Actor.bEdShouldSnap)
+	PROPERTY_BOOL(bEdSnap, PropOffsets_Actor.bEdSnap)
+	PROPERTY_BOOL(bFilterByVolume, PropOffsets_Actor.bFilterByVolume)
+	PROPERTY_BOOL(bFixedRotationDir, PropOffsets_Actor.bFixedRotationDir)
+	PROPERTY_BOOL(bForcePhysicsUpdate, PropOffsets_Actor.bForcePhysicsUpdate)
+	PROPERTY_BOOL(bForceStasis, PropOffsets_Actor.bForceStasis)
+	PROPERTY_BOOL(bGameRelevant, PropOffsets_Actor.bGameRelevant)
+	PROPERTY_BOOL(bHidden, PropOffsets_Actor.bHidden)
+	PROPERTY_BOOL(bHiddenEd, PropOffsets_Actor.bHiddenEd)
+	PROPERTY_BOOL(bHighDetail, PropOffsets_Actor.bHighDetail)
+	PROPERTY_BOOL(bHighlighted, PropOffsets_Actor.bHighlighted)
+	PROPERTY_BOOL(bHurtEntry, PropOffsets_Actor.bHurtEntry)
+	PROPERTY_BOOL(bInterpolating, PropOffsets_Actor.bInterpolating)
+	PROPERTY_BOOL(bIsItemGoal, PropOffsets_Actor.bIsItemGoal)
+	PROPERTY_BOOL(bIsKillGoal, PropOffsets_Actor.bIsKillGoal)
+	PROPERTY_BOOL(bIsMover, PropOffsets_Actor.bIsMover)
+	PROPERTY_BOOL(bIsPawn, PropOffsets_Actor.bIsPawn)
+	PROPERTY_BOOL(bIsSecretGoal, PropOffsets_Actor.bIsSecretGoal)
+	PROPERTY_BOOL(bJustTeleported, PropOffsets_Actor.bJustTeleported)
+	PROPERTY_BOOL(bLensFlare, PropOffsets_Actor.bLensFlare)
+	PROPERTY_BOOL(bLightChanged, PropOffsets_Actor.bLightChanged)
+	PROPERTY_BOOL(bMemorized, PropOffsets_Actor.bMemorized)
+	PROPERTY_BOOL(bMeshCurvy, PropOffsets_Actor.bMeshCurvy)
+	PROPERTY_BOOL(bMeshEnviroMap, PropOffsets_Actor.bMeshEnviroMap)
+	PROPERTY_BOOL(bMovable, PropOffsets_Actor.bMovable)
+	PROPERTY_BOOL(bNet, PropOffsets_Actor.bNet)
+	PROPERTY_BOOL(bNetFeel, PropOffsets_Actor.bNetFeel)
+	PROPERTY_BOOL(bNetHear, PropOffsets_Actor.bNetHear)
+	PROPERTY_BOOL(bNetInitial, PropOffsets_Actor.bNetInitial)
+	PROPERTY_BOOL(bNetOptional, PropOffsets_Actor.bNetOptional)
+	PROPERTY_BOOL(bNetOwner, PropOffsets_Actor.bNetOwner)
+	PROPERTY_BOOL(bNetRelevant, PropOffsets_Actor.bNetRelevant)
+	PROPERTY_BOOL(bNetSee, PropOffsets_Actor.bNetSee)
+	PROPERTY_BOOL(bNetSpecial, PropOffsets_Actor.bNetSpecial)
+	PROPERTY_BOOL(bNetTemporary, PropOffsets_Actor.bNetTemporary)
+	PROPERTY_BOOL(bNoDelete, PropOffsets_Actor.bNoDelete)
+	PROPERTY_BOOL(bNoSmooth, PropOffsets_Actor.bNoSmooth)
+	PROPERTY_BOOL(bOnlyOwnerSee, PropOffsets_Actor.bOnlyOwnerSee)
+	PROPERTY_BOOL(bOwnerNoSee, PropOffsets_Actor.bOwnerNoSee)
+	PROPERTY_BOOL(bParticles, PropOffsets_Actor.bParticles)
+	PROPERTY_BOOL(bProjTarget, PropOffsets_Actor.bProjTarget)
+	PROPERTY_BOOL(bRandomFrame, PropOffsets_Actor.bRandomFrame)
+	PROPERTY_BOOL(bReplicateInstigator, PropOffsets_Actor.bReplicateInstigator)
+	PROPERTY_BOOL(bRotateToDesired, PropOffsets_Actor.bRotateToDesired)
+	PROPERTY_BOOL(bScriptInitialized, PropOffsets_Actor.bScriptInitialized)
+	PROPERTY_BOOL(bSelected, PropOffsets_Actor.bSelected)
+	PROPERTY_BOOL(bShadowCast, PropOffsets_Actor.bShadowCast)
+	PROPERTY_BOOL(bSimFall, PropOffsets_Actor.bSimFall)
+	PROPERTY_BOOL(bSimulatedPawn, PropOffsets_Actor.bSimulatedPawn)
+	PROPERTY_BOOL(bSinglePlayer, PropOffsets_Actor.bSinglePlayer)
+	PROPERTY_BOOL(bSpecialLit, PropOffsets_Actor.bSpecialLit)
+	PROPERTY_BOOL(bStasis, PropOffsets_Actor.bStasis)
+	PROPERTY_BOOL(bStatic, PropOffsets_Actor.bStatic)
+	PROPERTY_BOOL(bTempEditor, PropOffsets_Actor.bTempEditor)
+	PROPERTY_BOOL(bTicked, PropOffsets_Actor.bTicked)
+	PROPERTY_BOOL(bTimerLoop, PropOffsets_Actor.bTimerLoop)
+	PROPERTY_BOOL(bTrailerPrePivot, PropOffsets_Actor.bTrailerPrePivot)
+	PROPERTY_BOOL(bTrailerSameRotation, PropOffsets_Actor.bTrailerSameRotation)
+	PROPERTY_BOOL(bTravel, PropOffsets_Actor.bTravel)
+	PROPERTY_BOOL(bUnlit, PropOffsets_Actor.bUnlit)
 };
 
 class ULight : public UActor
@@ -494,9 +493,9 @@ public:
 	UObject* AttachDecal(float traceDistance, const vec3& decalDir);
 	void DetachDecal();
 
-	float& LastRenderedTime() { return Value<float>(PropOffsets_Decal.LastRenderedTime); }
-	int& MultiDecalLevel() { return Value<int>(PropOffsets_Decal.MultiDecalLevel); }
-	Array<void*>& SurfList() { return Value<Array<void*>>(PropOffsets_Decal.SurfList); }
+	PROPERTY_VALUE(float, LastRenderedTime, PropOffsets_Decal.LastRenderedTime)
+	PROPERTY_VALUE(int, MultiDecalLevel, PropOffsets_Decal.MultiDecalLevel)
+	PROPERTY_VALUE(Array<void*>, SurfList, PropOffsets_Decal.SurfList)
 };
 
 class USpawnNotify : public UActor
@@ -504,8 +503,8 @@ class USpawnNotify : public UActor
 public:
 	using UActor::UActor;
 
-	UClass*& ActorClass() { return Value<UClass*>(PropOffsets_SpawnNotify.ActorClass); }
-	USpawnNotify*& Next() { return Value<USpawnNotify*>(PropOffsets_SpawnNotify.Next); }
+	PROPERTY_VALUE(UClass*, ActorClass, PropOffsets_SpawnNotify.ActorClass)
+	PROPERTY_VALUE(USpawnNotify*, Next, PropOffsets_SpawnNotify.Next)
 };
 
 class UInventory : public UActor
@@ -513,61 +512,61 @@ class UInventory : public UActor
 public:
 	using UActor::UActor;
 
-	int& AbsorptionPriority() { return Value<int>(PropOffsets_Inventory.AbsorptionPriority); }
-	USound*& ActivateSound() { return Value<USound*>(PropOffsets_Inventory.ActivateSound); }
-	int& ArmorAbsorption() { return Value<int>(PropOffsets_Inventory.ArmorAbsorption); }
-	uint8_t& AutoSwitchPriority() { return Value<uint8_t>(PropOffsets_Inventory.AutoSwitchPriority); }
-	float& BobDamping() { return Value<float>(PropOffsets_Inventory.BobDamping); }
-	int& Charge() { return Value<int>(PropOffsets_Inventory.Charge); }
-	USound*& DeActivateSound() { return Value<USound*>(PropOffsets_Inventory.DeActivateSound); }
-	uint8_t& FlashCount() { return Value<uint8_t>(PropOffsets_Inventory.FlashCount); }
-	UTexture*& Icon() { return Value<UTexture*>(PropOffsets_Inventory.Icon); }
-	uint8_t& InventoryGroup() { return Value<uint8_t>(PropOffsets_Inventory.InventoryGroup); }
-	std::string& ItemArticle() { return Value<std::string>(PropOffsets_Inventory.ItemArticle); }
-	UClass*& ItemMessageClass() { return Value<UClass*>(PropOffsets_Inventory.ItemMessageClass); }
-	std::string& ItemName() { return Value<std::string>(PropOffsets_Inventory.ItemName); }
-	std::string& M_Activated() { return Value<std::string>(PropOffsets_Inventory.M_Activated); }
-	std::string& M_Deactivated() { return Value<std::string>(PropOffsets_Inventory.M_Deactivated); }
-	std::string& M_Selected() { return Value<std::string>(PropOffsets_Inventory.M_Selected); }
-	float& MaxDesireability() { return Value<float>(PropOffsets_Inventory.MaxDesireability); }
-	UMesh*& MuzzleFlashMesh() { return Value<UMesh*>(PropOffsets_Inventory.MuzzleFlashMesh); }
-	float& MuzzleFlashScale() { return Value<float>(PropOffsets_Inventory.MuzzleFlashScale); }
-	uint8_t& MuzzleFlashStyle() { return Value<uint8_t>(PropOffsets_Inventory.MuzzleFlashStyle); }
-	UTexture*& MuzzleFlashTexture() { return Value<UTexture*>(PropOffsets_Inventory.MuzzleFlashTexture); }
-	UInventory*& NextArmor() { return Value<UInventory*>(PropOffsets_Inventory.NextArmor); }
-	uint8_t& OldFlashCount() { return Value<uint8_t>(PropOffsets_Inventory.OldFlashCount); }
-	std::string& PickupMessage() { return Value<std::string>(PropOffsets_Inventory.PickupMessage); }
-	UClass*& PickupMessageClass() { return Value<UClass*>(PropOffsets_Inventory.PickupMessageClass); }
-	USound*& PickupSound() { return Value<USound*>(PropOffsets_Inventory.PickupSound); }
-	UMesh*& PickupViewMesh() { return Value<UMesh*>(PropOffsets_Inventory.PickupViewMesh); }
-	float& PickupViewScale() { return Value<float>(PropOffsets_Inventory.PickupViewScale); }
-	NameString& PlayerLastTouched() { return Value<NameString>(PropOffsets_Inventory.PlayerLastTouched); }
-	UMesh*& PlayerViewMesh() { return Value<UMesh*>(PropOffsets_Inventory.PlayerViewMesh); }
-	vec3& PlayerViewOffset() { return Value<vec3>(PropOffsets_Inventory.PlayerViewOffset); }
-	float& PlayerViewScale() { return Value<float>(PropOffsets_Inventory.PlayerViewScale); }
-	NameString& ProtectionType1() { return Value<NameString>(PropOffsets_Inventory.ProtectionType1); }
-	NameString& ProtectionType2() { return Value<NameString>(PropOffsets_Inventory.ProtectionType2); }
-	USound*& RespawnSound() { return Value<USound*>(PropOffsets_Inventory.RespawnSound); }
-	float& RespawnTime() { return Value<float>(PropOffsets_Inventory.RespawnTime); }
-	UTexture*& StatusIcon() { return Value<UTexture*>(PropOffsets_Inventory.StatusIcon); }
-	UMesh*& ThirdPersonMesh() { return Value<UMesh*>(PropOffsets_Inventory.ThirdPersonMesh); }
-	float& ThirdPersonScale() { return Value<float>(PropOffsets_Inventory.ThirdPersonScale); }
-	BitfieldBool bActivatable() { return BoolValue(PropOffsets_Inventory.bActivatable); }
-	BitfieldBool bActive() { return BoolValue(PropOffsets_Inventory.bActive); }
-	BitfieldBool bAmbientGlow() { return BoolValue(PropOffsets_Inventory.bAmbientGlow); }
-	BitfieldBool bDisplayableInv() { return BoolValue(PropOffsets_Inventory.bDisplayableInv); }
-	BitfieldBool bFirstFrame() { return BoolValue(PropOffsets_Inventory.bFirstFrame); }
-	BitfieldBool bHeldItem() { return BoolValue(PropOffsets_Inventory.bHeldItem); }
-	BitfieldBool bInstantRespawn() { return BoolValue(PropOffsets_Inventory.bInstantRespawn); }
-	BitfieldBool bIsAnArmor() { return BoolValue(PropOffsets_Inventory.bIsAnArmor); }
-	BitfieldBool bMuzzleFlashParticles() { return BoolValue(PropOffsets_Inventory.bMuzzleFlashParticles); }
-	BitfieldBool bRotatingPickup() { return BoolValue(PropOffsets_Inventory.bRotatingPickup); }
-	BitfieldBool bSleepTouch() { return BoolValue(PropOffsets_Inventory.bSleepTouch); }
-	BitfieldBool bSteadyFlash3rd() { return BoolValue(PropOffsets_Inventory.bSteadyFlash3rd); }
-	BitfieldBool bSteadyToggle() { return BoolValue(PropOffsets_Inventory.bSteadyToggle); }
-	BitfieldBool bToggleSteadyFlash() { return BoolValue(PropOffsets_Inventory.bToggleSteadyFlash); }
-	BitfieldBool bTossedOut() { return BoolValue(PropOffsets_Inventory.bTossedOut); }
-	UInventorySpot*& myMarker() { return Value<UInventorySpot*>(PropOffsets_Inventory.myMarker); }
+	PROPERTY_VALUE(int, AbsorptionPriority, PropOffsets_Inventory.AbsorptionPriority)
+	PROPERTY_VALUE(USound*, ActivateSound, PropOffsets_Inventory.ActivateSound)
+	PROPERTY_VALUE(int, ArmorAbsorption, PropOffsets_Inventory.ArmorAbsorption)
+	PROPERTY_VALUE(uint8_t, AutoSwitchPriority, PropOffsets_Inventory.AutoSwitchPriority)
+	PROPERTY_VALUE(float, BobDamping, PropOffsets_Inventory.BobDamping)
+	PROPERTY_VALUE(int, Charge, PropOffsets_Inventory.Charge)
+	PROPERTY_VALUE(USound*, DeActivateSound, PropOffsets_Inventory.DeActivateSound)
+	PROPERTY_VALUE(uint8_t, FlashCount, PropOffsets_Inventory.FlashCount)
+	PROPERTY_VALUE(UTexture*, Icon, PropOffsets_Inventory.Icon)
+	PROPERTY_VALUE(uint8_t, InventoryGroup, PropOffsets_Inventory.InventoryGroup)
+	PROPERTY_VALUE(std::string, ItemArticle, PropOffsets_Inventory.ItemArticle)
+	PROPERTY_VALUE(UClass*, ItemMessageClass, PropOffsets_Inventory.ItemMessageClass)
+	PROPERTY_VALUE(std::string, ItemName, PropOffsets_Inventory.ItemName)
+	PROPERTY_VALUE(std::string, M_Activated, PropOffsets_Inventory.M_Activated)
+	PROPERTY_VALUE(std::string, M_Deactivated, PropOffsets_Inventory.M_Deactivated)
+	PROPERTY_VALUE(std::string, M_Selected, PropOffsets_Inventory.M_Selected)
+	PROPERTY_VALUE(float, MaxDesireability, PropOffsets_Inventory.MaxDesireability)
+	PROPERTY_VALUE(UMesh*, MuzzleFlashMesh, PropOffsets_Inventory.MuzzleFlashMesh)
+	PROPERTY_VALUE(float, MuzzleFlashScale, PropOffsets_Inventory.MuzzleFlashScale)
+	PROPERTY_VALUE(uint8_t, MuzzleFlashStyle, PropOffsets_Inventory.MuzzleFlashStyle)
+	PROPERTY_VALUE(UTexture*, MuzzleFlashTexture, PropOffsets_Inventory.MuzzleFlashTexture)
+	PROPERTY_VALUE(UInventory*, NextArmor, PropOffsets_Inventory.NextArmor)
+	PROPERTY_VALUE(uint8_t, OldFlashCount, PropOffsets_Inventory.OldFlashCount)
+	PROPERTY_VALUE(std::string, PickupMessage, PropOffsets_Inventory.PickupMessage)
+	PROPERTY_VALUE(UClass*, PickupMessageClass, PropOffsets_Inventory.PickupMessageClass)
+	PROPERTY_VALUE(USound*, PickupSound, PropOffsets_Inventory.PickupSound)
+	PROPERTY_VALUE(UMesh*, PickupViewMesh, PropOffsets_Inventory.PickupViewMesh)
+	PROPERTY_VALUE(float, PickupViewScale, PropOffsets_Inventory.PickupViewScale)
+	PROPERTY_VALUE(NameString, PlayerLastTouched, PropOffsets_Inventory.PlayerLastTouched)
+	PROPERTY_VALUE(UMesh*, PlayerViewMesh, PropOffsets_Inventory.PlayerViewMesh)
+	PROPERTY_VALUE(vec3, PlayerViewOffset, PropOffsets_Inventory.PlayerViewOffset)
+	PROPERTY_VALUE(float, PlayerViewScale, PropOffsets_Inventory.PlayerViewScale)
+	PROPERTY_VALUE(NameString, ProtectionType1, PropOffsets_Inventory.ProtectionType1)
+	PROPERTY_VALUE(NameString, ProtectionType2, PropOffsets_Inventory.ProtectionType2)
+	PROPERTY_VALUE(USound*, RespawnSound, PropOffsets_Inventory.RespawnSound)
+	PROPERTY_VALUE(float, RespawnTime, PropOffsets_Inventory.RespawnTime)
+	PROPERTY_VALUE(UTexture*, StatusIcon, PropOffsets_Inventory.StatusIcon)
+	PROPERTY_VALUE(UMesh*, ThirdPersonMesh, PropOffsets_Inventory.ThirdPersonMesh)
+	PROPERTY_VALUE(float, ThirdPersonScale, PropOffsets_Inventory.ThirdPersonScale)
+	PROPERTY_BOOL(bActivatable, PropOffsets_Inventory.bActivatable)
+	PROPERTY_BOOL(bActive, PropOffsets_Inventory.bActive)
+	PROPERTY_BOOL(bAmbientGlow, PropOffsets_Inventory.bAmbientGlow)
+	PROPERTY_BOOL(bDisplayableInv, PropOffsets_Inventory.bDisplayableInv)
+	PROPERTY_BOOL(bFirstFrame, PropOffsets_Inventory.bFirstFrame)
+	PROPERTY_BOOL(bHeldItem, PropOffsets_Inventory.bHeldItem)
+	PROPERTY_BOOL(bInstantRespawn, PropOffsets_Inventory.bInstantRespawn)
+	PROPERTY_BOOL(bIsAnArmor, PropOffsets_Inventory.bIsAnArmor)
+	PROPERTY_BOOL(bMuzzleFlashParticles, PropOffsets_Inventory.bMuzzleFlashParticles)
+	PROPERTY_BOOL(bRotatingPickup, PropOffsets_Inventory.bRotatingPickup)
+	PROPERTY_BOOL(bSleepTouch, PropOffsets_Inventory.bSleepTouch)
+	PROPERTY_BOOL(bSteadyFlash3rd, PropOffsets_Inventory.bSteadyFlash3rd)
+	PROPERTY_BOOL(bSteadyToggle, PropOffsets_Inventory.bSteadyToggle)
+	PROPERTY_BOOL(bToggleSteadyFlash, PropOffsets_Inventory.bToggleSteadyFlash)
+	PROPERTY_BOOL(bTossedOut, PropOffsets_Inventory.bTossedOut)
+	PROPERTY_VALUE(UInventorySpot*, myMarker, PropOffsets_Inventory.myMarker)
 };
 
 class UWeapon : public UInventory
@@ -575,68 +574,68 @@ class UWeapon : public UInventory
 public:
 	using UInventory::UInventory;
 
-	float& AIRating() { return Value<float>(PropOffsets_Weapon.AIRating); }
-	Rotator& AdjustedAim() { return Value<Rotator>(PropOffsets_Weapon.AdjustedAim); }
-	NameString& AltDamageType() { return Value<NameString>(PropOffsets_Weapon.AltDamageType); }
-	USound*& AltFireSound() { return Value<USound*>(PropOffsets_Weapon.AltFireSound); }
-	UClass*& AltProjectileClass() { return Value<UClass*>(PropOffsets_Weapon.AltProjectileClass); }
-	float& AltProjectileSpeed() { return Value<float>(PropOffsets_Weapon.AltProjectileSpeed); }
-	float& AltRefireRate() { return Value<float>(PropOffsets_Weapon.AltRefireRate); }
-	UClass*& AmmoName() { return Value<UClass*>(PropOffsets_Weapon.AmmoName); }
+	PROPERTY_VALUE(float, AIRating, PropOffsets_Weapon.AIRating)
+	PROPERTY_VALUE(Rotator, AdjustedAim, PropOffsets_Weapon.AdjustedAim)
+	PROPERTY_VALUE(NameString, AltDamageType, PropOffsets_Weapon.AltDamageType)
+	PROPERTY_VALUE(USound*, AltFireSound, PropOffsets_Weapon.AltFireSound)
+	PROPERTY_VALUE(UClass*, AltProjectileClass, PropOffsets_Weapon.AltProjectileClass)
+	PROPERTY_VALUE(float, AltProjectileSpeed, PropOffsets_Weapon.AltProjectileSpeed)
+	PROPERTY_VALUE(float, AltRefireRate, PropOffsets_Weapon.AltRefireRate)
+	PROPERTY_VALUE(UClass*, AmmoName, PropOffsets_Weapon.AmmoName)
 	//UAmmo*& AmmoType() { return Value<UAmmo*>(PropOffsets_Weapon.AmmoType); }
-	USound*& CockingSound() { return Value<USound*>(PropOffsets_Weapon.CockingSound); }
-	std::string& DeathMessage() { return Value<std::string>(PropOffsets_Weapon.DeathMessage); }
-	vec3& FireOffset() { return Value<vec3>(PropOffsets_Weapon.FireOffset); }
-	USound*& FireSound() { return Value<USound*>(PropOffsets_Weapon.FireSound); }
-	float& FiringSpeed() { return Value<float>(PropOffsets_Weapon.FiringSpeed); }
-	float& FlareOffset() { return Value<float>(PropOffsets_Weapon.FlareOffset); }
-	float& FlashC() { return Value<float>(PropOffsets_Weapon.FlashC); }
-	float& FlashLength() { return Value<float>(PropOffsets_Weapon.FlashLength); }
-	float& FlashO() { return Value<float>(PropOffsets_Weapon.FlashO); }
-	int& FlashS() { return Value<int>(PropOffsets_Weapon.FlashS); }
-	float& FlashTime() { return Value<float>(PropOffsets_Weapon.FlashTime); }
-	float& FlashY() { return Value<float>(PropOffsets_Weapon.FlashY); }
-	UTexture*& MFTexture() { return Value<UTexture*>(PropOffsets_Weapon.MFTexture); }
-	float& MaxTargetRange() { return Value<float>(PropOffsets_Weapon.MaxTargetRange); }
-	std::string& MessageNoAmmo() { return Value<std::string>(PropOffsets_Weapon.MessageNoAmmo); }
-	USound*& Misc1Sound() { return Value<USound*>(PropOffsets_Weapon.Misc1Sound); }
-	USound*& Misc2Sound() { return Value<USound*>(PropOffsets_Weapon.Misc2Sound); }
-	USound*& Misc3Sound() { return Value<USound*>(PropOffsets_Weapon.Misc3Sound); }
-	UTexture*& MuzzleFlare() { return Value<UTexture*>(PropOffsets_Weapon.MuzzleFlare); }
-	float& MuzzleScale() { return Value<float>(PropOffsets_Weapon.MuzzleScale); }
-	NameString& MyDamageType() { return Value<NameString>(PropOffsets_Weapon.MyDamageType); }
-	Color& NameColor() { return Value<Color>(PropOffsets_Weapon.NameColor); }
-	int& PickupAmmoCount() { return Value<int>(PropOffsets_Weapon.PickupAmmoCount); }
-	UClass*& ProjectileClass() { return Value<UClass*>(PropOffsets_Weapon.ProjectileClass); }
-	float& ProjectileSpeed() { return Value<float>(PropOffsets_Weapon.ProjectileSpeed); }
-	float& RefireRate() { return Value<float>(PropOffsets_Weapon.RefireRate); }
-	uint8_t& ReloadCount() { return Value<uint8_t>(PropOffsets_Weapon.ReloadCount); }
-	USound*& SelectSound() { return Value<USound*>(PropOffsets_Weapon.SelectSound); }
-	float& aimerror() { return Value<float>(PropOffsets_Weapon.aimerror); }
-	BitfieldBool bAltInstantHit() { return BoolValue(PropOffsets_Weapon.bAltInstantHit); }
-	BitfieldBool bAltWarnTarget() { return BoolValue(PropOffsets_Weapon.bAltWarnTarget); }
-	BitfieldBool bCanThrow() { return BoolValue(PropOffsets_Weapon.bCanThrow); }
-	BitfieldBool bChangeWeapon() { return BoolValue(PropOffsets_Weapon.bChangeWeapon); }
-	BitfieldBool bDrawMuzzleFlash() { return BoolValue(PropOffsets_Weapon.bDrawMuzzleFlash); }
-	BitfieldBool bHideWeapon() { return BoolValue(PropOffsets_Weapon.bHideWeapon); }
-	BitfieldBool bInstantHit() { return BoolValue(PropOffsets_Weapon.bInstantHit); }
-	BitfieldBool bLockedOn() { return BoolValue(PropOffsets_Weapon.bLockedOn); }
-	BitfieldBool bMeleeWeapon() { return BoolValue(PropOffsets_Weapon.bMeleeWeapon); }
-	uint8_t& bMuzzleFlash() { return Value<uint8_t>(PropOffsets_Weapon.bMuzzleFlash); }
-	BitfieldBool bOwnsCrosshair() { return BoolValue(PropOffsets_Weapon.bOwnsCrosshair); }
-	BitfieldBool bPointing() { return BoolValue(PropOffsets_Weapon.bPointing); }
-	BitfieldBool bRapidFire() { return BoolValue(PropOffsets_Weapon.bRapidFire); }
-	BitfieldBool bRecommendAltSplashDamage() { return BoolValue(PropOffsets_Weapon.bRecommendAltSplashDamage); }
-	BitfieldBool bRecommendSplashDamage() { return BoolValue(PropOffsets_Weapon.bRecommendSplashDamage); }
-	BitfieldBool bSetFlashTime() { return BoolValue(PropOffsets_Weapon.bSetFlashTime); }
-	BitfieldBool bSpecialIcon() { return BoolValue(PropOffsets_Weapon.bSpecialIcon); }
-	BitfieldBool bSplashDamage() { return BoolValue(PropOffsets_Weapon.bSplashDamage); }
-	BitfieldBool bWarnTarget() { return BoolValue(PropOffsets_Weapon.bWarnTarget); }
-	BitfieldBool bWeaponStay() { return BoolValue(PropOffsets_Weapon.bWeaponStay); }
-	BitfieldBool bWeaponUp() { return BoolValue(PropOffsets_Weapon.bWeaponUp); }
-	float& shakemag() { return Value<float>(PropOffsets_Weapon.shakemag); }
-	float& shaketime() { return Value<float>(PropOffsets_Weapon.shaketime); }
-	float& shakevert() { return Value<float>(PropOffsets_Weapon.shakevert); }
+	PROPERTY_VALUE(USound*, CockingSound, PropOffsets_Weapon.CockingSound)
+	PROPERTY_VALUE(std::string, DeathMessage, PropOffsets_Weapon.DeathMessage)
+	PROPERTY_VALUE(vec3, FireOffset, PropOffsets_Weapon.FireOffset)
+	PROPERTY_VALUE(USound*, FireSound, PropOffsets_Weapon.FireSound)
+	PROPERTY_VALUE(float, FiringSpeed, PropOffsets_Weapon.FiringSpeed)
+	PROPERTY_VALUE(float, FlareOffset, PropOffsets_Weapon.FlareOffset)
+	PROPERTY_VALUE(float, FlashC, PropOffsets_Weapon.FlashC)
+	PROPERTY_VALUE(float, FlashLength, PropOffsets_Weapon.FlashLength)
+	PROPERTY_VALUE(float, FlashO, PropOffsets_Weapon.FlashO)
+	PROPERTY_VALUE(int, FlashS, PropOffsets_Weapon.FlashS)
+	PROPERTY_VALUE(float, FlashTime, PropOffsets_Weapon.FlashTime)
+	PROPERTY_VALUE(float, FlashY, PropOffsets_Weapon.FlashY)
+	PROPERTY_VALUE(UTexture*, MFTexture, PropOffsets_Weapon.MFTexture)
+	PROPERTY_VALUE(float, MaxTargetRange, PropOffsets_Weapon.MaxTargetRange)
+	PROPERTY_VALUE(std::string, MessageNoAmmo, PropOffsets_Weapon.MessageNoAmmo)
+	PROPERTY_VALUE(USound*, Misc1Sound, PropOffsets_Weapon.Misc1Sound)
+	PROPERTY_VALUE(USound*, Misc2Sound, PropOffsets_Weapon.Misc2Sound)
+	PROPERTY_VALUE(USound*, Misc3Sound, PropOffsets_Weapon.Misc3Sound)
+	PROPERTY_VALUE(UTexture*, MuzzleFlare, PropOffsets_Weapon.MuzzleFlare)
+	PROPERTY_VALUE(float, MuzzleScale, PropOffsets_Weapon.MuzzleScale)
+	PROPERTY_VALUE(NameString, MyDamageType, PropOffsets_Weapon.MyDamageType)
+	PROPERTY_VALUE(Color, NameColor, PropOffsets_Weapon.NameColor)
+	PROPERTY_VALUE(int, PickupAmmoCount, PropOffsets_Weapon.PickupAmmoCount)
+	PROPERTY_VALUE(UClass*, ProjectileClass, PropOffsets_Weapon.ProjectileClass)
+	PROPERTY_VALUE(float, ProjectileSpeed, PropOffsets_Weapon.ProjectileSpeed)
+	PROPERTY_VALUE(float, RefireRate, PropOffsets_Weapon.RefireRate)
+	PROPERTY_VALUE(uint8_t, ReloadCount, PropOffsets_Weapon.ReloadCount)
+	PROPERTY_VALUE(USound*, SelectSound, PropOffsets_Weapon.SelectSound)
+	PROPERTY_VALUE(float, aimerror, PropOffsets_Weapon.aimerror)
+	PROPERTY_BOOL(bAltInstantHit, PropOffsets_Weapon.bAltInstantHit)
+	PROPERTY_BOOL(bAltWarnTarget, PropOffsets_Weapon.bAltWarnTarget)
+	PROPERTY_BOOL(bCanThrow, PropOffsets_Weapon.bCanThrow)
+	PROPERTY_BOOL(bChangeWeapon, PropOffsets_Weapon.bChangeWeapon)
+	PROPERTY_BOOL(bDrawMuzzleFlash, PropOffsets_Weapon.bDrawMuzzleFlash)
+	PROPERTY_BOOL(bHideWeapon, PropOffsets_Weapon.bHideWeapon)
+	PROPERTY_BOOL(bInstantHit, PropOffsets_Weapon.bInstantHit)
+	PROPERTY_BOOL(bLockedOn, PropOffsets_Weapon.bLockedOn)
+	PROPERTY_BOOL(bMeleeWeapon, PropOffsets_Weapon.bMeleeWeapon)
+	PROPERTY_VALUE(uint8_t, bMuzzleFlash, PropOffsets_Weapon.bMuzzleFlash)
+	PROPERTY_BOOL(bOwnsCrosshair, PropOffsets_Weapon.bOwnsCrosshair)
+	PROPERTY_BOOL(bPointing, PropOffsets_Weapon.bPointing)
+	PROPERTY_BOOL(bRapidFire, PropOffsets_Weapon.bRapidFire)
+	PROPERTY_BOOL(bRecommendAltSplashDamage, PropOffsets_Weapon.bRecommendAltSplashDamage)
+	PROPERTY_BOOL(bRecommendSplashDamage, PropOffsets_Weapon.bRecommendSplashDamage)
+	PROPERTY_BOOL(bSetFlashTime, PropOffsets_Weapon.bSetFlashTime)
+	PROPERTY_BOOL(bSpecialIcon, PropOffsets_Weapon.bSpecialIcon)
+	PROPERTY_BOOL(bSplashDamage, PropOffsets_Weapon.bSplashDamage)
+	PROPERTY_BOOL(bWarnTarget, PropOffsets_Weapon.bWarnTarget)
+	PROPERTY_BOOL(bWeaponStay, PropOffsets_Weapon.bWeaponStay)
+	PROPERTY_BOOL(bWeaponUp, PropOffsets_Weapon.bWeaponUp)
+	PROPERTY_VALUE(float, shakemag, PropOffsets_Weapon.shakemag)
+	PROPERTY_VALUE(float, shaketime, PropOffsets_Weapon.shaketime)
+	PROPERTY_VALUE(float, shakevert, PropOffsets_Weapon.shakevert)
 };
 
 class UNavigationPoint : public UActor
@@ -644,30 +643,30 @@ class UNavigationPoint : public UActor
 public:
 	using UActor::UActor;
 
-	int& ExtraCost() { return Value<int>(PropOffsets_NavigationPoint.ExtraCost); }
-	int& Paths() { return Value<int>(PropOffsets_NavigationPoint.Paths); }
-	int& PrunedPaths() { return Value<int>(PropOffsets_NavigationPoint.PrunedPaths); }
-	UActor*& RouteCache() { return Value<UActor*>(PropOffsets_NavigationPoint.RouteCache); }
-	UNavigationPoint*& VisNoReachPaths() { return Value<UNavigationPoint*>(PropOffsets_NavigationPoint.VisNoReachPaths); }
-	BitfieldBool bAutoBuilt() { return BoolValue(PropOffsets_NavigationPoint.bAutoBuilt); }
-	BitfieldBool bEndPoint() { return BoolValue(PropOffsets_NavigationPoint.bEndPoint); }
-	BitfieldBool bEndPointOnly() { return BoolValue(PropOffsets_NavigationPoint.bEndPointOnly); }
-	BitfieldBool bNeverUseStrafing() { return BoolValue(PropOffsets_NavigationPoint.bNeverUseStrafing); }
-	BitfieldBool bOneWayPath() { return BoolValue(PropOffsets_NavigationPoint.bOneWayPath); }
-	BitfieldBool bPlayerOnly() { return BoolValue(PropOffsets_NavigationPoint.bPlayerOnly); }
-	BitfieldBool bSpecialCost() { return BoolValue(PropOffsets_NavigationPoint.bSpecialCost); }
-	BitfieldBool bTwoWay() { return BoolValue(PropOffsets_NavigationPoint.bTwoWay); }
-	int& bestPathWeight() { return Value<int>(PropOffsets_NavigationPoint.bestPathWeight); }
-	int& cost() { return Value<int>(PropOffsets_NavigationPoint.cost); }
-	UNavigationPoint*& nextNavigationPoint() { return Value<UNavigationPoint*>(PropOffsets_NavigationPoint.nextNavigationPoint); }
-	UNavigationPoint*& nextOrdered() { return Value<UNavigationPoint*>(PropOffsets_NavigationPoint.nextOrdered); }
-	NameString& ownerTeam() { return Value<NameString>(PropOffsets_NavigationPoint.ownerTeam); }
-	UNavigationPoint*& prevOrdered() { return Value<UNavigationPoint*>(PropOffsets_NavigationPoint.prevOrdered); }
-	UNavigationPoint*& previousPath() { return Value<UNavigationPoint*>(PropOffsets_NavigationPoint.previousPath); }
-	UNavigationPoint*& startPath() { return Value<UNavigationPoint*>(PropOffsets_NavigationPoint.startPath); }
-	BitfieldBool taken() { return BoolValue(PropOffsets_NavigationPoint.taken); }
-	int& upstreamPaths() { return Value<int>(PropOffsets_NavigationPoint.upstreamPaths); }
-	int& visitedWeight() { return Value<int>(PropOffsets_NavigationPoint.visitedWeight); }
+	PROPERTY_VALUE(int, ExtraCost, PropOffsets_NavigationPoint.ExtraCost)
+	PROPERTY_VALUE(int, Paths, PropOffsets_NavigationPoint.Paths)
+	PROPERTY_VALUE(int, PrunedPaths, PropOffsets_NavigationPoint.PrunedPaths)
+	PROPERTY_VALUE(UActor*, RouteCache, PropOffsets_NavigationPoint.RouteCache)
+	PROPERTY_VALUE(UNavigationPoint*, VisNoReachPaths, PropOffsets_NavigationPoint.VisNoReachPaths)
+	PROPERTY_BOOL(bAutoBuilt, PropOffsets_NavigationPoint.bAutoBuilt)
+	PROPERTY_BOOL(bEndPoint, PropOffsets_NavigationPoint.bEndPoint)
+	PROPERTY_BOOL(bEndPointOnly, PropOffsets_NavigationPoint.bEndPointOnly)
+	PROPERTY_BOOL(bNeverUseStrafing, PropOffsets_NavigationPoint.bNeverUseStrafing)
+	PROPERTY_BOOL(bOneWayPath, PropOffsets_NavigationPoint.bOneWayPath)
+	PROPERTY_BOOL(bPlayerOnly, PropOffsets_NavigationPoint.bPlayerOnly)
+	PROPERTY_BOOL(bSpecialCost, PropOffsets_NavigationPoint.bSpecialCost)
+	PROPERTY_BOOL(bTwoWay, PropOffsets_NavigationPoint.bTwoWay)
+	PROPERTY_VALUE(int, bestPathWeight, PropOffsets_NavigationPoint.bestPathWeight)
+	PROPERTY_VALUE(int, cost, PropOffsets_NavigationPoint.cost)
+	PROPERTY_VALUE(UNavigationPoint*, nextNavigationPoint, PropOffsets_NavigationPoint.nextNavigationPoint)
+	PROPERTY_VALUE(UNavigationPoint*, nextOrdered, PropOffsets_NavigationPoint.nextOrdered)
+	PROPERTY_VALUE(NameString, ownerTeam, PropOffsets_NavigationPoint.ownerTeam)
+	PROPERTY_VALUE(UNavigationPoint*, prevOrdered, PropOffsets_NavigationPoint.prevOrdered)
+	PROPERTY_VALUE(UNavigationPoint*, previousPath, PropOffsets_NavigationPoint.previousPath)
+	PROPERTY_VALUE(UNavigationPoint*, startPath, PropOffsets_NavigationPoint.startPath)
+	PROPERTY_BOOL(taken, PropOffsets_NavigationPoint.taken)
+	PROPERTY_VALUE(int, upstreamPaths, PropOffsets_NavigationPoint.upstreamPaths)
+	PROPERTY_VALUE(int, visitedWeight, PropOffsets_NavigationPoint.visitedWeight)
 };
 
 class ULiftExit : public UNavigationPoint
@@ -675,11 +674,11 @@ class ULiftExit : public UNavigationPoint
 public:
 	using UNavigationPoint::UNavigationPoint;
 
-	float& LastTriggerTime() { return Value<float>(PropOffsets_LiftExit.LastTriggerTime); }
-	NameString& LiftTag() { return Value<NameString>(PropOffsets_LiftExit.LiftTag); }
-	NameString& LiftTrigger() { return Value<NameString>(PropOffsets_LiftExit.LiftTrigger); }
-	UMover*& MyLift() { return Value<UMover*>(PropOffsets_LiftExit.MyLift); }
-	UTrigger*& RecommendedTrigger() { return Value<UTrigger*>(PropOffsets_LiftExit.RecommendedTrigger); }
+	PROPERTY_VALUE(float, LastTriggerTime, PropOffsets_LiftExit.LastTriggerTime)
+	PROPERTY_VALUE(NameString, LiftTag, PropOffsets_LiftExit.LiftTag)
+	PROPERTY_VALUE(NameString, LiftTrigger, PropOffsets_LiftExit.LiftTrigger)
+	PROPERTY_VALUE(UMover*, MyLift, PropOffsets_LiftExit.MyLift)
+	PROPERTY_VALUE(UTrigger*, RecommendedTrigger, PropOffsets_LiftExit.RecommendedTrigger)
 };
 
 class ULiftCenter : public UNavigationPoint
@@ -687,14 +686,14 @@ class ULiftCenter : public UNavigationPoint
 public:
 	using UNavigationPoint::UNavigationPoint;
 
-	float& LastTriggerTime() { return Value<float>(PropOffsets_LiftCenter.LastTriggerTime); }
-	vec3& LiftOffset() { return Value<vec3>(PropOffsets_LiftCenter.LiftOffset); }
-	NameString& LiftTag() { return Value<NameString>(PropOffsets_LiftCenter.LiftTag); }
-	NameString& LiftTrigger() { return Value<NameString>(PropOffsets_LiftCenter.LiftTrigger); }
-	float& MaxDist2D() { return Value<float>(PropOffsets_LiftCenter.MaxDist2D); }
-	float& MaxZDiffAdd() { return Value<float>(PropOffsets_LiftCenter.MaxZDiffAdd); }
-	UMover*& MyLift() { return Value<UMover*>(PropOffsets_LiftCenter.MyLift); }
-	UTrigger*& RecommendedTrigger() { return Value<UTrigger*>(PropOffsets_LiftCenter.RecommendedTrigger); }
+	PROPERTY_VALUE(float, LastTriggerTime, PropOffsets_LiftCenter.LastTriggerTime)
+	PROPERTY_VALUE(vec3, LiftOffset, PropOffsets_LiftCenter.LiftOffset)
+	PROPERTY_VALUE(NameString, LiftTag, PropOffsets_LiftCenter.LiftTag)
+	PROPERTY_VALUE(NameString, LiftTrigger, PropOffsets_LiftCenter.LiftTrigger)
+	PROPERTY_VALUE(float, MaxDist2D, PropOffsets_LiftCenter.MaxDist2D)
+	PROPERTY_VALUE(float, MaxZDiffAdd, PropOffsets_LiftCenter.MaxZDiffAdd)
+	PROPERTY_VALUE(UMover*, MyLift, PropOffsets_LiftCenter.MyLift)
+	PROPERTY_VALUE(UTrigger*, RecommendedTrigger, PropOffsets_LiftCenter.RecommendedTrigger)
 };
 
 class UWarpZoneMarker : public UNavigationPoint
@@ -702,9 +701,9 @@ class UWarpZoneMarker : public UNavigationPoint
 public:
 	using UNavigationPoint::UNavigationPoint;
 
-	UActor*& TriggerActor() { return Value<UActor*>(PropOffsets_WarpZoneMarker.TriggerActor); }
-	UActor*& TriggerActor2() { return Value<UActor*>(PropOffsets_WarpZoneMarker.TriggerActor2); }
-	UWarpZoneInfo*& markedWarpZone() { return Value<UWarpZoneInfo*>(PropOffsets_WarpZoneMarker.markedWarpZone); }
+	PROPERTY_VALUE(UActor*, TriggerActor, PropOffsets_WarpZoneMarker.TriggerActor)
+	PROPERTY_VALUE(UActor*, TriggerActor2, PropOffsets_WarpZoneMarker.TriggerActor2)
+	PROPERTY_VALUE(UWarpZoneInfo*, markedWarpZone, PropOffsets_WarpZoneMarker.markedWarpZone)
 };
 
 class UInventorySpot : public UNavigationPoint
@@ -712,7 +711,7 @@ class UInventorySpot : public UNavigationPoint
 public:
 	using UNavigationPoint::UNavigationPoint;
 
-	UInventory*& markedItem() { return Value<UInventory*>(PropOffsets_InventorySpot.markedItem); }
+	PROPERTY_VALUE(UInventory*, markedItem, PropOffsets_InventorySpot.markedItem)
 };
 
 class UTriggerMarker : public UNavigationPoint
@@ -732,10 +731,10 @@ class UPlayerStart : public UNavigationPoint
 public:
 	using UNavigationPoint::UNavigationPoint;
 
-	uint8_t& TeamNumber() { return Value<uint8_t>(PropOffsets_PlayerStart.TeamNumber); }
-	BitfieldBool bCoopStart() { return BoolValue(PropOffsets_PlayerStart.bCoopStart); }
-	BitfieldBool bEnabled() { return BoolValue(PropOffsets_PlayerStart.bEnabled); }
-	BitfieldBool bSinglePlayerStart() { return BoolValue(PropOffsets_PlayerStart.bSinglePlayerStart); }
+	PROPERTY_VALUE(uint8_t, TeamNumber, PropOffsets_PlayerStart.TeamNumber)
+	PROPERTY_BOOL(bCoopStart, PropOffsets_PlayerStart.bCoopStart)
+	PROPERTY_BOOL(bEnabled, PropOffsets_PlayerStart.bEnabled)
+	PROPERTY_BOOL(bSinglePlayerStart, PropOffsets_PlayerStart.bSinglePlayerStart)
 };
 
 class UTeleporter : public UNavigationPoint
@@ -743,18 +742,18 @@ class UTeleporter : public UNavigationPoint
 public:
 	using UNavigationPoint::UNavigationPoint;
 
-	float& LastFired() { return Value<float>(PropOffsets_Teleporter.LastFired); }
-	NameString& ProductRequired() { return Value<NameString>(PropOffsets_Teleporter.ProductRequired); }
-	vec3& TargetVelocity() { return Value<vec3>(PropOffsets_Teleporter.TargetVelocity); }
-	UActor*& TriggerActor() { return Value<UActor*>(PropOffsets_Teleporter.TriggerActor); }
-	UActor*& TriggerActor2() { return Value<UActor*>(PropOffsets_Teleporter.TriggerActor2); }
-	std::string& URL() { return Value<std::string>(PropOffsets_Teleporter.URL); }
-	BitfieldBool bChangesVelocity() { return BoolValue(PropOffsets_Teleporter.bChangesVelocity); }
-	BitfieldBool bChangesYaw() { return BoolValue(PropOffsets_Teleporter.bChangesYaw); }
-	BitfieldBool bEnabled() { return BoolValue(PropOffsets_Teleporter.bEnabled); }
-	BitfieldBool bReversesX() { return BoolValue(PropOffsets_Teleporter.bReversesX); }
-	BitfieldBool bReversesY() { return BoolValue(PropOffsets_Teleporter.bReversesY); }
-	BitfieldBool bReversesZ() { return BoolValue(PropOffsets_Teleporter.bReversesZ); }
+	PROPERTY_VALUE(float, LastFired, PropOffsets_Teleporter.LastFired)
+	PROPERTY_VALUE(NameString, ProductRequired, PropOffsets_Teleporter.ProductRequired)
+	PROPERTY_VALUE(vec3, TargetVelocity, PropOffsets_Teleporter.TargetVelocity)
+	PROPERTY_VALUE(UActor*, TriggerActor, PropOffsets_Teleporter.TriggerActor)
+	PROPERTY_VALUE(UActor*, TriggerActor2, PropOffsets_Teleporter.TriggerActor2)
+	PROPERTY_VALUE(std::string, URL, PropOffsets_Teleporter.URL)
+	PROPERTY_BOOL(bChangesVelocity, PropOffsets_Teleporter.bChangesVelocity)
+	PROPERTY_BOOL(bChangesYaw, PropOffsets_Teleporter.bChangesYaw)
+	PROPERTY_BOOL(bEnabled, PropOffsets_Teleporter.bEnabled)
+	PROPERTY_BOOL(bReversesX, PropOffsets_Teleporter.bReversesX)
+	PROPERTY_BOOL(bReversesY, PropOffsets_Teleporter.bReversesY)
+	PROPERTY_BOOL(bReversesZ, PropOffsets_Teleporter.bReversesZ)
 };
 
 class UPathNode : public UNavigationPoint
@@ -768,19 +767,19 @@ class UDecoration : public UActor
 public:
 	using UActor::UActor;
 
-	UClass*& EffectWhenDestroyed() { return Value<UClass*>(PropOffsets_Decoration.EffectWhenDestroyed); }
-	USound*& EndPushSound() { return Value<USound*>(PropOffsets_Decoration.EndPushSound); }
-	USound*& PushSound() { return Value<USound*>(PropOffsets_Decoration.PushSound); }
-	BitfieldBool bBobbing() { return BoolValue(PropOffsets_Decoration.bBobbing); }
-	BitfieldBool bOnlyTriggerable() { return BoolValue(PropOffsets_Decoration.bOnlyTriggerable); }
-	BitfieldBool bPushSoundPlaying() { return BoolValue(PropOffsets_Decoration.bPushSoundPlaying); }
-	BitfieldBool bPushable() { return BoolValue(PropOffsets_Decoration.bPushable); }
-	BitfieldBool bSplash() { return BoolValue(PropOffsets_Decoration.bSplash); }
-	BitfieldBool bWasCarried() { return BoolValue(PropOffsets_Decoration.bWasCarried); }
-	UClass*& content2() { return Value<UClass*>(PropOffsets_Decoration.content2); }
-	UClass*& content3() { return Value<UClass*>(PropOffsets_Decoration.content3); }
-	UClass*& contents() { return Value<UClass*>(PropOffsets_Decoration.contents); }
-	int& numLandings() { return Value<int>(PropOffsets_Decoration.numLandings); }
+	PROPERTY_VALUE(UClass*, EffectWhenDestroyed, PropOffsets_Decoration.EffectWhenDestroyed)
+	PROPERTY_VALUE(USound*, EndPushSound, PropOffsets_Decoration.EndPushSound)
+	PROPERTY_VALUE(USound*, PushSound, PropOffsets_Decoration.PushSound)
+	PROPERTY_BOOL(bBobbing, PropOffsets_Decoration.bBobbing)
+	PROPERTY_BOOL(bOnlyTriggerable, PropOffsets_Decoration.bOnlyTriggerable)
+	PROPERTY_BOOL(bPushSoundPlaying, PropOffsets_Decoration.bPushSoundPlaying)
+	PROPERTY_BOOL(bPushable, PropOffsets_Decoration.bPushable)
+	PROPERTY_BOOL(bSplash, PropOffsets_Decoration.bSplash)
+	PROPERTY_BOOL(bWasCarried, PropOffsets_Decoration.bWasCarried)
+	PROPERTY_VALUE(UClass*, content2, PropOffsets_Decoration.content2)
+	PROPERTY_VALUE(UClass*, content3, PropOffsets_Decoration.content3)
+	PROPERTY_VALUE(UClass*, contents, PropOffsets_Decoration.contents)
+	PROPERTY_VALUE(int, numLandings, PropOffsets_Decoration.numLandings)
 };
 
 class UCarcass : public UDecoration
@@ -788,15 +787,15 @@ class UCarcass : public UDecoration
 public:
 	using UDecoration::UDecoration;
 
-	UPawn*& Bugs() { return Value<UPawn*>(PropOffsets_Carcass.Bugs); }
-	int& CumulativeDamage() { return Value<int>(PropOffsets_Carcass.CumulativeDamage); }
-	UPlayerReplicationInfo*& PlayerOwner() { return Value<UPlayerReplicationInfo*>(PropOffsets_Carcass.PlayerOwner); }
-	BitfieldBool bDecorative() { return BoolValue(PropOffsets_Carcass.bDecorative); }
-	BitfieldBool bPlayerCarcass() { return BoolValue(PropOffsets_Carcass.bPlayerCarcass); }
-	BitfieldBool bReducedHeight() { return BoolValue(PropOffsets_Carcass.bReducedHeight); }
-	BitfieldBool bSlidingCarcass() { return BoolValue(PropOffsets_Carcass.bSlidingCarcass); }
-	uint8_t& flies() { return Value<uint8_t>(PropOffsets_Carcass.flies); }
-	uint8_t& rats() { return Value<uint8_t>(PropOffsets_Carcass.rats); }
+	PROPERTY_VALUE(UPawn*, Bugs, PropOffsets_Carcass.Bugs)
+	PROPERTY_VALUE(int, CumulativeDamage, PropOffsets_Carcass.CumulativeDamage)
+	PROPERTY_VALUE(UPlayerReplicationInfo*, PlayerOwner, PropOffsets_Carcass.PlayerOwner)
+	PROPERTY_BOOL(bDecorative, PropOffsets_Carcass.bDecorative)
+	PROPERTY_BOOL(bPlayerCarcass, PropOffsets_Carcass.bPlayerCarcass)
+	PROPERTY_BOOL(bReducedHeight, PropOffsets_Carcass.bReducedHeight)
+	PROPERTY_BOOL(bSlidingCarcass, PropOffsets_Carcass.bSlidingCarcass)
+	PROPERTY_VALUE(uint8_t, flies, PropOffsets_Carcass.flies)
+	PROPERTY_VALUE(uint8_t, rats, PropOffsets_Carcass.rats)
 };
 
 class UProjectile : public UActor
@@ -804,16 +803,16 @@ class UProjectile : public UActor
 public:
 	using UActor::UActor;
 
-	float& Damage() { return Value<float>(PropOffsets_Projectile.Damage); }
-	float& ExploWallOut() { return Value<float>(PropOffsets_Projectile.ExploWallOut); }
-	UClass*& ExplosionDecal() { return Value<UClass*>(PropOffsets_Projectile.ExplosionDecal); }
-	USound*& ImpactSound() { return Value<USound*>(PropOffsets_Projectile.ImpactSound); }
-	float& MaxSpeed() { return Value<float>(PropOffsets_Projectile.MaxSpeed); }
-	USound*& MiscSound() { return Value<USound*>(PropOffsets_Projectile.MiscSound); }
-	int& MomentumTransfer() { return Value<int>(PropOffsets_Projectile.MomentumTransfer); }
-	NameString& MyDamageType() { return Value<NameString>(PropOffsets_Projectile.MyDamageType); }
-	USound*& SpawnSound() { return Value<USound*>(PropOffsets_Projectile.SpawnSound); }
-	float& speed() { return Value<float>(PropOffsets_Projectile.speed); }
+	PROPERTY_VALUE(float, Damage, PropOffsets_Projectile.Damage)
+	PROPERTY_VALUE(float, ExploWallOut, PropOffsets_Projectile.ExploWallOut)
+	PROPERTY_VALUE(UClass*, ExplosionDecal, PropOffsets_Projectile.ExplosionDecal)
+	PROPERTY_VALUE(USound*, ImpactSound, PropOffsets_Projectile.ImpactSound)
+	PROPERTY_VALUE(float, MaxSpeed, PropOffsets_Projectile.MaxSpeed)
+	PROPERTY_VALUE(USound*, MiscSound, PropOffsets_Projectile.MiscSound)
+	PROPERTY_VALUE(int, MomentumTransfer, PropOffsets_Projectile.MomentumTransfer)
+	PROPERTY_VALUE(NameString, MyDamageType, PropOffsets_Projectile.MyDamageType)
+	PROPERTY_VALUE(USound*, SpawnSound, PropOffsets_Projectile.SpawnSound)
+	PROPERTY_VALUE(float, speed, PropOffsets_Projectile.speed)
 };
 
 class UKeypoint : public UActor
@@ -827,9 +826,9 @@ class Ulocationid : public UKeypoint
 public:
 	using UKeypoint::UKeypoint;
 
-	std::string& LocationName() { return Value<std::string>(PropOffsets_locationid.LocationName); }
-	Ulocationid*& NextLocation() { return Value<Ulocationid*>(PropOffsets_locationid.NextLocation); }
-	float& Radius() { return Value<float>(PropOffsets_locationid.Radius); }
+	PROPERTY_VALUE(std::string, LocationName, PropOffsets_locationid.LocationName)
+	PROPERTY_VALUE(Ulocationid*, NextLocation, PropOffsets_locationid.NextLocation)
+	PROPERTY_VALUE(float, Radius, PropOffsets_locationid.Radius)
 };
 
 class UInterpolationPoint : public UKeypoint
@@ -837,16 +836,16 @@ class UInterpolationPoint : public UKeypoint
 public:
 	using UKeypoint::UKeypoint;
 
-	float& FovModifier() { return Value<float>(PropOffsets_InterpolationPoint.FovModifier); }
-	float& GameSpeedModifier() { return Value<float>(PropOffsets_InterpolationPoint.GameSpeedModifier); }
-	UInterpolationPoint*& Next() { return Value<UInterpolationPoint*>(PropOffsets_InterpolationPoint.Next); }
-	int& Position() { return Value<int>(PropOffsets_InterpolationPoint.Position); }
-	UInterpolationPoint*& Prev() { return Value<UInterpolationPoint*>(PropOffsets_InterpolationPoint.Prev); }
-	float& RateModifier() { return Value<float>(PropOffsets_InterpolationPoint.RateModifier); }
-	vec3& ScreenFlashFog() { return Value<vec3>(PropOffsets_InterpolationPoint.ScreenFlashFog); }
-	float& ScreenFlashScale() { return Value<float>(PropOffsets_InterpolationPoint.ScreenFlashScale); }
-	BitfieldBool bEndOfPath() { return BoolValue(PropOffsets_InterpolationPoint.bEndOfPath); }
-	BitfieldBool bSkipNextPath() { return BoolValue(PropOffsets_InterpolationPoint.bSkipNextPath); }
+	PROPERTY_VALUE(float, FovModifier, PropOffsets_InterpolationPoint.FovModifier)
+	PROPERTY_VALUE(float, GameSpeedModifier, PropOffsets_InterpolationPoint.GameSpeedModifier)
+	PROPERTY_VALUE(UInterpolationPoint*, Next, PropOffsets_InterpolationPoint.Next)
+	PROPERTY_VALUE(int, Position, PropOffsets_InterpolationPoint.Position)
+	PROPERTY_VALUE(UInterpolationPoint*, Prev, PropOffsets_InterpolationPoint.Prev)
+	PROPERTY_VALUE(float, RateModifier, PropOffsets_InterpolationPoint.RateModifier)
+	PROPERTY_VALUE(vec3, ScreenFlashFog, PropOffsets_InterpolationPoint.ScreenFlashFog)
+	PROPERTY_VALUE(float, ScreenFlashScale, PropOffsets_InterpolationPoint.ScreenFlashScale)
+	PROPERTY_BOOL(bEndOfPath, PropOffsets_InterpolationPoint.bEndOfPath)
+	PROPERTY_BOOL(bSkipNextPath, PropOffsets_InterpolationPoint.bSkipNextPath)
 };
 
 class UTriggers : public UActor
@@ -860,17 +859,17 @@ class UTrigger : public UTriggers
 public:
 	using UTriggers::UTriggers;
 
-	UClass*& ClassProximityType() { return Value<UClass*>(PropOffsets_Trigger.ClassProximityType); }
-	float& DamageThreshold() { return Value<float>(PropOffsets_Trigger.DamageThreshold); }
-	std::string& Message() { return Value<std::string>(PropOffsets_Trigger.Message); }
-	float& ReTriggerDelay() { return Value<float>(PropOffsets_Trigger.ReTriggerDelay); }
-	float& RepeatTriggerTime() { return Value<float>(PropOffsets_Trigger.RepeatTriggerTime); }
-	UActor*& TriggerActor() { return Value<UActor*>(PropOffsets_Trigger.TriggerActor); }
-	UActor*& TriggerActor2() { return Value<UActor*>(PropOffsets_Trigger.TriggerActor2); }
-	float& TriggerTime() { return Value<float>(PropOffsets_Trigger.TriggerTime); }
-	uint8_t& TriggerType() { return Value<uint8_t>(PropOffsets_Trigger.TriggerType); }
-	BitfieldBool bInitiallyActive() { return BoolValue(PropOffsets_Trigger.bInitiallyActive); }
-	BitfieldBool bTriggerOnceOnly() { return BoolValue(PropOffsets_Trigger.bTriggerOnceOnly); }
+	PROPERTY_VALUE(UClass*, ClassProximityType, PropOffsets_Trigger.ClassProximityType)
+	PROPERTY_VALUE(float, DamageThreshold, PropOffsets_Trigger.DamageThreshold)
+	PROPERTY_VALUE(std::string, Message, PropOffsets_Trigger.Message)
+	PROPERTY_VALUE(float, ReTriggerDelay, PropOffsets_Trigger.ReTriggerDelay)
+	PROPERTY_VALUE(float, RepeatTriggerTime, PropOffsets_Trigger.RepeatTriggerTime)
+	PROPERTY_VALUE(UActor*, TriggerActor, PropOffsets_Trigger.TriggerActor)
+	PROPERTY_VALUE(UActor*, TriggerActor2, PropOffsets_Trigger.TriggerActor2)
+	PROPERTY_VALUE(float, TriggerTime, PropOffsets_Trigger.TriggerTime)
+	PROPERTY_VALUE(uint8_t, TriggerType, PropOffsets_Trigger.TriggerType)
+	PROPERTY_BOOL(bInitiallyActive, PropOffsets_Trigger.bInitiallyActive)
+	PROPERTY_BOOL(bTriggerOnceOnly, PropOffsets_Trigger.bTriggerOnceOnly)
 };
 
 class UHUD : public UActor
@@ -878,14 +877,14 @@ class UHUD : public UActor
 public:
 	using UActor::UActor;
 
-	int& Crosshair() { return Value<int>(PropOffsets_HUD.Crosshair); }
-	std::string& HUDConfigWindowType() { return Value<std::string>(PropOffsets_HUD.HUDConfigWindowType); }
-	UMutator*& HUDMutator() { return Value<UMutator*>(PropOffsets_HUD.HUDMutator); }
-	int& HudMode() { return Value<int>(PropOffsets_HUD.HudMode); }
-	UMenu*& MainMenu() { return Value<UMenu*>(PropOffsets_HUD.MainMenu); }
-	UClass*& MainMenuType() { return Value<UClass*>(PropOffsets_HUD.MainMenuType); }
-	UPlayerPawn*& PlayerOwner() { return Value<UPlayerPawn*>(PropOffsets_HUD.PlayerOwner); }
-	Color& WhiteColor() { return Value<Color>(PropOffsets_HUD.WhiteColor); }
+	PROPERTY_VALUE(int, Crosshair, PropOffsets_HUD.Crosshair)
+	PROPERTY_VALUE(std::string, HUDConfigWindowType, PropOffsets_HUD.HUDConfigWindowType)
+	PROPERTY_VALUE(UMutator*, HUDMutator, PropOffsets_HUD.HUDMutator)
+	PROPERTY_VALUE(int, HudMode, PropOffsets_HUD.HudMode)
+	PROPERTY_VALUE(UMenu*, MainMenu, PropOffsets_HUD.MainMenu)
+	PROPERTY_VALUE(UClass*, MainMenuType, PropOffsets_HUD.MainMenuType)
+	PROPERTY_VALUE(UPlayerPawn*, PlayerOwner, PropOffsets_HUD.PlayerOwner)
+	PROPERTY_VALUE(Color, WhiteColor, PropOffsets_HUD.WhiteColor)
 };
 
 class UMenu : public UActor
@@ -893,22 +892,22 @@ class UMenu : public UActor
 public:
 	using UActor::UActor;
 
-	std::string& CenterString() { return Value<std::string>(PropOffsets_Menu.CenterString); }
-	std::string& DisabledString() { return Value<std::string>(PropOffsets_Menu.DisabledString); }
-	std::string& EnabledString() { return Value<std::string>(PropOffsets_Menu.EnabledString); }
-	std::string& HelpMessage() { return Value<std::string>(PropOffsets_Menu.HelpMessage); }
-	std::string& LeftString() { return Value<std::string>(PropOffsets_Menu.LeftString); }
-	int& MenuLength() { return Value<int>(PropOffsets_Menu.MenuLength); }
-	std::string& MenuList() { return Value<std::string>(PropOffsets_Menu.MenuList); }
-	std::string& MenuTitle() { return Value<std::string>(PropOffsets_Menu.MenuTitle); }
-	std::string& NoString() { return Value<std::string>(PropOffsets_Menu.NoString); }
-	UMenu*& ParentMenu() { return Value<UMenu*>(PropOffsets_Menu.ParentMenu); }
-	UPlayerPawn*& PlayerOwner() { return Value<UPlayerPawn*>(PropOffsets_Menu.PlayerOwner); }
-	std::string& RightString() { return Value<std::string>(PropOffsets_Menu.RightString); }
-	int& Selection() { return Value<int>(PropOffsets_Menu.Selection); }
-	std::string& YesString() { return Value<std::string>(PropOffsets_Menu.YesString); }
-	BitfieldBool bConfigChanged() { return BoolValue(PropOffsets_Menu.bConfigChanged); }
-	BitfieldBool bExitAllMenus() { return BoolValue(PropOffsets_Menu.bExitAllMenus); }
+	PROPERTY_VALUE(std::string, CenterString, PropOffsets_Menu.CenterString)
+	PROPERTY_VALUE(std::string, DisabledString, PropOffsets_Menu.DisabledString)
+	PROPERTY_VALUE(std::string, EnabledString, PropOffsets_Menu.EnabledString)
+	PROPERTY_VALUE(std::string, HelpMessage, PropOffsets_Menu.HelpMessage)
+	PROPERTY_VALUE(std::string, LeftString, PropOffsets_Menu.LeftString)
+	PROPERTY_VALUE(int, MenuLength, PropOffsets_Menu.MenuLength)
+	PROPERTY_VALUE(std::string, MenuList, PropOffsets_Menu.MenuList)
+	PROPERTY_VALUE(std::string, MenuTitle, PropOffsets_Menu.MenuTitle)
+	PROPERTY_VALUE(std::string, NoString, PropOffsets_Menu.NoString)
+	PROPERTY_VALUE(UMenu*, ParentMenu, PropOffsets_Menu.ParentMenu)
+	PROPERTY_VALUE(UPlayerPawn*, PlayerOwner, PropOffsets_Menu.PlayerOwner)
+	PROPERTY_VALUE(std::string, RightString, PropOffsets_Menu.RightString)
+	PROPERTY_VALUE(int, Selection, PropOffsets_Menu.Selection)
+	PROPERTY_VALUE(std::string, YesString, PropOffsets_Menu.YesString)
+	PROPERTY_BOOL(bConfigChanged, PropOffsets_Menu.bConfigChanged)
+	PROPERTY_BOOL(bExitAllMenus, PropOffsets_Menu.bExitAllMenus)
 };
 
 class UInfo : public UActor
@@ -922,12 +921,12 @@ class UMutator : public UInfo
 public:
 	using UInfo::UInfo;
 
-	UClass*& DefaultWeapon() { return Value<UClass*>(PropOffsets_Mutator.DefaultWeapon); }
-	UMutator*& NextDamageMutator() { return Value<UMutator*>(PropOffsets_Mutator.NextDamageMutator); }
-	UMutator*& NextHUDMutator() { return Value<UMutator*>(PropOffsets_Mutator.NextHUDMutator); }
-	UMutator*& NextMessageMutator() { return Value<UMutator*>(PropOffsets_Mutator.NextMessageMutator); }
-	UMutator*& NextMutator() { return Value<UMutator*>(PropOffsets_Mutator.NextMutator); }
-	BitfieldBool bHUDMutator() { return BoolValue(PropOffsets_Mutator.bHUDMutator); }
+	PROPERTY_VALUE(UClass*, DefaultWeapon, PropOffsets_Mutator.DefaultWeapon)
+	PROPERTY_VALUE(UMutator*, NextDamageMutator, PropOffsets_Mutator.NextDamageMutator)
+	PROPERTY_VALUE(UMutator*, NextHUDMutator, PropOffsets_Mutator.NextHUDMutator)
+	PROPERTY_VALUE(UMutator*, NextMessageMutator, PropOffsets_Mutator.NextMessageMutator)
+	PROPERTY_VALUE(UMutator*, NextMutator, PropOffsets_Mutator.NextMutator)
+	PROPERTY_BOOL(bHUDMutator, PropOffsets_Mutator.bHUDMutator)
 };
 
 class UGameInfo : public UInfo
@@ -935,92 +934,92 @@ class UGameInfo : public UInfo
 public:
 	using UInfo::UInfo;
 
-	std::string& AdminPassword() { return Value<std::string>(PropOffsets_GameInfo.AdminPassword); }
-	float& AutoAim() { return Value<float>(PropOffsets_GameInfo.AutoAim); }
-	UMutator*& BaseMutator() { return Value<UMutator*>(PropOffsets_GameInfo.BaseMutator); }
-	std::string& BeaconName() { return Value<std::string>(PropOffsets_GameInfo.BeaconName); }
-	std::string& BotMenuType() { return Value<std::string>(PropOffsets_GameInfo.BotMenuType); }
-	int& CurrentID() { return Value<int>(PropOffsets_GameInfo.CurrentID); }
-	UClass*& DMMessageClass() { return Value<UClass*>(PropOffsets_GameInfo.DMMessageClass); }
-	UMutator*& DamageMutator() { return Value<UMutator*>(PropOffsets_GameInfo.DamageMutator); }
-	UClass*& DeathMessageClass() { return Value<UClass*>(PropOffsets_GameInfo.DeathMessageClass); }
-	UClass*& DefaultPlayerClass() { return Value<UClass*>(PropOffsets_GameInfo.DefaultPlayerClass); }
-	std::string& DefaultPlayerName() { return Value<std::string>(PropOffsets_GameInfo.DefaultPlayerName); }
-	NameString& DefaultPlayerState() { return Value<NameString>(PropOffsets_GameInfo.DefaultPlayerState); }
-	UClass*& DefaultWeapon() { return Value<UClass*>(PropOffsets_GameInfo.DefaultWeapon); }
-	int& DemoBuild() { return Value<int>(PropOffsets_GameInfo.DemoBuild); }
-	int& DemoHasTuts() { return Value<int>(PropOffsets_GameInfo.DemoHasTuts); }
-	uint8_t& Difficulty() { return Value<uint8_t>(PropOffsets_GameInfo.Difficulty); }
-	std::string& EnabledMutators() { return Value<std::string>(PropOffsets_GameInfo.EnabledMutators); }
-	std::string& EnteredMessage() { return Value<std::string>(PropOffsets_GameInfo.EnteredMessage); }
-	std::string& FailedPlaceMessage() { return Value<std::string>(PropOffsets_GameInfo.FailedPlaceMessage); }
-	std::string& FailedSpawnMessage() { return Value<std::string>(PropOffsets_GameInfo.FailedSpawnMessage); }
-	std::string& FailedTeamMessage() { return Value<std::string>(PropOffsets_GameInfo.FailedTeamMessage); }
-	UClass*& GameMenuType() { return Value<UClass*>(PropOffsets_GameInfo.GameMenuType); }
-	std::string& GameName() { return Value<std::string>(PropOffsets_GameInfo.GameName); }
-	std::string& GameOptionsMenuType() { return Value<std::string>(PropOffsets_GameInfo.GameOptionsMenuType); }
-	std::string& GamePassword() { return Value<std::string>(PropOffsets_GameInfo.GamePassword); }
-	UGameReplicationInfo*& GameReplicationInfo() { return Value<UGameReplicationInfo*>(PropOffsets_GameInfo.GameReplicationInfo); }
-	UClass*& GameReplicationInfoClass() { return Value<UClass*>(PropOffsets_GameInfo.GameReplicationInfoClass); }
-	float& GameSpeed() { return Value<float>(PropOffsets_GameInfo.GameSpeed); }
-	std::string& GameUMenuType() { return Value<std::string>(PropOffsets_GameInfo.GameUMenuType); }
-	UClass*& HUDType() { return Value<UClass*>(PropOffsets_GameInfo.HUDType); }
-	std::string& IPBanned() { return Value<std::string>(PropOffsets_GameInfo.IPBanned); }
-	std::string& IPPolicies() { return Value<std::string>(PropOffsets_GameInfo.IPPolicies); }
-	int& ItemGoals() { return Value<int>(PropOffsets_GameInfo.ItemGoals); }
-	int& KillGoals() { return Value<int>(PropOffsets_GameInfo.KillGoals); }
-	std::string& LeftMessage() { return Value<std::string>(PropOffsets_GameInfo.LeftMessage); }
-	UStatLog*& LocalLog() { return Value<UStatLog*>(PropOffsets_GameInfo.LocalLog); }
-	std::string& LocalLogFileName() { return Value<std::string>(PropOffsets_GameInfo.LocalLogFileName); }
-	UClass*& MapListType() { return Value<UClass*>(PropOffsets_GameInfo.MapListType); }
-	std::string& MapPrefix() { return Value<std::string>(PropOffsets_GameInfo.MapPrefix); }
-	int& MaxPlayers() { return Value<int>(PropOffsets_GameInfo.MaxPlayers); }
-	int& MaxSpectators() { return Value<int>(PropOffsets_GameInfo.MaxSpectators); }
-	std::string& MaxedOutMessage() { return Value<std::string>(PropOffsets_GameInfo.MaxedOutMessage); }
-	UMutator*& MessageMutator() { return Value<UMutator*>(PropOffsets_GameInfo.MessageMutator); }
-	std::string& MultiplayerUMenuType() { return Value<std::string>(PropOffsets_GameInfo.MultiplayerUMenuType); }
-	UClass*& MutatorClass() { return Value<UClass*>(PropOffsets_GameInfo.MutatorClass); }
-	std::string& NameChangedMessage() { return Value<std::string>(PropOffsets_GameInfo.NameChangedMessage); }
-	std::string& NeedPassword() { return Value<std::string>(PropOffsets_GameInfo.NeedPassword); }
-	int& NumPlayers() { return Value<int>(PropOffsets_GameInfo.NumPlayers); }
-	int& NumSpectators() { return Value<int>(PropOffsets_GameInfo.NumSpectators); }
-	std::string& RulesMenuType() { return Value<std::string>(PropOffsets_GameInfo.RulesMenuType); }
-	UClass*& ScoreBoardType() { return Value<UClass*>(PropOffsets_GameInfo.ScoreBoardType); }
-	int& SecretGoals() { return Value<int>(PropOffsets_GameInfo.SecretGoals); }
-	int& SentText() { return Value<int>(PropOffsets_GameInfo.SentText); }
-	std::string& ServerLogName() { return Value<std::string>(PropOffsets_GameInfo.ServerLogName); }
-	std::string& SettingsMenuType() { return Value<std::string>(PropOffsets_GameInfo.SettingsMenuType); }
-	std::string& SpecialDamageString() { return Value<std::string>(PropOffsets_GameInfo.SpecialDamageString); }
-	float& StartTime() { return Value<float>(PropOffsets_GameInfo.StartTime); }
-	UClass*& StatLogClass() { return Value<UClass*>(PropOffsets_GameInfo.StatLogClass); }
-	std::string& SwitchLevelMessage() { return Value<std::string>(PropOffsets_GameInfo.SwitchLevelMessage); }
-	UClass*& WaterZoneType() { return Value<UClass*>(PropOffsets_GameInfo.WaterZoneType); }
-	UStatLog*& WorldLog() { return Value<UStatLog*>(PropOffsets_GameInfo.WorldLog); }
-	std::string& WorldLogFileName() { return Value<std::string>(PropOffsets_GameInfo.WorldLogFileName); }
-	std::string& WrongPassword() { return Value<std::string>(PropOffsets_GameInfo.WrongPassword); }
-	BitfieldBool bAllowFOV() { return BoolValue(PropOffsets_GameInfo.bAllowFOV); }
-	BitfieldBool bAlternateMode() { return BoolValue(PropOffsets_GameInfo.bAlternateMode); }
-	BitfieldBool bBatchLocal() { return BoolValue(PropOffsets_GameInfo.bBatchLocal); }
-	BitfieldBool bCanChangeSkin() { return BoolValue(PropOffsets_GameInfo.bCanChangeSkin); }
-	BitfieldBool bCanViewOthers() { return BoolValue(PropOffsets_GameInfo.bCanViewOthers); }
-	BitfieldBool bClassicDeathMessages() { return BoolValue(PropOffsets_GameInfo.bClassicDeathMessages); }
-	BitfieldBool bCoopWeaponMode() { return BoolValue(PropOffsets_GameInfo.bCoopWeaponMode); }
-	BitfieldBool bDeathMatch() { return BoolValue(PropOffsets_GameInfo.bDeathMatch); }
-	BitfieldBool bExternalBatcher() { return BoolValue(PropOffsets_GameInfo.bExternalBatcher); }
-	BitfieldBool bGameEnded() { return BoolValue(PropOffsets_GameInfo.bGameEnded); }
-	BitfieldBool bHumansOnly() { return BoolValue(PropOffsets_GameInfo.bHumansOnly); }
-	BitfieldBool bLocalLog() { return BoolValue(PropOffsets_GameInfo.bLocalLog); }
-	BitfieldBool bLoggingGame() { return BoolValue(PropOffsets_GameInfo.bLoggingGame); }
-	BitfieldBool bLowGore() { return BoolValue(PropOffsets_GameInfo.bLowGore); }
-	BitfieldBool bMuteSpectators() { return BoolValue(PropOffsets_GameInfo.bMuteSpectators); }
-	BitfieldBool bNoCheating() { return BoolValue(PropOffsets_GameInfo.bNoCheating); }
-	BitfieldBool bNoMonsters() { return BoolValue(PropOffsets_GameInfo.bNoMonsters); }
-	BitfieldBool bOverTime() { return BoolValue(PropOffsets_GameInfo.bOverTime); }
-	BitfieldBool bPauseable() { return BoolValue(PropOffsets_GameInfo.bPauseable); }
-	BitfieldBool bRestartLevel() { return BoolValue(PropOffsets_GameInfo.bRestartLevel); }
-	BitfieldBool bTeamGame() { return BoolValue(PropOffsets_GameInfo.bTeamGame); }
-	BitfieldBool bVeryLowGore() { return BoolValue(PropOffsets_GameInfo.bVeryLowGore); }
-	BitfieldBool bWorldLog() { return BoolValue(PropOffsets_GameInfo.bWorldLog); }
+	PROPERTY_VALUE(std::string, AdminPassword, PropOffsets_GameInfo.AdminPassword)
+	PROPERTY_VALUE(float, AutoAim, PropOffsets_GameInfo.AutoAim)
+	PROPERTY_VALUE(UMutator*, BaseMutator, PropOffsets_GameInfo.BaseMutator)
+	PROPERTY_VALUE(std::string, BeaconName, PropOffsets_GameInfo.BeaconName)
+	PROPERTY_VALUE(std::string, BotMenuType, PropOffsets_GameInfo.BotMenuType)
+	PROPERTY_VALUE(int, CurrentID, PropOffsets_GameInfo.CurrentID)
+	PROPERTY_VALUE(UClass*, DMMessageClass, PropOffsets_GameInfo.DMMessageClass)
+	PROPERTY_VALUE(UMutator*, DamageMutator, PropOffsets_GameInfo.DamageMutator)
+	PROPERTY_VALUE(UClass*, DeathMessageClass, PropOffsets_GameInfo.DeathMessageClass)
+	PROPERTY_VALUE(UClass*, DefaultPlayerClass, PropOffsets_GameInfo.DefaultPlayerClass)
+	PROPERTY_VALUE(std::string, DefaultPlayerName, PropOffsets_GameInfo.DefaultPlayerName)
+	PROPERTY_VALUE(NameString, DefaultPlayerState, PropOffsets_GameInfo.DefaultPlayerState)
+	PROPERTY_VALUE(UClass*, DefaultWeapon, PropOffsets_GameInfo.DefaultWeapon)
+	PROPERTY_VALUE(int, DemoBuild, PropOffsets_GameInfo.DemoBuild)
+	PROPERTY_VALUE(int, DemoHasTuts, PropOffsets_GameInfo.DemoHasTuts)
+	PROPERTY_VALUE(uint8_t, Difficulty, PropOffsets_GameInfo.Difficulty)
+	PROPERTY_VALUE(std::string, EnabledMutators, PropOffsets_GameInfo.EnabledMutators)
+	PROPERTY_VALUE(std::string, EnteredMessage, PropOffsets_GameInfo.EnteredMessage)
+	PROPERTY_VALUE(std::string, FailedPlaceMessage, PropOffsets_GameInfo.FailedPlaceMessage)
+	PROPERTY_VALUE(std::string, FailedSpawnMessage, PropOffsets_GameInfo.FailedSpawnMessage)
+	PROPERTY_VALUE(std::string, FailedTeamMessage, PropOffsets_GameInfo.FailedTeamMessage)
+	PROPERTY_VALUE(UClass*, GameMenuType, PropOffsets_GameInfo.GameMenuType)
+	PROPERTY_VALUE(std::string, GameName, PropOffsets_GameInfo.GameName)
+	PROPERTY_VALUE(std::string, GameOptionsMenuType, PropOffsets_GameInfo.GameOptionsMenuType)
+	PROPERTY_VALUE(std::string, GamePassword, PropOffsets_GameInfo.GamePassword)
+	PROPERTY_VALUE(UGameReplicationInfo*, GameReplicationInfo, PropOffsets_GameInfo.GameReplicationInfo)
+	PROPERTY_VALUE(UClass*, GameReplicationInfoClass, PropOffsets_GameInfo.GameReplicationInfoClass)
+	PROPERTY_VALUE(float, GameSpeed, PropOffsets_GameInfo.GameSpeed)
+	PROPERTY_VALUE(std::string, GameUMenuType, PropOffsets_GameInfo.GameUMenuType)
+	PROPERTY_VALUE(UClass*, HUDType, PropOffsets_GameInfo.HUDType)
+	PROPERTY_VALUE(std::string, IPBanned, PropOffsets_GameInfo.IPBanned)
+	PROPERTY_VALUE(std::string, IPPolicies, PropOffsets_GameInfo.IPPolicies)
+	PROPERTY_VALUE(int, ItemGoals, PropOffsets_GameInfo.ItemGoals)
+	PROPERTY_VALUE(int, KillGoals, PropOffsets_GameInfo.KillGoals)
+	PROPERTY_VALUE(std::string, LeftMessage, PropOffsets_GameInfo.LeftMessage)
+	PROPERTY_VALUE(UStatLog*, LocalLog, PropOffsets_GameInfo.LocalLog)
+	PROPERTY_VALUE(std::string, LocalLogFileName, PropOffsets_GameInfo.LocalLogFileName)
+	PROPERTY_VALUE(UClass*, MapListType, PropOffsets_GameInfo.MapListType)
+	PROPERTY_VALUE(std::string, MapPrefix, PropOffsets_GameInfo.MapPrefix)
+	PROPERTY_VALUE(int, MaxPlayers, PropOffsets_GameInfo.MaxPlayers)
+	PROPERTY_VALUE(int, MaxSpectators, PropOffsets_GameInfo.MaxSpectators)
+	PROPERTY_VALUE(std::string, MaxedOutMessage, PropOffsets_GameInfo.MaxedOutMessage)
+	PROPERTY_VALUE(UMutator*, MessageMutator, PropOffsets_GameInfo.MessageMutator)
+	PROPERTY_VALUE(std::string, MultiplayerUMenuType, PropOffsets_GameInfo.MultiplayerUMenuType)
+	PROPERTY_VALUE(UClass*, MutatorClass, PropOffsets_GameInfo.MutatorClass)
+	PROPERTY_VALUE(std::string, NameChangedMessage, PropOffsets_GameInfo.NameChangedMessage)
+	PROPERTY_VALUE(std::string, NeedPassword, PropOffsets_GameInfo.NeedPassword)
+	PROPERTY_VALUE(int, NumPlayers, PropOffsets_GameInfo.NumPlayers)
+	PROPERTY_VALUE(int, NumSpectators, PropOffsets_GameInfo.NumSpectators)
+	PROPERTY_VALUE(std::string, RulesMenuType, PropOffsets_GameInfo.RulesMenuType)
+	PROPERTY_VALUE(UClass*, ScoreBoardType, PropOffsets_GameInfo.ScoreBoardType)
+	PROPERTY_VALUE(int, SecretGoals, PropOffsets_GameInfo.SecretGoals)
+	PROPERTY_VALUE(int, SentText, PropOffsets_GameInfo.SentText)
+	PROPERTY_VALUE(std::string, ServerLogName, PropOffsets_GameInfo.ServerLogName)
+	PROPERTY_VALUE(std::string, SettingsMenuType, PropOffsets_GameInfo.SettingsMenuType)
+	PROPERTY_VALUE(std::string, SpecialDamageString, PropOffsets_GameInfo.SpecialDamageString)
+	PROPERTY_VALUE(float, StartTime, PropOffsets_GameInfo.StartTime)
+	PROPERTY_VALUE(UClass*, StatLogClass, PropOffsets_GameInfo.StatLogClass)
+	PROPERTY_VALUE(std::string, SwitchLevelMessage, PropOffsets_GameInfo.SwitchLevelMessage)
+	PROPERTY_VALUE(UClass*, WaterZoneType, PropOffsets_GameInfo.WaterZoneType)
+	PROPERTY_VALUE(UStatLog*, WorldLog, PropOffsets_GameInfo.WorldLog)
+	PROPERTY_VALUE(std::string, WorldLogFileName, PropOffsets_GameInfo.WorldLogFileName)
+	PROPERTY_VALUE(std::string, WrongPassword, PropOffsets_GameInfo.WrongPassword)
+	PROPERTY_BOOL(bAllowFOV, PropOffsets_GameInfo.bAllowFOV)
+	PROPERTY_BOOL(bAlternateMode, PropOffsets_GameInfo.bAlternateMode)
+	PROPERTY_BOOL(bBatchLocal, PropOffsets_GameInfo.bBatchLocal)
+	PROPERTY_BOOL(bCanChangeSkin, PropOffsets_GameInfo.bCanChangeSkin)
+	PROPERTY_BOOL(bCanViewOthers, PropOffsets_GameInfo.bCanViewOthers)
+	PROPERTY_BOOL(bClassicDeathMessages, PropOffsets_GameInfo.bClassicDeathMessages)
+	PROPERTY_BOOL(bCoopWeaponMode, PropOffsets_GameInfo.bCoopWeaponMode)
+	PROPERTY_BOOL(bDeathMatch, PropOffsets_GameInfo.bDeathMatch)
+	PROPERTY_BOOL(bExternalBatcher, PropOffsets_GameInfo.bExternalBatcher)
+	PROPERTY_BOOL(bGameEnded, PropOffsets_GameInfo.bGameEnded)
+	PROPERTY_BOOL(bHumansOnly, PropOffsets_GameInfo.bHumansOnly)
+	PROPERTY_BOOL(bLocalLog, PropOffsets_GameInfo.bLocalLog)
+	PROPERTY_BOOL(bLoggingGame, PropOffsets_GameInfo.bLoggingGame)
+	PROPERTY_BOOL(bLowGore, PropOffsets_GameInfo.bLowGore)
+	PROPERTY_BOOL(bMuteSpectators, PropOffsets_GameInfo.bMuteSpectators)
+	PROPERTY_BOOL(bNoCheating, PropOffsets_GameInfo.bNoCheating)
+	PROPERTY_BOOL(bNoMonsters, PropOffsets_GameInfo.bNoMonsters)
+	PROPERTY_BOOL(bOverTime, PropOffsets_GameInfo.bOverTime)
+	PROPERTY_BOOL(bPauseable, PropOffsets_GameInfo.bPauseable)
+	PROPERTY_BOOL(bRestartLevel, PropOffsets_GameInfo.bRestartLevel)
+	PROPERTY_BOOL(bTeamGame, PropOffsets_GameInfo.bTeamGame)
+	PROPERTY_BOOL(bVeryLowGore, PropOffsets_GameInfo.bVeryLowGore)
+	PROPERTY_BOOL(bWorldLog, PropOffsets_GameInfo.bWorldLog)
 };
 
 class USavedMove : public UInfo
@@ -1028,17 +1027,17 @@ class USavedMove : public UInfo
 public:
 	using UInfo::UInfo;
 
-	float& Delta() { return Value<float>(PropOffsets_SavedMove.Delta); }
-	uint8_t& DodgeMove() { return Value<uint8_t>(PropOffsets_SavedMove.DodgeMove); }
-	USavedMove*& NextMove() { return Value<USavedMove*>(PropOffsets_SavedMove.NextMove); }
-	float& TimeStamp() { return Value<float>(PropOffsets_SavedMove.TimeStamp); }
-	BitfieldBool bAltFire() { return BoolValue(PropOffsets_SavedMove.bAltFire); }
-	BitfieldBool bDuck() { return BoolValue(PropOffsets_SavedMove.bDuck); }
-	BitfieldBool bFire() { return BoolValue(PropOffsets_SavedMove.bFire); }
-	BitfieldBool bForceAltFire() { return BoolValue(PropOffsets_SavedMove.bForceAltFire); }
-	BitfieldBool bForceFire() { return BoolValue(PropOffsets_SavedMove.bForceFire); }
-	BitfieldBool bPressedJump() { return BoolValue(PropOffsets_SavedMove.bPressedJump); }
-	BitfieldBool bRun() { return BoolValue(PropOffsets_SavedMove.bRun); }
+	PROPERTY_VALUE(float, Delta, PropOffsets_SavedMove.Delta)
+	PROPERTY_VALUE(uint8_t, DodgeMove, PropOffsets_SavedMove.DodgeMove)
+	PROPERTY_VALUE(USavedMove*, NextMove, PropOffsets_SavedMove.NextMove)
+	PROPERTY_VALUE(float, TimeStamp, PropOffsets_SavedMove.TimeStamp)
+	PROPERTY_BOOL(bAltFire, PropOffsets_SavedMove.bAltFire)
+	PROPERTY_BOOL(bDuck, PropOffsets_SavedMove.bDuck)
+	PROPERTY_BOOL(bFire, PropOffsets_SavedMove.bFire)
+	PROPERTY_BOOL(bForceAltFire, PropOffsets_SavedMove.bForceAltFire)
+	PROPERTY_BOOL(bForceFire, PropOffsets_SavedMove.bForceFire)
+	PROPERTY_BOOL(bPressedJump, PropOffsets_SavedMove.bPressedJump)
+	PROPERTY_BOOL(bRun, PropOffsets_SavedMove.bRun)
 };
 
 class UInternetInfo : public UInfo
@@ -1052,60 +1051,60 @@ class UZoneInfo : public UInfo
 public:
 	using UInfo::UInfo;
 
-	uint8_t& AmbientBrightness() { return Value<uint8_t>(PropOffsets_ZoneInfo.AmbientBrightness); }
-	uint8_t& AmbientHue() { return Value<uint8_t>(PropOffsets_ZoneInfo.AmbientHue); }
-	uint8_t& AmbientSaturation() { return Value<uint8_t>(PropOffsets_ZoneInfo.AmbientSaturation); }
-	int& CutoffHz() { return Value<int>(PropOffsets_ZoneInfo.CutoffHz); }
-	int& DamagePerSec() { return Value<int>(PropOffsets_ZoneInfo.DamagePerSec); }
-	std::string& DamageString() { return Value<std::string>(PropOffsets_ZoneInfo.DamageString); }
-	NameString& DamageType() { return Value<NameString>(PropOffsets_ZoneInfo.DamageType); }
-	uint8_t& Delay() { return Value<uint8_t>(PropOffsets_ZoneInfo.Delay); }
-	UClass*& EntryActor() { return Value<UClass*>(PropOffsets_ZoneInfo.EntryActor); }
-	USound*& EntrySound() { return Value<USound*>(PropOffsets_ZoneInfo.EntrySound); }
-	UTexture*& EnvironmentMap() { return Value<UTexture*>(PropOffsets_ZoneInfo.EnvironmentMap); }
-	UClass*& ExitActor() { return Value<UClass*>(PropOffsets_ZoneInfo.ExitActor); }
-	USound*& ExitSound() { return Value<USound*>(PropOffsets_ZoneInfo.ExitSound); }
-	Color& FogColor() { return Value<Color>(PropOffsets_ZoneInfo.FogColor); }
-	float& FogDistance() { return Value<float>(PropOffsets_ZoneInfo.FogDistance); }
-	uint8_t& Gain() { return Value<uint8_t>(PropOffsets_ZoneInfo.Gain); }
-	UTexture*& LensFlare() { return Value<UTexture*>(PropOffsets_ZoneInfo.LensFlare); }
-	float& LensFlareOffset() { return Value<float>(PropOffsets_ZoneInfo.LensFlareOffset); }
-	float& LensFlareScale() { return Value<float>(PropOffsets_ZoneInfo.LensFlareScale); }
-	uint8_t& MasterGain() { return Value<uint8_t>(PropOffsets_ZoneInfo.MasterGain); }
-	int& MaxCarcasses() { return Value<int>(PropOffsets_ZoneInfo.MaxCarcasses); }
-	uint8_t& MaxLightCount() { return Value<uint8_t>(PropOffsets_ZoneInfo.MaxLightCount); }
-	int& MaxLightingPolyCount() { return Value<int>(PropOffsets_ZoneInfo.MaxLightingPolyCount); }
-	uint8_t& MinLightCount() { return Value<uint8_t>(PropOffsets_ZoneInfo.MinLightCount); }
-	int& MinLightingPolyCount() { return Value<int>(PropOffsets_ZoneInfo.MinLightingPolyCount); }
-	int& NumCarcasses() { return Value<int>(PropOffsets_ZoneInfo.NumCarcasses); }
-	USkyZoneInfo*& SkyZone() { return Value<USkyZoneInfo*>(PropOffsets_ZoneInfo.SkyZone); }
-	float& SpeedOfSound() { return Value<float>(PropOffsets_ZoneInfo.SpeedOfSound); }
-	float& TexUPanSpeed() { return Value<float>(PropOffsets_ZoneInfo.TexUPanSpeed); }
-	float& TexVPanSpeed() { return Value<float>(PropOffsets_ZoneInfo.TexVPanSpeed); }
-	vec3& ViewFlash() { return Value<vec3>(PropOffsets_ZoneInfo.ViewFlash); }
-	vec3& ViewFog() { return Value<vec3>(PropOffsets_ZoneInfo.ViewFog); }
-	float& ZoneFluidFriction() { return Value<float>(PropOffsets_ZoneInfo.ZoneFluidFriction); }
-	vec3& ZoneGravity() { return Value<vec3>(PropOffsets_ZoneInfo.ZoneGravity); }
-	float& ZoneGroundFriction() { return Value<float>(PropOffsets_ZoneInfo.ZoneGroundFriction); }
-	std::string& ZoneName() { return Value<std::string>(PropOffsets_ZoneInfo.ZoneName); }
-	int& ZonePlayerCount() { return Value<int>(PropOffsets_ZoneInfo.ZonePlayerCount); }
-	NameString& ZonePlayerEvent() { return Value<NameString>(PropOffsets_ZoneInfo.ZonePlayerEvent); }
-	NameString& ZoneTag() { return Value<NameString>(PropOffsets_ZoneInfo.ZoneTag); }
-	float& ZoneTerminalVelocity() { return Value<float>(PropOffsets_ZoneInfo.ZoneTerminalVelocity); }
-	vec3& ZoneVelocity() { return Value<vec3>(PropOffsets_ZoneInfo.ZoneVelocity); }
-	BitfieldBool bBounceVelocity() { return BoolValue(PropOffsets_ZoneInfo.bBounceVelocity); }
-	BitfieldBool bDestructive() { return BoolValue(PropOffsets_ZoneInfo.bDestructive); }
-	BitfieldBool bFogZone() { return BoolValue(PropOffsets_ZoneInfo.bFogZone); }
-	BitfieldBool bGravityZone() { return BoolValue(PropOffsets_ZoneInfo.bGravityZone); }
-	BitfieldBool bKillZone() { return BoolValue(PropOffsets_ZoneInfo.bKillZone); }
-	BitfieldBool bMoveProjectiles() { return BoolValue(PropOffsets_ZoneInfo.bMoveProjectiles); }
-	BitfieldBool bNeutralZone() { return BoolValue(PropOffsets_ZoneInfo.bNeutralZone); }
-	BitfieldBool bNoInventory() { return BoolValue(PropOffsets_ZoneInfo.bNoInventory); }
-	BitfieldBool bPainZone() { return BoolValue(PropOffsets_ZoneInfo.bPainZone); }
-	BitfieldBool bRaytraceReverb() { return BoolValue(PropOffsets_ZoneInfo.bRaytraceReverb); }
-	BitfieldBool bReverbZone() { return BoolValue(PropOffsets_ZoneInfo.bReverbZone); }
-	BitfieldBool bWaterZone() { return BoolValue(PropOffsets_ZoneInfo.bWaterZone); }
-	Ulocationid*& locationid() { return Value<Ulocationid*>(PropOffsets_ZoneInfo.locationid); }
+	PROPERTY_VALUE(uint8_t, AmbientBrightness, PropOffsets_ZoneInfo.AmbientBrightness)
+	PROPERTY_VALUE(uint8_t, AmbientHue, PropOffsets_ZoneInfo.AmbientHue)
+	PROPERTY_VALUE(uint8_t, AmbientSaturation, PropOffsets_ZoneInfo.AmbientSaturation)
+	PROPERTY_VALUE(int, CutoffHz, PropOffsets_ZoneInfo.CutoffHz)
+	PROPERTY_VALUE(int, DamagePerSec, PropOffsets_ZoneInfo.DamagePerSec)
+	PROPERTY_VALUE(std::string, DamageString, PropOffsets_ZoneInfo.DamageString)
+	PROPERTY_VALUE(NameString, DamageType, PropOffsets_ZoneInfo.DamageType)
+	PROPERTY_VALUE(uint8_t, Delay, PropOffsets_ZoneInfo.Delay)
+	PROPERTY_VALUE(UClass*, EntryActor, PropOffsets_ZoneInfo.EntryActor)
+	PROPERTY_VALUE(USound*, EntrySound, PropOffsets_ZoneInfo.EntrySound)
+	PROPERTY_VALUE(UTexture*, EnvironmentMap, PropOffsets_ZoneInfo.EnvironmentMap)
+	PROPERTY_VALUE(UClass*, ExitActor, PropOffsets_ZoneInfo.ExitActor)
+	PROPERTY_VALUE(USound*, ExitSound, PropOffsets_ZoneInfo.ExitSound)
+	PROPERTY_VALUE(Color, FogColor, PropOffsets_ZoneInfo.FogColor)
+	PROPERTY_VALUE(float, FogDistance, PropOffsets_ZoneInfo.FogDistance)
+	PROPERTY_VALUE(uint8_t, Gain, PropOffsets_ZoneInfo.Gain)
+	PROPERTY_VALUE(UTexture*, LensFlare, PropOffsets_ZoneInfo.LensFlare)
+	PROPERTY_VALUE(float, LensFlareOffset, PropOffsets_ZoneInfo.LensFlareOffset)
+	PROPERTY_VALUE(float, LensFlareScale, PropOffsets_ZoneInfo.LensFlareScale)
+	PROPERTY_VALUE(uint8_t, MasterGain, PropOffsets_ZoneInfo.MasterGain)
+	PROPERTY_VALUE(int, MaxCarcasses, PropOffsets_ZoneInfo.MaxCarcasses)
+	PROPERTY_VALUE(uint8_t, MaxLightCount, PropOffsets_ZoneInfo.MaxLightCount)
+	PROPERTY_VALUE(int, MaxLightingPolyCount, PropOffsets_ZoneInfo.MaxLightingPolyCount)
+	PROPERTY_VALUE(uint8_t, MinLightCount, PropOffsets_ZoneInfo.MinLightCount)
+	PROPERTY_VALUE(int, MinLightingPolyCount, PropOffsets_ZoneInfo.MinLightingPolyCount)
+	PROPERTY_VALUE(int, NumCarcasses, PropOffsets_ZoneInfo.NumCarcasses)
+	PROPERTY_VALUE(USkyZoneInfo*, SkyZone, PropOffsets_ZoneInfo.SkyZone)
+	PROPERTY_VALUE(float, SpeedOfSound, PropOffsets_ZoneInfo.SpeedOfSound)
+	PROPERTY_VALUE(float, TexUPanSpeed, PropOffsets_ZoneInfo.TexUPanSpeed)
+	PROPERTY_VALUE(float, TexVPanSpeed, PropOffsets_ZoneInfo.TexVPanSpeed)
+	PROPERTY_VALUE(vec3, ViewFlash, PropOffsets_ZoneInfo.ViewFlash)
+	PROPERTY_VALUE(vec3, ViewFog, PropOffsets_ZoneInfo.ViewFog)
+	PROPERTY_VALUE(float, ZoneFluidFriction, PropOffsets_ZoneInfo.ZoneFluidFriction)
+	PROPERTY_VALUE(vec3, ZoneGravity, PropOffsets_ZoneInfo.ZoneGravity)
+	PROPERTY_VALUE(float, ZoneGroundFriction, PropOffsets_ZoneInfo.ZoneGroundFriction)
+	PROPERTY_VALUE(std::string, ZoneName, PropOffsets_ZoneInfo.ZoneName)
+	PROPERTY_VALUE(int, ZonePlayerCount, PropOffsets_ZoneInfo.ZonePlayerCount)
+	PROPERTY_VALUE(NameString, ZonePlayerEvent, PropOffsets_ZoneInfo.ZonePlayerEvent)
+	PROPERTY_VALUE(NameString, ZoneTag, PropOffsets_ZoneInfo.ZoneTag)
+	PROPERTY_VALUE(float, ZoneTerminalVelocity, PropOffsets_ZoneInfo.ZoneTerminalVelocity)
+	PROPERTY_VALUE(vec3, ZoneVelocity, PropOffsets_ZoneInfo.ZoneVelocity)
+	PROPERTY_BOOL(bBounceVelocity, PropOffsets_ZoneInfo.bBounceVelocity)
+	PROPERTY_BOOL(bDestructive, PropOffsets_ZoneInfo.bDestructive)
+	PROPERTY_BOOL(bFogZone, PropOffsets_ZoneInfo.bFogZone)
+	PROPERTY_BOOL(bGravityZone, PropOffsets_ZoneInfo.bGravityZone)
+	PROPERTY_BOOL(bKillZone, PropOffsets_ZoneInfo.bKillZone)
+	PROPERTY_BOOL(bMoveProjectiles, PropOffsets_ZoneInfo.bMoveProjectiles)
+	PROPERTY_BOOL(bNeutralZone, PropOffsets_ZoneInfo.bNeutralZone)
+	PROPERTY_BOOL(bNoInventory, PropOffsets_ZoneInfo.bNoInventory)
+	PROPERTY_BOOL(bPainZone, PropOffsets_ZoneInfo.bPainZone)
+	PROPERTY_BOOL(bRaytraceReverb, PropOffsets_ZoneInfo.bRaytraceReverb)
+	PROPERTY_BOOL(bReverbZone, PropOffsets_ZoneInfo.bReverbZone)
+	PROPERTY_BOOL(bWaterZone, PropOffsets_ZoneInfo.bWaterZone)
+	PROPERTY_VALUE(Ulocationid*, locationid, PropOffsets_ZoneInfo.locationid)
 };
 
 class ULevelInfo : public UZoneInfo
@@ -1117,62 +1116,62 @@ public:
 
 	UnrealURL URL;
 
-	int& AIProfile() { return Value<int>(PropOffsets_LevelInfo.AIProfile); }
-	std::string& Author() { return Value<std::string>(PropOffsets_LevelInfo.Author); }
-	float& AvgAITime() { return Value<float>(PropOffsets_LevelInfo.AvgAITime); }
-	float& Brightness() { return Value<float>(PropOffsets_LevelInfo.Brightness); }
-	uint8_t& CdTrack() { return Value<uint8_t>(PropOffsets_LevelInfo.CdTrack); }
-	std::string& ComputerName() { return Value<std::string>(PropOffsets_LevelInfo.ComputerName); }
-	int& Day() { return Value<int>(PropOffsets_LevelInfo.Day); }
-	int& DayOfWeek() { return Value<int>(PropOffsets_LevelInfo.DayOfWeek); }
-	UClass*& DefaultGameType() { return Value<UClass*>(PropOffsets_LevelInfo.DefaultGameType); }
-	UTexture*& DefaultTexture() { return Value<UTexture*>(PropOffsets_LevelInfo.DefaultTexture); }
-	std::string& EngineVersion() { return Value<std::string>(PropOffsets_LevelInfo.EngineVersion); }
-	UGameInfo*& Game() { return Value<UGameInfo*>(PropOffsets_LevelInfo.Game); }
-	int& Hour() { return Value<int>(PropOffsets_LevelInfo.Hour); }
-	int& HubStackLevel() { return Value<int>(PropOffsets_LevelInfo.HubStackLevel); }
-	std::string& IdealPlayerCount() { return Value<std::string>(PropOffsets_LevelInfo.IdealPlayerCount); }
-	uint8_t& LevelAction() { return Value<uint8_t>(PropOffsets_LevelInfo.LevelAction); }
-	std::string& LevelEnterText() { return Value<std::string>(PropOffsets_LevelInfo.LevelEnterText); }
-	std::string& LocalizedPkg() { return Value<std::string>(PropOffsets_LevelInfo.LocalizedPkg); }
-	int& Millisecond() { return Value<int>(PropOffsets_LevelInfo.Millisecond); }
-	std::string& MinNetVersion() { return Value<std::string>(PropOffsets_LevelInfo.MinNetVersion); }
-	int& Minute() { return Value<int>(PropOffsets_LevelInfo.Minute); }
-	int& Month() { return Value<int>(PropOffsets_LevelInfo.Month); }
-	UNavigationPoint*& NavigationPointList() { return Value<UNavigationPoint*>(PropOffsets_LevelInfo.NavigationPointList); }
-	uint8_t& NetMode() { return Value<uint8_t>(PropOffsets_LevelInfo.NetMode); }
-	float& NextSwitchCountdown() { return Value<float>(PropOffsets_LevelInfo.NextSwitchCountdown); }
-	std::string& NextURL() { return Value<std::string>(PropOffsets_LevelInfo.NextURL); }
-	std::string& Pauser() { return Value<std::string>(PropOffsets_LevelInfo.Pauser); }
-	UPawn*& PawnList() { return Value<UPawn*>(PropOffsets_LevelInfo.PawnList); }
-	float& PlayerDoppler() { return Value<float>(PropOffsets_LevelInfo.PlayerDoppler); }
-	int& RecommendedEnemies() { return Value<int>(PropOffsets_LevelInfo.RecommendedEnemies); }
-	int& RecommendedTeammates() { return Value<int>(PropOffsets_LevelInfo.RecommendedTeammates); }
-	UTexture*& Screenshot() { return Value<UTexture*>(PropOffsets_LevelInfo.Screenshot); }
-	int& Second() { return Value<int>(PropOffsets_LevelInfo.Second); }
-	UMusic*& Song() { return Value<UMusic*>(PropOffsets_LevelInfo.Song); }
-	uint8_t& SongSection() { return Value<uint8_t>(PropOffsets_LevelInfo.SongSection); }
-	USpawnNotify*& SpawnNotify() { return Value<USpawnNotify*>(PropOffsets_LevelInfo.SpawnNotify); }
-	ULevelSummary*& Summary() { return Value<ULevelSummary*>(PropOffsets_LevelInfo.Summary); }
-	float& TimeDilation() { return Value<float>(PropOffsets_LevelInfo.TimeDilation); }
-	float& TimeSeconds() { return Value<float>(PropOffsets_LevelInfo.TimeSeconds); }
-	std::string& Title() { return Value<std::string>(PropOffsets_LevelInfo.Title); }
-	std::string& VisibleGroups() { return Value<std::string>(PropOffsets_LevelInfo.VisibleGroups); }
-	int& Year() { return Value<int>(PropOffsets_LevelInfo.Year); }
-	BitfieldBool bAggressiveLOD() { return BoolValue(PropOffsets_LevelInfo.bAggressiveLOD); }
-	BitfieldBool bAllowFOV() { return BoolValue(PropOffsets_LevelInfo.bAllowFOV); }
-	BitfieldBool bBegunPlay() { return BoolValue(PropOffsets_LevelInfo.bBegunPlay); }
-	BitfieldBool bCheckWalkSurfaces() { return BoolValue(PropOffsets_LevelInfo.bCheckWalkSurfaces); }
-	BitfieldBool bDropDetail() { return BoolValue(PropOffsets_LevelInfo.bDropDetail); }
-	BitfieldBool bHighDetailMode() { return BoolValue(PropOffsets_LevelInfo.bHighDetailMode); }
-	BitfieldBool bHumansOnly() { return BoolValue(PropOffsets_LevelInfo.bHumansOnly); }
-	BitfieldBool bLonePlayer() { return BoolValue(PropOffsets_LevelInfo.bLonePlayer); }
-	BitfieldBool bLowRes() { return BoolValue(PropOffsets_LevelInfo.bLowRes); }
-	BitfieldBool bNeverPrecache() { return BoolValue(PropOffsets_LevelInfo.bNeverPrecache); }
-	BitfieldBool bNextItems() { return BoolValue(PropOffsets_LevelInfo.bNextItems); }
-	BitfieldBool bNoCheating() { return BoolValue(PropOffsets_LevelInfo.bNoCheating); }
-	BitfieldBool bPlayersOnly() { return BoolValue(PropOffsets_LevelInfo.bPlayersOnly); }
-	BitfieldBool bStartup() { return BoolValue(PropOffsets_LevelInfo.bStartup); }
+	PROPERTY_VALUE(int, AIProfile, PropOffsets_LevelInfo.AIProfile)
+	PROPERTY_VALUE(std::string, Author, PropOffsets_LevelInfo.Author)
+	PROPERTY_VALUE(float, AvgAITime, PropOffsets_LevelInfo.AvgAITime)
+	PROPERTY_VALUE(float, Brightness, PropOffsets_LevelInfo.Brightness)
+	PROPERTY_VALUE(uint8_t, CdTrack, PropOffsets_LevelInfo.CdTrack)
+	PROPERTY_VALUE(std::string, ComputerName, PropOffsets_LevelInfo.ComputerName)
+	PROPERTY_VALUE(int, Day, PropOffsets_LevelInfo.Day)
+	PROPERTY_VALUE(int, DayOfWeek, PropOffsets_LevelInfo.DayOfWeek)
+	PROPERTY_VALUE(UClass*, DefaultGameType, PropOffsets_LevelInfo.DefaultGameType)
+	PROPERTY_VALUE(UTexture*, DefaultTexture, PropOffsets_LevelInfo.DefaultTexture)
+	PROPERTY_VALUE(std::string, EngineVersion, PropOffsets_LevelInfo.EngineVersion)
+	PROPERTY_VALUE(UGameInfo*, Game, PropOffsets_LevelInfo.Game)
+	PROPERTY_VALUE(int, Hour, PropOffsets_LevelInfo.Hour)
+	PROPERTY_VALUE(int, HubStackLevel, PropOffsets_LevelInfo.HubStackLevel)
+	PROPERTY_VALUE(std::string, IdealPlayerCount, PropOffsets_LevelInfo.IdealPlayerCount)
+	PROPERTY_VALUE(uint8_t, LevelAction, PropOffsets_LevelInfo.LevelAction)
+	PROPERTY_VALUE(std::string, LevelEnterText, PropOffsets_LevelInfo.LevelEnterText)
+	PROPERTY_VALUE(std::string, LocalizedPkg, PropOffsets_LevelInfo.LocalizedPkg)
+	PROPERTY_VALUE(int, Millisecond, PropOffsets_LevelInfo.Millisecond)
+	PROPERTY_VALUE(std::string, MinNetVersion, PropOffsets_LevelInfo.MinNetVersion)
+	PROPERTY_VALUE(int, Minute, PropOffsets_LevelInfo.Minute)
+	PROPERTY_VALUE(int, Month, PropOffsets_LevelInfo.Month)
+	PROPERTY_VALUE(UNavigationPoint*, NavigationPointList, PropOffsets_LevelInfo.NavigationPointList)
+	PROPERTY_VALUE(uint8_t, NetMode, PropOffsets_LevelInfo.NetMode)
+	PROPERTY_VALUE(float, NextSwitchCountdown, PropOffsets_LevelInfo.NextSwitchCountdown)
+	PROPERTY_VALUE(std::string, NextURL, PropOffsets_LevelInfo.NextURL)
+	PROPERTY_VALUE(std::string, Pauser, PropOffsets_LevelInfo.Pauser)
+	PROPERTY_VALUE(UPawn*, PawnList, PropOffsets_LevelInfo.PawnList)
+	PROPERTY_VALUE(float, PlayerDoppler, PropOffsets_LevelInfo.PlayerDoppler)
+	PROPERTY_VALUE(int, RecommendedEnemies, PropOffsets_LevelInfo.RecommendedEnemies)
+	PROPERTY_VALUE(int, RecommendedTeammates, PropOffsets_LevelInfo.RecommendedTeammates)
+	PROPERTY_VALUE(UTexture*, Screenshot, PropOffsets_LevelInfo.Screenshot)
+	PROPERTY_VALUE(int, Second, PropOffsets_LevelInfo.Second)
+	PROPERTY_VALUE(UMusic*, Song, PropOffsets_LevelInfo.Song)
+	PROPERTY_VALUE(uint8_t, SongSection, PropOffsets_LevelInfo.SongSection)
+	PROPERTY_VALUE(USpawnNotify*, SpawnNotify, PropOffsets_LevelInfo.SpawnNotify)
+	PROPERTY_VALUE(ULevelSummary*, Summary, PropOffsets_LevelInfo.Summary)
+	PROPERTY_VALUE(float, TimeDilation, PropOffsets_LevelInfo.TimeDilation)
+	PROPERTY_VALUE(float, TimeSeconds, PropOffsets_LevelInfo.TimeSeconds)
+	PROPERTY_VALUE(std::string, Title, PropOffsets_LevelInfo.Title)
+	PROPERTY_VALUE(std::string, VisibleGroups, PropOffsets_LevelInfo.VisibleGroups)
+	PROPERTY_VALUE(int, Year, PropOffsets_LevelInfo.Year)
+	PROPERTY_BOOL(bAggressiveLOD, PropOffsets_LevelInfo.bAggressiveLOD)
+	PROPERTY_BOOL(bAllowFOV, PropOffsets_LevelInfo.bAllowFOV)
+	PROPERTY_BOOL(bBegunPlay, PropOffsets_LevelInfo.bBegunPlay)
+	PROPERTY_BOOL(bCheckWalkSurfaces, PropOffsets_LevelInfo.bCheckWalkSurfaces)
+	PROPERTY_BOOL(bDropDetail, PropOffsets_LevelInfo.bDropDetail)
+	PROPERTY_BOOL(bHighDetailMode, PropOffsets_LevelInfo.bHighDetailMode)
+	PROPERTY_BOOL(bHumansOnly, PropOffsets_LevelInfo.bHumansOnly)
+	PROPERTY_BOOL(bLonePlayer, PropOffsets_LevelInfo.bLonePlayer)
+	PROPERTY_BOOL(bLowRes, PropOffsets_LevelInfo.bLowRes)
+	PROPERTY_BOOL(bNeverPrecache, PropOffsets_LevelInfo.bNeverPrecache)
+	PROPERTY_BOOL(bNextItems, PropOffsets_LevelInfo.bNextItems)
+	PROPERTY_BOOL(bNoCheating, PropOffsets_LevelInfo.bNoCheating)
+	PROPERTY_BOOL(bPlayersOnly, PropOffsets_LevelInfo.bPlayersOnly)
+	PROPERTY_BOOL(bStartup, PropOffsets_LevelInfo.bStartup)
 };
 
 class UWarpZoneInfo : public UZoneInfo
@@ -1180,15 +1179,15 @@ class UWarpZoneInfo : public UZoneInfo
 public:
 	using UZoneInfo::UZoneInfo;
 
-	std::string& Destinations() { return Value<std::string>(PropOffsets_WarpZoneInfo.Destinations); }
-	UWarpZoneInfo*& OtherSideActor() { return Value<UWarpZoneInfo*>(PropOffsets_WarpZoneInfo.OtherSideActor); }
-	UObject*& OtherSideLevel() { return Value<UObject*>(PropOffsets_WarpZoneInfo.OtherSideLevel); }
-	std::string& OtherSideURL() { return Value<std::string>(PropOffsets_WarpZoneInfo.OtherSideURL); }
-	NameString& ThisTag() { return Value<NameString>(PropOffsets_WarpZoneInfo.ThisTag); }
+	PROPERTY_VALUE(std::string, Destinations, PropOffsets_WarpZoneInfo.Destinations)
+	PROPERTY_VALUE(UWarpZoneInfo*, OtherSideActor, PropOffsets_WarpZoneInfo.OtherSideActor)
+	PROPERTY_VALUE(UObject*, OtherSideLevel, PropOffsets_WarpZoneInfo.OtherSideLevel)
+	PROPERTY_VALUE(std::string, OtherSideURL, PropOffsets_WarpZoneInfo.OtherSideURL)
+	PROPERTY_VALUE(NameString, ThisTag, PropOffsets_WarpZoneInfo.ThisTag)
 	//Coords& WarpCoords() { return Value<Coords>(PropOffsets_WarpZoneInfo.WarpCoords); }
-	BitfieldBool bNoTeleFrag() { return BoolValue(PropOffsets_WarpZoneInfo.bNoTeleFrag); }
-	int& iWarpZone() { return Value<int>(PropOffsets_WarpZoneInfo.iWarpZone); }
-	int& numDestinations() { return Value<int>(PropOffsets_WarpZoneInfo.numDestinations); }
+	PROPERTY_BOOL(bNoTeleFrag, PropOffsets_WarpZoneInfo.bNoTeleFrag)
+	PROPERTY_VALUE(int, iWarpZone, PropOffsets_WarpZoneInfo.iWarpZone)
+	PROPERTY_VALUE(int, numDestinations, PropOffsets_WarpZoneInfo.numDestinations)
 };
 
 class USkyZoneInfo : public UZoneInfo
@@ -1208,29 +1207,29 @@ class UPlayerReplicationInfo : public UReplicationInfo
 public:
 	using UReplicationInfo::UReplicationInfo;
 
-	float& Deaths() { return Value<float>(PropOffsets_PlayerReplicationInfo.Deaths); }
-	UDecoration*& HasFlag() { return Value<UDecoration*>(PropOffsets_PlayerReplicationInfo.HasFlag); }
-	std::string& OldName() { return Value<std::string>(PropOffsets_PlayerReplicationInfo.OldName); }
-	uint8_t& PacketLoss() { return Value<uint8_t>(PropOffsets_PlayerReplicationInfo.PacketLoss); }
-	int& Ping() { return Value<int>(PropOffsets_PlayerReplicationInfo.Ping); }
-	int& PlayerID() { return Value<int>(PropOffsets_PlayerReplicationInfo.PlayerID); }
-	Ulocationid*& PlayerLocation() { return Value<Ulocationid*>(PropOffsets_PlayerReplicationInfo.PlayerLocation); }
-	std::string& PlayerName() { return Value<std::string>(PropOffsets_PlayerReplicationInfo.PlayerName); }
-	UZoneInfo*& PlayerZone() { return Value<UZoneInfo*>(PropOffsets_PlayerReplicationInfo.PlayerZone); }
-	float& Score() { return Value<float>(PropOffsets_PlayerReplicationInfo.Score); }
-	int& StartTime() { return Value<int>(PropOffsets_PlayerReplicationInfo.StartTime); }
-	UTexture*& TalkTexture() { return Value<UTexture*>(PropOffsets_PlayerReplicationInfo.TalkTexture); }
-	uint8_t& Team() { return Value<uint8_t>(PropOffsets_PlayerReplicationInfo.Team); }
-	int& TeamID() { return Value<int>(PropOffsets_PlayerReplicationInfo.TeamID); }
-	std::string& TeamName() { return Value<std::string>(PropOffsets_PlayerReplicationInfo.TeamName); }
-	int& TimeAcc() { return Value<int>(PropOffsets_PlayerReplicationInfo.TimeAcc); }
-	UClass*& VoiceType() { return Value<UClass*>(PropOffsets_PlayerReplicationInfo.VoiceType); }
-	BitfieldBool bAdmin() { return BoolValue(PropOffsets_PlayerReplicationInfo.bAdmin); }
-	BitfieldBool bFeigningDeath() { return BoolValue(PropOffsets_PlayerReplicationInfo.bFeigningDeath); }
-	BitfieldBool bIsABot() { return BoolValue(PropOffsets_PlayerReplicationInfo.bIsABot); }
-	BitfieldBool bIsFemale() { return BoolValue(PropOffsets_PlayerReplicationInfo.bIsFemale); }
-	BitfieldBool bIsSpectator() { return BoolValue(PropOffsets_PlayerReplicationInfo.bIsSpectator); }
-	BitfieldBool bWaitingPlayer() { return BoolValue(PropOffsets_PlayerReplicationInfo.bWaitingPlayer); }
+	PROPERTY_VALUE(float, Deaths, PropOffsets_PlayerReplicationInfo.Deaths)
+	PROPERTY_VALUE(UDecoration*, HasFlag, PropOffsets_PlayerReplicationInfo.HasFlag)
+	PROPERTY_VALUE(std::string, OldName, PropOffsets_PlayerReplicationInfo.OldName)
+	PROPERTY_VALUE(uint8_t, PacketLoss, PropOffsets_PlayerReplicationInfo.PacketLoss)
+	PROPERTY_VALUE(int, Ping, PropOffsets_PlayerReplicationInfo.Ping)
+	PROPERTY_VALUE(int, PlayerID, PropOffsets_PlayerReplicationInfo.PlayerID)
+	PROPERTY_VALUE(Ulocationid*, PlayerLocation, PropOffsets_PlayerReplicationInfo.PlayerLocation)
+	PROPERTY_VALUE(std::string, PlayerName, PropOffsets_PlayerReplicationInfo.PlayerName)
+	PROPERTY_VALUE(UZoneInfo*, PlayerZone, PropOffsets_PlayerReplicationInfo.PlayerZone)
+	PROPERTY_VALUE(float, Score, PropOffsets_PlayerReplicationInfo.Score)
+	PROPERTY_VALUE(int, StartTime, PropOffsets_PlayerReplicationInfo.StartTime)
+	PROPERTY_VALUE(UTexture*, TalkTexture, PropOffsets_PlayerReplicationInfo.TalkTexture)
+	PROPERTY_VALUE(uint8_t, Team, PropOffsets_PlayerReplicationInfo.Team)
+	PROPERTY_VALUE(int, TeamID, PropOffsets_PlayerReplicationInfo.TeamID)
+	PROPERTY_VALUE(std::string, TeamName, PropOffsets_PlayerReplicationInfo.TeamName)
+	PROPERTY_VALUE(int, TimeAcc, PropOffsets_PlayerReplicationInfo.TimeAcc)
+	PROPERTY_VALUE(UClass*, VoiceType, PropOffsets_PlayerReplicationInfo.VoiceType)
+	PROPERTY_BOOL(bAdmin, PropOffsets_PlayerReplicationInfo.bAdmin)
+	PROPERTY_BOOL(bFeigningDeath, PropOffsets_PlayerReplicationInfo.bFeigningDeath)
+	PROPERTY_BOOL(bIsABot, PropOffsets_PlayerReplicationInfo.bIsABot)
+	PROPERTY_BOOL(bIsFemale, PropOffsets_PlayerReplicationInfo.bIsFemale)
+	PROPERTY_BOOL(bIsSpectator, PropOffsets_PlayerReplicationInfo.bIsSpectator)
+	PROPERTY_BOOL(bWaitingPlayer, PropOffsets_PlayerReplicationInfo.bWaitingPlayer)
 };
 
 class UGameReplicationInfo : public UReplicationInfo
@@ -1238,29 +1237,29 @@ class UGameReplicationInfo : public UReplicationInfo
 public:
 	using UReplicationInfo::UReplicationInfo;
 
-	std::string& AdminEmail() { return Value<std::string>(PropOffsets_GameReplicationInfo.AdminEmail); }
-	std::string& AdminName() { return Value<std::string>(PropOffsets_GameReplicationInfo.AdminName); }
-	int& ElapsedTime() { return Value<int>(PropOffsets_GameReplicationInfo.ElapsedTime); }
-	std::string& GameClass() { return Value<std::string>(PropOffsets_GameReplicationInfo.GameClass); }
-	std::string& GameEndedComments() { return Value<std::string>(PropOffsets_GameReplicationInfo.GameEndedComments); }
-	std::string& GameName() { return Value<std::string>(PropOffsets_GameReplicationInfo.GameName); }
-	std::string& MOTDLine1() { return Value<std::string>(PropOffsets_GameReplicationInfo.MOTDLine1); }
-	std::string& MOTDLine2() { return Value<std::string>(PropOffsets_GameReplicationInfo.MOTDLine2); }
-	std::string& MOTDLine3() { return Value<std::string>(PropOffsets_GameReplicationInfo.MOTDLine3); }
-	std::string& MOTDLine4() { return Value<std::string>(PropOffsets_GameReplicationInfo.MOTDLine4); }
-	int& NumPlayers() { return Value<int>(PropOffsets_GameReplicationInfo.NumPlayers); }
-	UPlayerReplicationInfo*& PRIArray() { return Value<UPlayerReplicationInfo*>(PropOffsets_GameReplicationInfo.PRIArray); }
-	int& Region() { return Value<int>(PropOffsets_GameReplicationInfo.Region); }
-	int& RemainingMinute() { return Value<int>(PropOffsets_GameReplicationInfo.RemainingMinute); }
-	int& RemainingTime() { return Value<int>(PropOffsets_GameReplicationInfo.RemainingTime); }
-	float& SecondCount() { return Value<float>(PropOffsets_GameReplicationInfo.SecondCount); }
-	std::string& ServerName() { return Value<std::string>(PropOffsets_GameReplicationInfo.ServerName); }
-	std::string& ShortName() { return Value<std::string>(PropOffsets_GameReplicationInfo.ShortName); }
-	int& SumFrags() { return Value<int>(PropOffsets_GameReplicationInfo.SumFrags); }
-	float& UpdateTimer() { return Value<float>(PropOffsets_GameReplicationInfo.UpdateTimer); }
-	BitfieldBool bClassicDeathMessages() { return BoolValue(PropOffsets_GameReplicationInfo.bClassicDeathMessages); }
-	BitfieldBool bStopCountDown() { return BoolValue(PropOffsets_GameReplicationInfo.bStopCountDown); }
-	BitfieldBool bTeamGame() { return BoolValue(PropOffsets_GameReplicationInfo.bTeamGame); }
+	PROPERTY_VALUE(std::string, AdminEmail, PropOffsets_GameReplicationInfo.AdminEmail)
+	PROPERTY_VALUE(std::string, AdminName, PropOffsets_GameReplicationInfo.AdminName)
+	PROPERTY_VALUE(int, ElapsedTime, PropOffsets_GameReplicationInfo.ElapsedTime)
+	PROPERTY_VALUE(std::string, GameClass, PropOffsets_GameReplicationInfo.GameClass)
+	PROPERTY_VALUE(std::string, GameEndedComments, PropOffsets_GameReplicationInfo.GameEndedComments)
+	PROPERTY_VALUE(std::string, GameName, PropOffsets_GameReplicationInfo.GameName)
+	PROPERTY_VALUE(std::string, MOTDLine1, PropOffsets_GameReplicationInfo.MOTDLine1)
+	PROPERTY_VALUE(std::string, MOTDLine2, PropOffsets_GameReplicationInfo.MOTDLine2)
+	PROPERTY_VALUE(std::string, MOTDLine3, PropOffsets_GameReplicationInfo.MOTDLine3)
+	PROPERTY_VALUE(std::string, MOTDLine4, PropOffsets_GameReplicationInfo.MOTDLine4)
+	PROPERTY_VALUE(int, NumPlayers, PropOffsets_GameReplicationInfo.NumPlayers)
+	PROPERTY_VALUE(UPlayerReplicationInfo*, PRIArray, PropOffsets_GameReplicationInfo.PRIArray)
+	PROPERTY_VALUE(int, Region, PropOffsets_GameReplicationInfo.Region)
+	PROPERTY_VALUE(int, RemainingMinute, PropOffsets_GameReplicationInfo.RemainingMinute)
+	PROPERTY_VALUE(int, RemainingTime, PropOffsets_GameReplicationInfo.RemainingTime)
+	PROPERTY_VALUE(float, SecondCount, PropOffsets_GameReplicationInfo.SecondCount)
+	PROPERTY_VALUE(std::string, ServerName, PropOffsets_GameReplicationInfo.ServerName)
+	PROPERTY_VALUE(std::string, ShortName, PropOffsets_GameReplicationInfo.ShortName)
+	PROPERTY_VALUE(int, SumFrags, PropOffsets_GameReplicationInfo.SumFrags)
+	PROPERTY_VALUE(float, UpdateTimer, PropOffsets_GameReplicationInfo.UpdateTimer)
+	PROPERTY_BOOL(bClassicDeathMessages, PropOffsets_GameReplicationInfo.bClassicDeathMessages)
+	PROPERTY_BOOL(bStopCountDown, PropOffsets_GameReplicationInfo.bStopCountDown)
+	PROPERTY_BOOL(bTeamGame, PropOffsets_GameReplicationInfo.bTeamGame)
 };
 
 class UStatLog : public UInfo
@@ -1268,26 +1267,26 @@ class UStatLog : public UInfo
 public:
 	using UInfo::UInfo;
 
-	int& Context() { return Value<int>(PropOffsets_StatLog.Context); }
-	std::string& DecoderRingURL() { return Value<std::string>(PropOffsets_StatLog.DecoderRingURL); }
-	std::string& GameCreator() { return Value<std::string>(PropOffsets_StatLog.GameCreator); }
-	std::string& GameCreatorURL() { return Value<std::string>(PropOffsets_StatLog.GameCreatorURL); }
-	std::string& GameName() { return Value<std::string>(PropOffsets_StatLog.GameName); }
-	std::string& LocalBatcherParams() { return Value<std::string>(PropOffsets_StatLog.LocalBatcherParams); }
-	std::string& LocalBatcherURL() { return Value<std::string>(PropOffsets_StatLog.LocalBatcherURL); }
-	std::string& LocalLogDir() { return Value<std::string>(PropOffsets_StatLog.LocalLogDir); }
-	std::string& LocalStandard() { return Value<std::string>(PropOffsets_StatLog.LocalStandard); }
-	std::string& LocalStatsURL() { return Value<std::string>(PropOffsets_StatLog.LocalStatsURL); }
-	std::string& LogInfoURL() { return Value<std::string>(PropOffsets_StatLog.LogInfoURL); }
-	std::string& LogVersion() { return Value<std::string>(PropOffsets_StatLog.LogVersion); }
-	float& TimeStamp() { return Value<float>(PropOffsets_StatLog.TimeStamp); }
-	std::string& WorldBatcherParams() { return Value<std::string>(PropOffsets_StatLog.WorldBatcherParams); }
-	std::string& WorldBatcherURL() { return Value<std::string>(PropOffsets_StatLog.WorldBatcherURL); }
-	std::string& WorldLogDir() { return Value<std::string>(PropOffsets_StatLog.WorldLogDir); }
-	std::string& WorldStandard() { return Value<std::string>(PropOffsets_StatLog.WorldStandard); }
-	std::string& WorldStatsURL() { return Value<std::string>(PropOffsets_StatLog.WorldStatsURL); }
-	BitfieldBool bWorld() { return BoolValue(PropOffsets_StatLog.bWorld); }
-	BitfieldBool bWorldBatcherError() { return BoolValue(PropOffsets_StatLog.bWorldBatcherError); }
+	PROPERTY_VALUE(int, Context, PropOffsets_StatLog.Context)
+	PROPERTY_VALUE(std::string, DecoderRingURL, PropOffsets_StatLog.DecoderRingURL)
+	PROPERTY_VALUE(std::string, GameCreator, PropOffsets_StatLog.GameCreator)
+	PROPERTY_VALUE(std::string, GameCreatorURL, PropOffsets_StatLog.GameCreatorURL)
+	PROPERTY_VALUE(std::string, GameName, PropOffsets_StatLog.GameName)
+	PROPERTY_VALUE(std::string, LocalBatcherParams, PropOffsets_StatLog.LocalBatcherParams)
+	PROPERTY_VALUE(std::string, LocalBatcherURL, PropOffsets_StatLog.LocalBatcherURL)
+	PROPERTY_VALUE(std::string, LocalLogDir, PropOffsets_StatLog.LocalLogDir)
+	PROPERTY_VALUE(std::string, LocalStandard, PropOffsets_StatLog.LocalStandard)
+	PROPERTY_VALUE(std::string, LocalStatsURL, PropOffsets_StatLog.LocalStatsURL)
+	PROPERTY_VALUE(std::string, LogInfoURL, PropOffsets_StatLog.LogInfoURL)
+	PROPERTY_VALUE(std::string, LogVersion, PropOffsets_StatLog.LogVersion)
+	PROPERTY_VALUE(float, TimeStamp, PropOffsets_StatLog.TimeStamp)
+	PROPERTY_VALUE(std::string, WorldBatcherParams, PropOffsets_StatLog.WorldBatcherParams)
+	PROPERTY_VALUE(std::string, WorldBatcherURL, PropOffsets_StatLog.WorldBatcherURL)
+	PROPERTY_VALUE(std::string, WorldLogDir, PropOffsets_StatLog.WorldLogDir)
+	PROPERTY_VALUE(std::string, WorldStandard, PropOffsets_StatLog.WorldStandard)
+	PROPERTY_VALUE(std::string, WorldStatsURL, PropOffsets_StatLog.WorldStatsURL)
+	PROPERTY_BOOL(bWorld, PropOffsets_StatLog.bWorld)
+	PROPERTY_BOOL(bWorldBatcherError, PropOffsets_StatLog.bWorldBatcherError)
 };
 
 class UStatLogFile : public UStatLog
@@ -1295,10 +1294,10 @@ class UStatLogFile : public UStatLog
 public:
 	using UStatLog::UStatLog;
 
-	int& LogAr() { return Value<int>(PropOffsets_StatLogFile.LogAr); }
-	std::string& StatLogFile() { return Value<std::string>(PropOffsets_StatLogFile.StatLogFile); }
-	std::string& StatLogFinal() { return Value<std::string>(PropOffsets_StatLogFile.StatLogFinal); }
-	BitfieldBool bWatermark() { return BoolValue(PropOffsets_StatLogFile.bWatermark); }
+	PROPERTY_VALUE(int, LogAr, PropOffsets_StatLogFile.LogAr)
+	PROPERTY_VALUE(std::string, StatLogFile, PropOffsets_StatLogFile.StatLogFile)
+	PROPERTY_VALUE(std::string, StatLogFinal, PropOffsets_StatLogFile.StatLogFinal)
+	PROPERTY_BOOL(bWatermark, PropOffsets_StatLogFile.bWatermark)
 };
 
 class UBrush : public UActor
@@ -1306,15 +1305,15 @@ class UBrush : public UActor
 public:
 	using UActor::UActor;
 
-	Color& BrushColor() { return Value<Color>(PropOffsets_Brush.BrushColor); }
-	uint8_t& CsgOper() { return Value<uint8_t>(PropOffsets_Brush.CsgOper); }
+	PROPERTY_VALUE(Color, BrushColor, PropOffsets_Brush.BrushColor)
+	PROPERTY_VALUE(uint8_t, CsgOper, PropOffsets_Brush.CsgOper)
 	// Scale& MainScale() { return Value<Scale>(PropOffsets_Brush.MainScale); }
-	int& PolyFlags() { return Value<int>(PropOffsets_Brush.PolyFlags); }
-	vec3& PostPivot() { return Value<vec3>(PropOffsets_Brush.PostPivot); }
+	PROPERTY_VALUE(int, PolyFlags, PropOffsets_Brush.PolyFlags)
+	PROPERTY_VALUE(vec3, PostPivot, PropOffsets_Brush.PostPivot)
 	// Scale& PostScale() { return Value<Scale>(PropOffsets_Brush.PostScale); }
 	// Scale& TempScale() { return Value<Scale>(PropOffsets_Brush.TempScale); }
-	UObject*& UnusedLightMesh() { return Value<UObject*>(PropOffsets_Brush.UnusedLightMesh); }
-	BitfieldBool bColored() { return BoolValue(PropOffsets_Brush.bColored); }
+	PROPERTY_VALUE(UObject*, UnusedLightMesh, PropOffsets_Brush.UnusedLightMesh)
+	PROPERTY_BOOL(bColored, PropOffsets_Brush.bColored)
 };
 
 class UMover : public UBrush
@@ -1324,63 +1323,63 @@ public:
 
 	virtual double TraceTest(ULevel* level, const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, double height, double radius);
 
-	vec3& BasePos() { return Value<vec3>(PropOffsets_Mover.BasePos); }
-	Rotator& BaseRot() { return Value<Rotator>(PropOffsets_Mover.BaseRot); }
-	uint8_t& BrushRaytraceKey() { return Value<uint8_t>(PropOffsets_Mover.BrushRaytraceKey); }
-	NameString& BumpEvent() { return Value<NameString>(PropOffsets_Mover.BumpEvent); }
-	uint8_t& BumpType() { return Value<uint8_t>(PropOffsets_Mover.BumpType); }
-	int& ClientUpdate() { return Value<int>(PropOffsets_Mover.ClientUpdate); }
-	USound*& ClosedSound() { return Value<USound*>(PropOffsets_Mover.ClosedSound); }
-	USound*& ClosingSound() { return Value<USound*>(PropOffsets_Mover.ClosingSound); }
-	float& DamageThreshold() { return Value<float>(PropOffsets_Mover.DamageThreshold); }
-	float& DelayTime() { return Value<float>(PropOffsets_Mover.DelayTime); }
-	int& EncroachDamage() { return Value<int>(PropOffsets_Mover.EncroachDamage); }
-	UMover*& Follower() { return Value<UMover*>(PropOffsets_Mover.Follower); }
-	uint8_t& KeyNum() { return Value<uint8_t>(PropOffsets_Mover.KeyNum); }
-	vec3* KeyPos() { return FixedArray<vec3>(PropOffsets_Mover.KeyPos); }
-	Rotator* KeyRot() { return FixedArray<Rotator>(PropOffsets_Mover.KeyRot); }
-	UMover*& Leader() { return Value<UMover*>(PropOffsets_Mover.Leader); }
-	USound*& MoveAmbientSound() { return Value<USound*>(PropOffsets_Mover.MoveAmbientSound); }
-	float& MoveTime() { return Value<float>(PropOffsets_Mover.MoveTime); }
-	uint8_t& MoverEncroachType() { return Value<uint8_t>(PropOffsets_Mover.MoverEncroachType); }
-	uint8_t& MoverGlideType() { return Value<uint8_t>(PropOffsets_Mover.MoverGlideType); }
-	uint8_t& NumKeys() { return Value<uint8_t>(PropOffsets_Mover.NumKeys); }
-	vec3& OldPos() { return Value<vec3>(PropOffsets_Mover.OldPos); }
-	vec3& OldPrePivot() { return Value<vec3>(PropOffsets_Mover.OldPrePivot); }
-	Rotator& OldRot() { return Value<Rotator>(PropOffsets_Mover.OldRot); }
-	USound*& OpenedSound() { return Value<USound*>(PropOffsets_Mover.OpenedSound); }
-	USound*& OpeningSound() { return Value<USound*>(PropOffsets_Mover.OpeningSound); }
-	float& OtherTime() { return Value<float>(PropOffsets_Mover.OtherTime); }
-	NameString& PlayerBumpEvent() { return Value<NameString>(PropOffsets_Mover.PlayerBumpEvent); }
-	uint8_t& PrevKeyNum() { return Value<uint8_t>(PropOffsets_Mover.PrevKeyNum); }
-	vec3& RealPosition() { return Value<vec3>(PropOffsets_Mover.RealPosition); }
-	Rotator& RealRotation() { return Value<Rotator>(PropOffsets_Mover.RealRotation); }
-	UTrigger*& RecommendedTrigger() { return Value<UTrigger*>(PropOffsets_Mover.RecommendedTrigger); }
-	NameString& ReturnGroup() { return Value<NameString>(PropOffsets_Mover.ReturnGroup); }
-	vec3& SavedPos() { return Value<vec3>(PropOffsets_Mover.SavedPos); }
-	Rotator& SavedRot() { return Value<Rotator>(PropOffsets_Mover.SavedRot); }
-	UActor*& SavedTrigger() { return Value<UActor*>(PropOffsets_Mover.SavedTrigger); }
-	vec3& SimInterpolate() { return Value<vec3>(PropOffsets_Mover.SimInterpolate); }
-	vec3& SimOldPos() { return Value<vec3>(PropOffsets_Mover.SimOldPos); }
-	int& SimOldRotPitch() { return Value<int>(PropOffsets_Mover.SimOldRotPitch); }
-	int& SimOldRotRoll() { return Value<int>(PropOffsets_Mover.SimOldRotRoll); }
-	int& SimOldRotYaw() { return Value<int>(PropOffsets_Mover.SimOldRotYaw); }
-	float& StayOpenTime() { return Value<float>(PropOffsets_Mover.StayOpenTime); }
-	UActor*& TriggerActor() { return Value<UActor*>(PropOffsets_Mover.TriggerActor); }
-	UActor*& TriggerActor2() { return Value<UActor*>(PropOffsets_Mover.TriggerActor2); }
-	UPawn*& WaitingPawn() { return Value<UPawn*>(PropOffsets_Mover.WaitingPawn); }
-	uint8_t& WorldRaytraceKey() { return Value<uint8_t>(PropOffsets_Mover.WorldRaytraceKey); }
-	BitfieldBool bClientPause() { return BoolValue(PropOffsets_Mover.bClientPause); }
-	BitfieldBool bDamageTriggered() { return BoolValue(PropOffsets_Mover.bDamageTriggered); }
-	BitfieldBool bDelaying() { return BoolValue(PropOffsets_Mover.bDelaying); }
-	BitfieldBool bDynamicLightMover() { return BoolValue(PropOffsets_Mover.bDynamicLightMover); }
-	BitfieldBool bOpening() { return BoolValue(PropOffsets_Mover.bOpening); }
-	BitfieldBool bPlayerOnly() { return BoolValue(PropOffsets_Mover.bPlayerOnly); }
-	BitfieldBool bSlave() { return BoolValue(PropOffsets_Mover.bSlave); }
-	BitfieldBool bTriggerOnceOnly() { return BoolValue(PropOffsets_Mover.bTriggerOnceOnly); }
-	BitfieldBool bUseTriggered() { return BoolValue(PropOffsets_Mover.bUseTriggered); }
-	UNavigationPoint*& myMarker() { return Value<UNavigationPoint*>(PropOffsets_Mover.myMarker); }
-	int& numTriggerEvents() { return Value<int>(PropOffsets_Mover.numTriggerEvents); }
+	PROPERTY_VALUE(vec3, BasePos, PropOffsets_Mover.BasePos)
+	PROPERTY_VALUE(Rotator, BaseRot, PropOffsets_Mover.BaseRot)
+	PROPERTY_VALUE(uint8_t, BrushRaytraceKey, PropOffsets_Mover.BrushRaytraceKey)
+	PROPERTY_VALUE(NameString, BumpEvent, PropOffsets_Mover.BumpEvent)
+	PROPERTY_VALUE(uint8_t, BumpType, PropOffsets_Mover.BumpType)
+	PROPERTY_VALUE(int, ClientUpdate, PropOffsets_Mover.ClientUpdate)
+	PROPERTY_VALUE(USound*, ClosedSound, PropOffsets_Mover.ClosedSound)
+	PROPERTY_VALUE(USound*, ClosingSound, PropOffsets_Mover.ClosingSound)
+	PROPERTY_VALUE(float, DamageThreshold, PropOffsets_Mover.DamageThreshold)
+	PROPERTY_VALUE(float, DelayTime, PropOffsets_Mover.DelayTime)
+	PROPERTY_VALUE(int, EncroachDamage, PropOffsets_Mover.EncroachDamage)
+	PROPERTY_VALUE(UMover*, Follower, PropOffsets_Mover.Follower)
+	PROPERTY_VALUE(uint8_t, KeyNum, PropOffsets_Mover.KeyNum)
+	PROPERTY_FIXEDARRAY(vec3, KeyPos, PropOffsets_Mover.KeyPos)
+	PROPERTY_FIXEDARRAY(Rotator, KeyRot, PropOffsets_Mover.KeyRot)
+	PROPERTY_VALUE(UMover*, Leader, PropOffsets_Mover.Leader)
+	PROPERTY_VALUE(USound*, MoveAmbientSound, PropOffsets_Mover.MoveAmbientSound)
+	PROPERTY_VALUE(float, MoveTime, PropOffsets_Mover.MoveTime)
+	PROPERTY_VALUE(uint8_t, MoverEncroachType, PropOffsets_Mover.MoverEncroachType)
+	PROPERTY_VALUE(uint8_t, MoverGlideType, PropOffsets_Mover.MoverGlideType)
+	PROPERTY_VALUE(uint8_t, NumKeys, PropOffsets_Mover.NumKeys)
+	PROPERTY_VALUE(vec3, OldPos, PropOffsets_Mover.OldPos)
+	PROPERTY_VALUE(vec3, OldPrePivot, PropOffsets_Mover.OldPrePivot)
+	PROPERTY_VALUE(Rotator, OldRot, PropOffsets_Mover.OldRot)
+	PROPERTY_VALUE(USound*, OpenedSound, PropOffsets_Mover.OpenedSound)
+	PROPERTY_VALUE(USound*, OpeningSound, PropOffsets_Mover.OpeningSound)
+	PROPERTY_VALUE(float, OtherTime, PropOffsets_Mover.OtherTime)
+	PROPERTY_VALUE(NameString, PlayerBumpEvent, PropOffsets_Mover.PlayerBumpEvent)
+	PROPERTY_VALUE(uint8_t, PrevKeyNum, PropOffsets_Mover.PrevKeyNum)
+	PROPERTY_VALUE(vec3, RealPosition, PropOffsets_Mover.RealPosition)
+	PROPERTY_VALUE(Rotator, RealRotation, PropOffsets_Mover.RealRotation)
+	PROPERTY_VALUE(UTrigger*, RecommendedTrigger, PropOffsets_Mover.RecommendedTrigger)
+	PROPERTY_VALUE(NameString, ReturnGroup, PropOffsets_Mover.ReturnGroup)
+	PROPERTY_VALUE(vec3, SavedPos, PropOffsets_Mover.SavedPos)
+	PROPERTY_VALUE(Rotator, SavedRot, PropOffsets_Mover.SavedRot)
+	PROPERTY_VALUE(UActor*, SavedTrigger, PropOffsets_Mover.SavedTrigger)
+	PROPERTY_VALUE(vec3, SimInterpolate, PropOffsets_Mover.SimInterpolate)
+	PROPERTY_VALUE(vec3, SimOldPos, PropOffsets_Mover.SimOldPos)
+	PROPERTY_VALUE(int, SimOldRotPitch, PropOffsets_Mover.SimOldRotPitch)
+	PROPERTY_VALUE(int, SimOldRotRoll, PropOffsets_Mover.SimOldRotRoll)
+	PROPERTY_VALUE(int, SimOldRotYaw, PropOffsets_Mover.SimOldRotYaw)
+	PROPERTY_VALUE(float, StayOpenTime, PropOffsets_Mover.StayOpenTime)
+	PROPERTY_VALUE(UActor*, TriggerActor, PropOffsets_Mover.TriggerActor)
+	PROPERTY_VALUE(UActor*, TriggerActor2, PropOffsets_Mover.TriggerActor2)
+	PROPERTY_VALUE(UPawn*, WaitingPawn, PropOffsets_Mover.WaitingPawn)
+	PROPERTY_VALUE(uint8_t, WorldRaytraceKey, PropOffsets_Mover.WorldRaytraceKey)
+	PROPERTY_BOOL(bClientPause, PropOffsets_Mover.bClientPause)
+	PROPERTY_BOOL(bDamageTriggered, PropOffsets_Mover.bDamageTriggered)
+	PROPERTY_BOOL(bDelaying, PropOffsets_Mover.bDelaying)
+	PROPERTY_BOOL(bDynamicLightMover, PropOffsets_Mover.bDynamicLightMover)
+	PROPERTY_BOOL(bOpening, PropOffsets_Mover.bOpening)
+	PROPERTY_BOOL(bPlayerOnly, PropOffsets_Mover.bPlayerOnly)
+	PROPERTY_BOOL(bSlave, PropOffsets_Mover.bSlave)
+	PROPERTY_BOOL(bTriggerOnceOnly, PropOffsets_Mover.bTriggerOnceOnly)
+	PROPERTY_BOOL(bUseTriggered, PropOffsets_Mover.bUseTriggered)
+	PROPERTY_VALUE(UNavigationPoint*, myMarker, PropOffsets_Mover.myMarker)
+	PROPERTY_VALUE(int, numTriggerEvents, PropOffsets_Mover.numTriggerEvents)
 };
 
 class UPawn : public UActor
@@ -1419,146 +1418,146 @@ public:
 	UActor* PickTarget(float& bestAim, float& bestDist, const vec3& FireDir, const vec3& projStart);
 	bool CheckIfBestTarget(UActor* actor, float& bestAim, float& bestDist, const vec3& FireDir, const vec3& projStart);
 
-	float& AccelRate() { return Value<float>(PropOffsets_Pawn.AccelRate); }
-	float& AirControl() { return Value<float>(PropOffsets_Pawn.AirControl); }
-	float& AirSpeed() { return Value<float>(PropOffsets_Pawn.AirSpeed); }
-	NameString& AlarmTag() { return Value<NameString>(PropOffsets_Pawn.AlarmTag); }
-	float& Alertness() { return Value<float>(PropOffsets_Pawn.Alertness); }
-	uint8_t& AttitudeToPlayer() { return Value<uint8_t>(PropOffsets_Pawn.AttitudeToPlayer); }
-	float& AvgPhysicsTime() { return Value<float>(PropOffsets_Pawn.AvgPhysicsTime); }
-	float& BaseEyeHeight() { return Value<float>(PropOffsets_Pawn.BaseEyeHeight); }
-	float& CombatStyle() { return Value<float>(PropOffsets_Pawn.CombatStyle); }
-	float& DamageScaling() { return Value<float>(PropOffsets_Pawn.DamageScaling); }
-	float& DesiredSpeed() { return Value<float>(PropOffsets_Pawn.DesiredSpeed); }
-	vec3& Destination() { return Value<vec3>(PropOffsets_Pawn.Destination); }
-	USound*& Die() { return Value<USound*>(PropOffsets_Pawn.Die); }
-	int& DieCount() { return Value<int>(PropOffsets_Pawn.DieCount); }
-	UClass*& DropWhenKilled() { return Value<UClass*>(PropOffsets_Pawn.DropWhenKilled); }
-	UPawn*& Enemy() { return Value<UPawn*>(PropOffsets_Pawn.Enemy); }
-	float& EyeHeight() { return Value<float>(PropOffsets_Pawn.EyeHeight); }
-	UActor*& FaceTarget() { return Value<UActor*>(PropOffsets_Pawn.FaceTarget); }
-	vec3& Floor() { return Value<vec3>(PropOffsets_Pawn.Floor); }
-	vec3& Focus() { return Value<vec3>(PropOffsets_Pawn.Focus); }
-	PointRegion& FootRegion() { return Value<PointRegion>(PropOffsets_Pawn.FootRegion); }
-	float& FovAngle() { return Value<float>(PropOffsets_Pawn.FovAngle); }
-	float& GroundSpeed() { return Value<float>(PropOffsets_Pawn.GroundSpeed); }
-	PointRegion& HeadRegion() { return Value<PointRegion>(PropOffsets_Pawn.HeadRegion); }
-	int& Health() { return Value<int>(PropOffsets_Pawn.Health); }
-	float& HearingThreshold() { return Value<float>(PropOffsets_Pawn.HearingThreshold); }
-	USound*& HitSound1() { return Value<USound*>(PropOffsets_Pawn.HitSound1); }
-	USound*& HitSound2() { return Value<USound*>(PropOffsets_Pawn.HitSound2); }
-	uint8_t& Intelligence() { return Value<uint8_t>(PropOffsets_Pawn.Intelligence); }
-	int& ItemCount() { return Value<int>(PropOffsets_Pawn.ItemCount); }
-	float& JumpZ() { return Value<float>(PropOffsets_Pawn.JumpZ); }
-	int& KillCount() { return Value<int>(PropOffsets_Pawn.KillCount); }
-	USound*& Land() { return Value<USound*>(PropOffsets_Pawn.Land); }
-	float& LastPainSound() { return Value<float>(PropOffsets_Pawn.LastPainSound); }
-	vec3& LastSeeingPos() { return Value<vec3>(PropOffsets_Pawn.LastSeeingPos); }
-	vec3& LastSeenPos() { return Value<vec3>(PropOffsets_Pawn.LastSeenPos); }
-	float& LastSeenTime() { return Value<float>(PropOffsets_Pawn.LastSeenTime); }
-	float& MaxDesiredSpeed() { return Value<float>(PropOffsets_Pawn.MaxDesiredSpeed); }
-	float& MaxStepHeight() { return Value<float>(PropOffsets_Pawn.MaxStepHeight); }
-	float& MeleeRange() { return Value<float>(PropOffsets_Pawn.MeleeRange); }
-	std::string& MenuName() { return Value<std::string>(PropOffsets_Pawn.MenuName); }
-	float& MinHitWall() { return Value<float>(PropOffsets_Pawn.MinHitWall); }
-	UActor*& MoveTarget() { return Value<UActor*>(PropOffsets_Pawn.MoveTarget); }
-	float& MoveTimer() { return Value<float>(PropOffsets_Pawn.MoveTimer); }
-	std::string& NameArticle() { return Value<std::string>(PropOffsets_Pawn.NameArticle); }
-	NameString& NextLabel() { return Value<NameString>(PropOffsets_Pawn.NextLabel); }
-	NameString& NextState() { return Value<NameString>(PropOffsets_Pawn.NextState); }
-	float& OldMessageTime() { return Value<float>(PropOffsets_Pawn.OldMessageTime); }
-	float& OrthoZoom() { return Value<float>(PropOffsets_Pawn.OrthoZoom); }
-	float& PainTime() { return Value<float>(PropOffsets_Pawn.PainTime); }
-	UWeapon*& PendingWeapon() { return Value<UWeapon*>(PropOffsets_Pawn.PendingWeapon); }
-	float& PeripheralVision() { return Value<float>(PropOffsets_Pawn.PeripheralVision); }
-	NameString& PlayerReStartState() { return Value<NameString>(PropOffsets_Pawn.PlayerReStartState); }
-	UPlayerReplicationInfo*& PlayerReplicationInfo() { return Value<UPlayerReplicationInfo*>(PropOffsets_Pawn.PlayerReplicationInfo); }
-	UClass*& PlayerReplicationInfoClass() { return Value<UClass*>(PropOffsets_Pawn.PlayerReplicationInfoClass); }
-	float& ReducedDamagePct() { return Value<float>(PropOffsets_Pawn.ReducedDamagePct); }
-	NameString& ReducedDamageType() { return Value<NameString>(PropOffsets_Pawn.ReducedDamageType); }
-	UNavigationPoint*& RouteCache() { return Value<UNavigationPoint*>(PropOffsets_Pawn.RouteCache); }
-	int& SecretCount() { return Value<int>(PropOffsets_Pawn.SecretCount); }
-	UInventory*& SelectedItem() { return Value<UInventory*>(PropOffsets_Pawn.SelectedItem); }
-	std::string& SelectionMesh() { return Value<std::string>(PropOffsets_Pawn.SelectionMesh); }
-	UDecal*& Shadow() { return Value<UDecal*>(PropOffsets_Pawn.Shadow); }
-	NameString& SharedAlarmTag() { return Value<NameString>(PropOffsets_Pawn.SharedAlarmTag); }
-	float& SightCounter() { return Value<float>(PropOffsets_Pawn.SightCounter); }
-	float& SightRadius() { return Value<float>(PropOffsets_Pawn.SightRadius); }
-	float& Skill() { return Value<float>(PropOffsets_Pawn.Skill); }
-	float& SoundDampening() { return Value<float>(PropOffsets_Pawn.SoundDampening); }
-	UActor*& SpecialGoal() { return Value<UActor*>(PropOffsets_Pawn.SpecialGoal); }
-	std::string& SpecialMesh() { return Value<std::string>(PropOffsets_Pawn.SpecialMesh); }
-	float& SpecialPause() { return Value<float>(PropOffsets_Pawn.SpecialPause); }
-	float& SpeechTime() { return Value<float>(PropOffsets_Pawn.SpeechTime); }
-	float& SplashTime() { return Value<float>(PropOffsets_Pawn.SplashTime); }
-	int& Spree() { return Value<int>(PropOffsets_Pawn.Spree); }
-	float& Stimulus() { return Value<float>(PropOffsets_Pawn.Stimulus); }
-	float& UnderWaterTime() { return Value<float>(PropOffsets_Pawn.UnderWaterTime); }
-	Rotator& ViewRotation() { return Value<Rotator>(PropOffsets_Pawn.ViewRotation); }
-	uint8_t& Visibility() { return Value<uint8_t>(PropOffsets_Pawn.Visibility); }
-	uint8_t& VoicePitch() { return Value<uint8_t>(PropOffsets_Pawn.VoicePitch); }
-	std::string& VoiceType() { return Value<std::string>(PropOffsets_Pawn.VoiceType); }
-	vec3& WalkBob() { return Value<vec3>(PropOffsets_Pawn.WalkBob); }
-	float& WaterSpeed() { return Value<float>(PropOffsets_Pawn.WaterSpeed); }
-	USound*& WaterStep() { return Value<USound*>(PropOffsets_Pawn.WaterStep); }
-	UWeapon*& Weapon() { return Value<UWeapon*>(PropOffsets_Pawn.Weapon); }
-	BitfieldBool bAdvancedTactics() { return BoolValue(PropOffsets_Pawn.bAdvancedTactics); }
-	uint8_t& bAltFire() { return Value<uint8_t>(PropOffsets_Pawn.bAltFire); }
-	BitfieldBool bAutoActivate() { return BoolValue(PropOffsets_Pawn.bAutoActivate); }
-	BitfieldBool bAvoidLedges() { return BoolValue(PropOffsets_Pawn.bAvoidLedges); }
-	BitfieldBool bBehindView() { return BoolValue(PropOffsets_Pawn.bBehindView); }
-	BitfieldBool bCanDoSpecial() { return BoolValue(PropOffsets_Pawn.bCanDoSpecial); }
-	BitfieldBool bCanFly() { return BoolValue(PropOffsets_Pawn.bCanFly); }
-	BitfieldBool bCanJump() { return BoolValue(PropOffsets_Pawn.bCanJump); }
-	BitfieldBool bCanOpenDoors() { return BoolValue(PropOffsets_Pawn.bCanOpenDoors); }
-	BitfieldBool bCanStrafe() { return BoolValue(PropOffsets_Pawn.bCanStrafe); }
-	BitfieldBool bCanSwim() { return BoolValue(PropOffsets_Pawn.bCanSwim); }
-	BitfieldBool bCanWalk() { return BoolValue(PropOffsets_Pawn.bCanWalk); }
-	BitfieldBool bCountJumps() { return BoolValue(PropOffsets_Pawn.bCountJumps); }
-	BitfieldBool bDrowning() { return BoolValue(PropOffsets_Pawn.bDrowning); }
-	uint8_t& bDuck() { return Value<uint8_t>(PropOffsets_Pawn.bDuck); }
-	uint8_t& bExtra0() { return Value<uint8_t>(PropOffsets_Pawn.bExtra0); }
-	uint8_t& bExtra1() { return Value<uint8_t>(PropOffsets_Pawn.bExtra1); }
-	uint8_t& bExtra2() { return Value<uint8_t>(PropOffsets_Pawn.bExtra2); }
-	uint8_t& bExtra3() { return Value<uint8_t>(PropOffsets_Pawn.bExtra3); }
-	uint8_t& bFire() { return Value<uint8_t>(PropOffsets_Pawn.bFire); }
-	BitfieldBool bFixedStart() { return BoolValue(PropOffsets_Pawn.bFixedStart); }
-	uint8_t& bFreeLook() { return Value<uint8_t>(PropOffsets_Pawn.bFreeLook); }
-	BitfieldBool bFromWall() { return BoolValue(PropOffsets_Pawn.bFromWall); }
-	BitfieldBool bHitSlopedWall() { return BoolValue(PropOffsets_Pawn.bHitSlopedWall); }
-	BitfieldBool bHunting() { return BoolValue(PropOffsets_Pawn.bHunting); }
-	BitfieldBool bIsFemale() { return BoolValue(PropOffsets_Pawn.bIsFemale); }
-	BitfieldBool bIsHuman() { return BoolValue(PropOffsets_Pawn.bIsHuman); }
-	BitfieldBool bIsMultiSkinned() { return BoolValue(PropOffsets_Pawn.bIsMultiSkinned); }
-	BitfieldBool bIsPlayer() { return BoolValue(PropOffsets_Pawn.bIsPlayer); }
-	BitfieldBool bIsWalking() { return BoolValue(PropOffsets_Pawn.bIsWalking); }
-	BitfieldBool bJumpOffPawn() { return BoolValue(PropOffsets_Pawn.bJumpOffPawn); }
-	BitfieldBool bJustLanded() { return BoolValue(PropOffsets_Pawn.bJustLanded); }
-	BitfieldBool bLOSflag() { return BoolValue(PropOffsets_Pawn.bLOSflag); }
-	uint8_t& bLook() { return Value<uint8_t>(PropOffsets_Pawn.bLook); }
-	BitfieldBool bNeverSwitchOnPickup() { return BoolValue(PropOffsets_Pawn.bNeverSwitchOnPickup); }
-	BitfieldBool bReducedSpeed() { return BoolValue(PropOffsets_Pawn.bReducedSpeed); }
-	uint8_t& bRun() { return Value<uint8_t>(PropOffsets_Pawn.bRun); }
-	BitfieldBool bShootSpecial() { return BoolValue(PropOffsets_Pawn.bShootSpecial); }
-	uint8_t& bSnapLevel() { return Value<uint8_t>(PropOffsets_Pawn.bSnapLevel); }
-	BitfieldBool bStopAtLedges() { return BoolValue(PropOffsets_Pawn.bStopAtLedges); }
-	uint8_t& bStrafe() { return Value<uint8_t>(PropOffsets_Pawn.bStrafe); }
-	BitfieldBool bUpAndOut() { return BoolValue(PropOffsets_Pawn.bUpAndOut); }
-	BitfieldBool bUpdatingDisplay() { return BoolValue(PropOffsets_Pawn.bUpdatingDisplay); }
-	BitfieldBool bViewTarget() { return BoolValue(PropOffsets_Pawn.bViewTarget); }
-	BitfieldBool bWarping() { return BoolValue(PropOffsets_Pawn.bWarping); }
-	uint8_t& bZoom() { return Value<uint8_t>(PropOffsets_Pawn.bZoom); }
-	UDecoration*& carriedDecoration() { return Value<UDecoration*>(PropOffsets_Pawn.carriedDecoration); }
-	UNavigationPoint*& home() { return Value<UNavigationPoint*>(PropOffsets_Pawn.home); }
-	UPawn*& nextPawn() { return Value<UPawn*>(PropOffsets_Pawn.nextPawn); }
-	float& noise1loudness() { return Value<float>(PropOffsets_Pawn.noise1loudness); }
-	UPawn*& noise1other() { return Value<UPawn*>(PropOffsets_Pawn.noise1other); }
-	vec3& noise1spot() { return Value<vec3>(PropOffsets_Pawn.noise1spot); }
-	float& noise1time() { return Value<float>(PropOffsets_Pawn.noise1time); }
-	float& noise2loudness() { return Value<float>(PropOffsets_Pawn.noise2loudness); }
-	UPawn*& noise2other() { return Value<UPawn*>(PropOffsets_Pawn.noise2other); }
-	vec3& noise2spot() { return Value<vec3>(PropOffsets_Pawn.noise2spot); }
-	float& noise2time() { return Value<float>(PropOffsets_Pawn.noise2time); }
+	PROPERTY_VALUE(float, AccelRate, PropOffsets_Pawn.AccelRate)
+	PROPERTY_VALUE(float, AirControl, PropOffsets_Pawn.AirControl)
+	PROPERTY_VALUE(float, AirSpeed, PropOffsets_Pawn.AirSpeed)
+	PROPERTY_VALUE(NameString, AlarmTag, PropOffsets_Pawn.AlarmTag)
+	PROPERTY_VALUE(float, Alertness, PropOffsets_Pawn.Alertness)
+	PROPERTY_VALUE(uint8_t, AttitudeToPlayer, PropOffsets_Pawn.AttitudeToPlayer)
+	PROPERTY_VALUE(float, AvgPhysicsTime, PropOffsets_Pawn.AvgPhysicsTime)
+	PROPERTY_VALUE(float, BaseEyeHeight, PropOffsets_Pawn.BaseEyeHeight)
+	PROPERTY_VALUE(float, CombatStyle, PropOffsets_Pawn.CombatStyle)
+	PROPERTY_VALUE(float, DamageScaling, PropOffsets_Pawn.DamageScaling)
+	PROPERTY_VALUE(float, DesiredSpeed, PropOffsets_Pawn.DesiredSpeed)
+	PROPERTY_VALUE(vec3, Destination, PropOffsets_Pawn.Destination)
+	PROPERTY_VALUE(USound*, Die, PropOffsets_Pawn.Die)
+	PROPERTY_VALUE(int, DieCount, PropOffsets_Pawn.DieCount)
+	PROPERTY_VALUE(UClass*, DropWhenKilled, PropOffsets_Pawn.DropWhenKilled)
+	PROPERTY_VALUE(UPawn*, Enemy, PropOffsets_Pawn.Enemy)
+	PROPERTY_VALUE(float, EyeHeight, PropOffsets_Pawn.EyeHeight)
+	PROPERTY_VALUE(UActor*, FaceTarget, PropOffsets_Pawn.FaceTarget)
+	PROPERTY_VALUE(vec3, Floor, PropOffsets_Pawn.Floor)
+	PROPERTY_VALUE(vec3, Focus, PropOffsets_Pawn.Focus)
+	PROPERTY_VALUE(PointRegion, FootRegion, PropOffsets_Pawn.FootRegion)
+	PROPERTY_VALUE(float, FovAngle, PropOffsets_Pawn.FovAngle)
+	PROPERTY_VALUE(float, GroundSpeed, PropOffsets_Pawn.GroundSpeed)
+	PROPERTY_VALUE(PointRegion, HeadRegion, PropOffsets_Pawn.HeadRegion)
+	PROPERTY_VALUE(int, Health, PropOffsets_Pawn.Health)
+	PROPERTY_VALUE(float, HearingThreshold, PropOffsets_Pawn.HearingThreshold)
+	PROPERTY_VALUE(USound*, HitSound1, PropOffsets_Pawn.HitSound1)
+	PROPERTY_VALUE(USound*, HitSound2, PropOffsets_Pawn.HitSound2)
+	PROPERTY_VALUE(uint8_t, Intelligence, PropOffsets_Pawn.Intelligence)
+	PROPERTY_VALUE(int, ItemCount, PropOffsets_Pawn.ItemCount)
+	PROPERTY_VALUE(float, JumpZ, PropOffsets_Pawn.JumpZ)
+	PROPERTY_VALUE(int, KillCount, PropOffsets_Pawn.KillCount)
+	PROPERTY_VALUE(USound*, Land, PropOffsets_Pawn.Land)
+	PROPERTY_VALUE(float, LastPainSound, PropOffsets_Pawn.LastPainSound)
+	PROPERTY_VALUE(vec3, LastSeeingPos, PropOffsets_Pawn.LastSeeingPos)
+	PROPERTY_VALUE(vec3, LastSeenPos, PropOffsets_Pawn.LastSeenPos)
+	PROPERTY_VALUE(float, LastSeenTime, PropOffsets_Pawn.LastSeenTime)
+	PROPERTY_VALUE(float, MaxDesiredSpeed, PropOffsets_Pawn.MaxDesiredSpeed)
+	PROPERTY_VALUE(float, MaxStepHeight, PropOffsets_Pawn.MaxStepHeight)
+	PROPERTY_VALUE(float, MeleeRange, PropOffsets_Pawn.MeleeRange)
+	PROPERTY_VALUE(std::string, MenuName, PropOffsets_Pawn.MenuName)
+	PROPERTY_VALUE(float, MinHitWall, PropOffsets_Pawn.MinHitWall)
+	PROPERTY_VALUE(UActor*, MoveTarget, PropOffsets_Pawn.MoveTarget)
+	PROPERTY_VALUE(float, MoveTimer, PropOffsets_Pawn.MoveTimer)
+	PROPERTY_VALUE(std::string, NameArticle, PropOffsets_Pawn.NameArticle)
+	PROPERTY_VALUE(NameString, NextLabel, PropOffsets_Pawn.NextLabel)
+	PROPERTY_VALUE(NameString, NextState, PropOffsets_Pawn.NextState)
+	PROPERTY_VALUE(float, OldMessageTime, PropOffsets_Pawn.OldMessageTime)
+	PROPERTY_VALUE(float, OrthoZoom, PropOffsets_Pawn.OrthoZoom)
+	PROPERTY_VALUE(float, PainTime, PropOffsets_Pawn.PainTime)
+	PROPERTY_VALUE(UWeapon*, PendingWeapon, PropOffsets_Pawn.PendingWeapon)
+	PROPERTY_VALUE(float, PeripheralVision, PropOffsets_Pawn.PeripheralVision)
+	PROPERTY_VALUE(NameString, PlayerReStartState, PropOffsets_Pawn.PlayerReStartState)
+	PROPERTY_VALUE(UPlayerReplicationInfo*, PlayerReplicationInfo, PropOffsets_Pawn.PlayerReplicationInfo)
+	PROPERTY_VALUE(UClass*, PlayerReplicationInfoClass, PropOffsets_Pawn.PlayerReplicationInfoClass)
+	PROPERTY_VALUE(float, ReducedDamagePct, PropOffsets_Pawn.ReducedDamagePct)
+	PROPERTY_VALUE(NameString, ReducedDamageType, PropOffsets_Pawn.ReducedDamageType)
+	PROPERTY_VALUE(UNavigationPoint*, RouteCache, PropOffsets_Pawn.RouteCache)
+	PROPERTY_VALUE(int, SecretCount, PropOffsets_Pawn.SecretCount)
+	PROPERTY_VALUE(UInventory*, SelectedItem, PropOffsets_Pawn.SelectedItem)
+	PROPERTY_VALUE(std::string, SelectionMesh, PropOffsets_Pawn.SelectionMesh)
+	PROPERTY_VALUE(UDecal*, Shadow, PropOffsets_Pawn.Shadow)
+	PROPERTY_VALUE(NameString, SharedAlarmTag, PropOffsets_Pawn.SharedAlarmTag)
+	PROPERTY_VALUE(float, SightCounter, PropOffsets_Pawn.SightCounter)
+	PROPERTY_VALUE(float, SightRadius, PropOffsets_Pawn.SightRadius)
+	PROPERTY_VALUE(float, Skill, PropOffsets_Pawn.Skill)
+	PROPERTY_VALUE(float, SoundDampening, PropOffsets_Pawn.SoundDampening)
+	PROPERTY_VALUE(UActor*, SpecialGoal, PropOffsets_Pawn.SpecialGoal)
+	PROPERTY_VALUE(std::string, SpecialMesh, PropOffsets_Pawn.SpecialMesh)
+	PROPERTY_VALUE(float, SpecialPause, PropOffsets_Pawn.SpecialPause)
+	PROPERTY_VALUE(float, SpeechTime, PropOffsets_Pawn.SpeechTime)
+	PROPERTY_VALUE(float, SplashTime, PropOffsets_Pawn.SplashTime)
+	PROPERTY_VALUE(int, Spree, PropOffsets_Pawn.Spree)
+	PROPERTY_VALUE(float, Stimulus, PropOffsets_Pawn.Stimulus)
+	PROPERTY_VALUE(float, UnderWaterTime, PropOffsets_Pawn.UnderWaterTime)
+	PROPERTY_VALUE(Rotator, ViewRotation, PropOffsets_Pawn.ViewRotation)
+	PROPERTY_VALUE(uint8_t, Visibility, PropOffsets_Pawn.Visibility)
+	PROPERTY_VALUE(uint8_t, VoicePitch, PropOffsets_Pawn.VoicePitch)
+	PROPERTY_VALUE(std::string, VoiceType, PropOffsets_Pawn.VoiceType)
+	PROPERTY_VALUE(vec3, WalkBob, PropOffsets_Pawn.WalkBob)
+	PROPERTY_VALUE(float, WaterSpeed, PropOffsets_Pawn.WaterSpeed)
+	PROPERTY_VALUE(USound*, WaterStep, PropOffsets_Pawn.WaterStep)
+	PROPERTY_VALUE(UWeapon*, Weapon, PropOffsets_Pawn.Weapon)
+	PROPERTY_BOOL(bAdvancedTactics, PropOffsets_Pawn.bAdvancedTactics)
+	PROPERTY_VALUE(uint8_t, bAltFire, PropOffsets_Pawn.bAltFire)
+	PROPERTY_BOOL(bAutoActivate, PropOffsets_Pawn.bAutoActivate)
+	PROPERTY_BOOL(bAvoidLedges, PropOffsets_Pawn.bAvoidLedges)
+	PROPERTY_BOOL(bBehindView, PropOffsets_Pawn.bBehindView)
+	PROPERTY_BOOL(bCanDoSpecial, PropOffsets_Pawn.bCanDoSpecial)
+	PROPERTY_BOOL(bCanFly, PropOffsets_Pawn.bCanFly)
+	PROPERTY_BOOL(bCanJump, PropOffsets_Pawn.bCanJump)
+	PROPERTY_BOOL(bCanOpenDoors, PropOffsets_Pawn.bCanOpenDoors)
+	PROPERTY_BOOL(bCanStrafe, PropOffsets_Pawn.bCanStrafe)
+	PROPERTY_BOOL(bCanSwim, PropOffsets_Pawn.bCanSwim)
+	PROPERTY_BOOL(bCanWalk, PropOffsets_Pawn.bCanWalk)
+	PROPERTY_BOOL(bCountJumps, PropOffsets_Pawn.bCountJumps)
+	PROPERTY_BOOL(bDrowning, PropOffsets_Pawn.bDrowning)
+	PROPERTY_VALUE(uint8_t, bDuck, PropOffsets_Pawn.bDuck)
+	PROPERTY_VALUE(uint8_t, bExtra0, PropOffsets_Pawn.bExtra0)
+	PROPERTY_VALUE(uint8_t, bExtra1, PropOffsets_Pawn.bExtra1)
+	PROPERTY_VALUE(uint8_t, bExtra2, PropOffsets_Pawn.bExtra2)
+	PROPERTY_VALUE(uint8_t, bExtra3, PropOffsets_Pawn.bExtra3)
+	PROPERTY_VALUE(uint8_t, bFire, PropOffsets_Pawn.bFire)
+	PROPERTY_BOOL(bFixedStart, PropOffsets_Pawn.bFixedStart)
+	PROPERTY_VALUE(uint8_t, bFreeLook, PropOffsets_Pawn.bFreeLook)
+	PROPERTY_BOOL(bFromWall, PropOffsets_Pawn.bFromWall)
+	PROPERTY_BOOL(bHitSlopedWall, PropOffsets_Pawn.bHitSlopedWall)
+	PROPERTY_BOOL(bHunting, PropOffsets_Pawn.bHunting)
+	PROPERTY_BOOL(bIsFemale, PropOffsets_Pawn.bIsFemale)
+	PROPERTY_BOOL(bIsHuman, PropOffsets_Pawn.bIsHuman)
+	PROPERTY_BOOL(bIsMultiSkinned, PropOffsets_Pawn.bIsMultiSkinned)
+	PROPERTY_BOOL(bIsPlayer, PropOffsets_Pawn.bIsPlayer)
+	PROPERTY_BOOL(bIsWalking, PropOffsets_Pawn.bIsWalking)
+	PROPERTY_BOOL(bJumpOffPawn, PropOffsets_Pawn.bJumpOffPawn)
+	PROPERTY_BOOL(bJustLanded, PropOffsets_Pawn.bJustLanded)
+	PROPERTY_BOOL(bLOSflag, PropOffsets_Pawn.bLOSflag)
+	PROPERTY_VALUE(uint8_t, bLook, PropOffsets_Pawn.bLook)
+	PROPERTY_BOOL(bNeverSwitchOnPickup, PropOffsets_Pawn.bNeverSwitchOnPickup)
+	PROPERTY_BOOL(bReducedSpeed, PropOffsets_Pawn.bReducedSpeed)
+	PROPERTY_VALUE(uint8_t, bRun, PropOffsets_Pawn.bRun)
+	PROPERTY_BOOL(bShootSpecial, PropOffsets_Pawn.bShootSpecial)
+	PROPERTY_VALUE(uint8_t, bSnapLevel, PropOffsets_Pawn.bSnapLevel)
+	PROPERTY_BOOL(bStopAtLedges, PropOffsets_Pawn.bStopAtLedges)
+	PROPERTY_VALUE(uint8_t, bStrafe, PropOffsets_Pawn.bStrafe)
+	PROPERTY_BOOL(bUpAndOut, PropOffsets_Pawn.bUpAndOut)
+	PROPERTY_BOOL(bUpdatingDisplay, PropOffsets_Pawn.bUpdatingDisplay)
+	PROPERTY_BOOL(bViewTarget, PropOffsets_Pawn.bViewTarget)
+	PROPERTY_BOOL(bWarping, PropOffsets_Pawn.bWarping)
+	PROPERTY_VALUE(uint8_t, bZoom, PropOffsets_Pawn.bZoom)
+	PROPERTY_VALUE(UDecoration*, carriedDecoration, PropOffsets_Pawn.carriedDecoration)
+	PROPERTY_VALUE(UNavigationPoint*, home, PropOffsets_Pawn.home)
+	PROPERTY_VALUE(UPawn*, nextPawn, PropOffsets_Pawn.nextPawn)
+	PROPERTY_VALUE(float, noise1loudness, PropOffsets_Pawn.noise1loudness)
+	PROPERTY_VALUE(UPawn*, noise1other, PropOffsets_Pawn.noise1other)
+	PROPERTY_VALUE(vec3, noise1spot, PropOffsets_Pawn.noise1spot)
+	PROPERTY_VALUE(float, noise1time, PropOffsets_Pawn.noise1time)
+	PROPERTY_VALUE(float, noise2loudness, PropOffsets_Pawn.noise2loudness)
+	PROPERTY_VALUE(UPawn*, noise2other, PropOffsets_Pawn.noise2other)
+	PROPERTY_VALUE(vec3, noise2spot, PropOffsets_Pawn.noise2spot)
+	PROPERTY_VALUE(float, noise2time, PropOffsets_Pawn.noise2time)
 };
 
 class UScout : public UPawn
@@ -1575,146 +1574,146 @@ public:
 	void Tick(float elapsed) override;
 	void TickRotating(float elapsed) override;
 
-	float& AppliedBob() { return Value<float>(PropOffsets_PlayerPawn.AppliedBob); }
-	float& Bob() { return Value<float>(PropOffsets_PlayerPawn.Bob); }
-	float& BorrowedMouseX() { return Value<float>(PropOffsets_PlayerPawn.BorrowedMouseX); }
-	float& BorrowedMouseY() { return Value<float>(PropOffsets_PlayerPawn.BorrowedMouseY); }
-	UClass*& CarcassType() { return Value<UClass*>(PropOffsets_PlayerPawn.CarcassType); }
-	uint8_t& CdTrack() { return Value<uint8_t>(PropOffsets_PlayerPawn.CdTrack); }
-	float& ClientUpdateTime() { return Value<float>(PropOffsets_PlayerPawn.ClientUpdateTime); }
-	vec3& ConstantGlowFog() { return Value<vec3>(PropOffsets_PlayerPawn.ConstantGlowFog); }
-	float& ConstantGlowScale() { return Value<float>(PropOffsets_PlayerPawn.ConstantGlowScale); }
-	float& CurrentTimeStamp() { return Value<float>(PropOffsets_PlayerPawn.CurrentTimeStamp); }
-	float& DefaultFOV() { return Value<float>(PropOffsets_PlayerPawn.DefaultFOV); }
-	std::string& DelayedCommand() { return Value<std::string>(PropOffsets_PlayerPawn.DelayedCommand); }
-	int& DemoViewPitch() { return Value<int>(PropOffsets_PlayerPawn.DemoViewPitch); }
-	int& DemoViewYaw() { return Value<int>(PropOffsets_PlayerPawn.DemoViewYaw); }
-	float& DesiredFOV() { return Value<float>(PropOffsets_PlayerPawn.DesiredFOV); }
-	vec3& DesiredFlashFog() { return Value<vec3>(PropOffsets_PlayerPawn.DesiredFlashFog); }
-	float& DesiredFlashScale() { return Value<float>(PropOffsets_PlayerPawn.DesiredFlashScale); }
-	float& DodgeClickTime() { return Value<float>(PropOffsets_PlayerPawn.DodgeClickTime); }
-	float& DodgeClickTimer() { return Value<float>(PropOffsets_PlayerPawn.DodgeClickTimer); }
-	std::string& FailedView() { return Value<std::string>(PropOffsets_PlayerPawn.FailedView); }
-	vec3& FlashFog() { return Value<vec3>(PropOffsets_PlayerPawn.FlashFog); }
-	vec3& FlashScale() { return Value<vec3>(PropOffsets_PlayerPawn.FlashScale); }
-	USavedMove*& FreeMoves() { return Value<USavedMove*>(PropOffsets_PlayerPawn.FreeMoves); }
-	UGameReplicationInfo*& GameReplicationInfo() { return Value<UGameReplicationInfo*>(PropOffsets_PlayerPawn.GameReplicationInfo); }
-	UClass*& HUDType() { return Value<UClass*>(PropOffsets_PlayerPawn.HUDType); }
-	float& Handedness() { return Value<float>(PropOffsets_PlayerPawn.Handedness); }
-	float& InstantFlash() { return Value<float>(PropOffsets_PlayerPawn.InstantFlash); }
-	vec3& InstantFog() { return Value<vec3>(PropOffsets_PlayerPawn.InstantFog); }
-	USound*& JumpSound() { return Value<USound*>(PropOffsets_PlayerPawn.JumpSound); }
-	float& LandBob() { return Value<float>(PropOffsets_PlayerPawn.LandBob); }
-	float& LastMessageWindow() { return Value<float>(PropOffsets_PlayerPawn.LastMessageWindow); }
-	float& LastPlaySound() { return Value<float>(PropOffsets_PlayerPawn.LastPlaySound); }
-	float& LastUpdateTime() { return Value<float>(PropOffsets_PlayerPawn.LastUpdateTime); }
-	float& MaxTimeMargin() { return Value<float>(PropOffsets_PlayerPawn.MaxTimeMargin); }
-	int& Misc1() { return Value<int>(PropOffsets_PlayerPawn.Misc1); }
-	int& Misc2() { return Value<int>(PropOffsets_PlayerPawn.Misc2); }
-	float& MouseSensitivity() { return Value<float>(PropOffsets_PlayerPawn.MouseSensitivity); }
-	float& MouseSmoothThreshold() { return Value<float>(PropOffsets_PlayerPawn.MouseSmoothThreshold); }
-	float& MouseZeroTime() { return Value<float>(PropOffsets_PlayerPawn.MouseZeroTime); }
-	float& MyAutoAim() { return Value<float>(PropOffsets_PlayerPawn.MyAutoAim); }
-	std::string& NoPauseMessage() { return Value<std::string>(PropOffsets_PlayerPawn.NoPauseMessage); }
-	std::string& OwnCamera() { return Value<std::string>(PropOffsets_PlayerPawn.OwnCamera); }
-	std::string& Password() { return Value<std::string>(PropOffsets_PlayerPawn.Password); }
-	USavedMove*& PendingMove() { return Value<USavedMove*>(PropOffsets_PlayerPawn.PendingMove); }
-	UPlayer*& Player() { return Value<UPlayer*>(PropOffsets_PlayerPawn.Player); }
-	Color& ProgressColor() { return Value<Color>(PropOffsets_PlayerPawn.ProgressColor); }
-	std::string& ProgressMessage() { return Value<std::string>(PropOffsets_PlayerPawn.ProgressMessage); }
-	float& ProgressTimeOut() { return Value<float>(PropOffsets_PlayerPawn.ProgressTimeOut); }
-	std::string& QuickSaveString() { return Value<std::string>(PropOffsets_PlayerPawn.QuickSaveString); }
-	BitfieldBool ReceivedSecretChecksum() { return BoolValue(PropOffsets_PlayerPawn.ReceivedSecretChecksum); }
-	int& RendMap() { return Value<int>(PropOffsets_PlayerPawn.RendMap); }
-	USavedMove*& SavedMoves() { return Value<USavedMove*>(PropOffsets_PlayerPawn.SavedMoves); }
+	PROPERTY_VALUE(float, AppliedBob, PropOffsets_PlayerPawn.AppliedBob)
+	PROPERTY_VALUE(float, Bob, PropOffsets_PlayerPawn.Bob)
+	PROPERTY_VALUE(float, BorrowedMouseX, PropOffsets_PlayerPawn.BorrowedMouseX)
+	PROPERTY_VALUE(float, BorrowedMouseY, PropOffsets_PlayerPawn.BorrowedMouseY)
+	PROPERTY_VALUE(UClass*, CarcassType, PropOffsets_PlayerPawn.CarcassType)
+	PROPERTY_VALUE(uint8_t, CdTrack, PropOffsets_PlayerPawn.CdTrack)
+	PROPERTY_VALUE(float, ClientUpdateTime, PropOffsets_PlayerPawn.ClientUpdateTime)
+	PROPERTY_VALUE(vec3, ConstantGlowFog, PropOffsets_PlayerPawn.ConstantGlowFog)
+	PROPERTY_VALUE(float, ConstantGlowScale, PropOffsets_PlayerPawn.ConstantGlowScale)
+	PROPERTY_VALUE(float, CurrentTimeStamp, PropOffsets_PlayerPawn.CurrentTimeStamp)
+	PROPERTY_VALUE(float, DefaultFOV, PropOffsets_PlayerPawn.DefaultFOV)
+	PROPERTY_VALUE(std::string, DelayedCommand, PropOffsets_PlayerPawn.DelayedCommand)
+	PROPERTY_VALUE(int, DemoViewPitch, PropOffsets_PlayerPawn.DemoViewPitch)
+	PROPERTY_VALUE(int, DemoViewYaw, PropOffsets_PlayerPawn.DemoViewYaw)
+	PROPERTY_VALUE(float, DesiredFOV, PropOffsets_PlayerPawn.DesiredFOV)
+	PROPERTY_VALUE(vec3, DesiredFlashFog, PropOffsets_PlayerPawn.DesiredFlashFog)
+	PROPERTY_VALUE(float, DesiredFlashScale, PropOffsets_PlayerPawn.DesiredFlashScale)
+	PROPERTY_VALUE(float, DodgeClickTime, PropOffsets_PlayerPawn.DodgeClickTime)
+	PROPERTY_VALUE(float, DodgeClickTimer, PropOffsets_PlayerPawn.DodgeClickTimer)
+	PROPERTY_VALUE(std::string, FailedView, PropOffsets_PlayerPawn.FailedView)
+	PROPERTY_VALUE(vec3, FlashFog, PropOffsets_PlayerPawn.FlashFog)
+	PROPERTY_VALUE(vec3, FlashScale, PropOffsets_PlayerPawn.FlashScale)
+	PROPERTY_VALUE(USavedMove*, FreeMoves, PropOffsets_PlayerPawn.FreeMoves)
+	PROPERTY_VALUE(UGameReplicationInfo*, GameReplicationInfo, PropOffsets_PlayerPawn.GameReplicationInfo)
+	PROPERTY_VALUE(UClass*, HUDType, PropOffsets_PlayerPawn.HUDType)
+	PROPERTY_VALUE(float, Handedness, PropOffsets_PlayerPawn.Handedness)
+	PROPERTY_VALUE(float, InstantFlash, PropOffsets_PlayerPawn.InstantFlash)
+	PROPERTY_VALUE(vec3, InstantFog, PropOffsets_PlayerPawn.InstantFog)
+	PROPERTY_VALUE(USound*, JumpSound, PropOffsets_PlayerPawn.JumpSound)
+	PROPERTY_VALUE(float, LandBob, PropOffsets_PlayerPawn.LandBob)
+	PROPERTY_VALUE(float, LastMessageWindow, PropOffsets_PlayerPawn.LastMessageWindow)
+	PROPERTY_VALUE(float, LastPlaySound, PropOffsets_PlayerPawn.LastPlaySound)
+	PROPERTY_VALUE(float, LastUpdateTime, PropOffsets_PlayerPawn.LastUpdateTime)
+	PROPERTY_VALUE(float, MaxTimeMargin, PropOffsets_PlayerPawn.MaxTimeMargin)
+	PROPERTY_VALUE(int, Misc1, PropOffsets_PlayerPawn.Misc1)
+	PROPERTY_VALUE(int, Misc2, PropOffsets_PlayerPawn.Misc2)
+	PROPERTY_VALUE(float, MouseSensitivity, PropOffsets_PlayerPawn.MouseSensitivity)
+	PROPERTY_VALUE(float, MouseSmoothThreshold, PropOffsets_PlayerPawn.MouseSmoothThreshold)
+	PROPERTY_VALUE(float, MouseZeroTime, PropOffsets_PlayerPawn.MouseZeroTime)
+	PROPERTY_VALUE(float, MyAutoAim, PropOffsets_PlayerPawn.MyAutoAim)
+	PROPERTY_VALUE(std::string, NoPauseMessage, PropOffsets_PlayerPawn.NoPauseMessage)
+	PROPERTY_VALUE(std::string, OwnCamera, PropOffsets_PlayerPawn.OwnCamera)
+	PROPERTY_VALUE(std::string, Password, PropOffsets_PlayerPawn.Password)
+	PROPERTY_VALUE(USavedMove*, PendingMove, PropOffsets_PlayerPawn.PendingMove)
+	PROPERTY_VALUE(UPlayer*, Player, PropOffsets_PlayerPawn.Player)
+	PROPERTY_VALUE(Color, ProgressColor, PropOffsets_PlayerPawn.ProgressColor)
+	PROPERTY_VALUE(std::string, ProgressMessage, PropOffsets_PlayerPawn.ProgressMessage)
+	PROPERTY_VALUE(float, ProgressTimeOut, PropOffsets_PlayerPawn.ProgressTimeOut)
+	PROPERTY_VALUE(std::string, QuickSaveString, PropOffsets_PlayerPawn.QuickSaveString)
+	PROPERTY_BOOL(ReceivedSecretChecksum, PropOffsets_PlayerPawn.ReceivedSecretChecksum)
+	PROPERTY_VALUE(int, RendMap, PropOffsets_PlayerPawn.RendMap)
+	PROPERTY_VALUE(USavedMove*, SavedMoves, PropOffsets_PlayerPawn.SavedMoves)
 	// UScoreBoard*& Scoring() { return Value<UScoreBoard*>(PropOffsets_PlayerPawn.Scoring); }
-	UClass*& ScoringType() { return Value<UClass*>(PropOffsets_PlayerPawn.ScoringType); }
-	float& ServerTimeStamp() { return Value<float>(PropOffsets_PlayerPawn.ServerTimeStamp); }
-	int& ShowFlags() { return Value<int>(PropOffsets_PlayerPawn.ShowFlags); }
-	float& SmoothMouseX() { return Value<float>(PropOffsets_PlayerPawn.SmoothMouseX); }
-	float& SmoothMouseY() { return Value<float>(PropOffsets_PlayerPawn.SmoothMouseY); }
-	UMusic*& Song() { return Value<UMusic*>(PropOffsets_PlayerPawn.Song); }
-	uint8_t& SongSection() { return Value<uint8_t>(PropOffsets_PlayerPawn.SongSection); }
-	UClass*& SpecialMenu() { return Value<UClass*>(PropOffsets_PlayerPawn.SpecialMenu); }
-	float& TargetEyeHeight() { return Value<float>(PropOffsets_PlayerPawn.TargetEyeHeight); }
-	Rotator& TargetViewRotation() { return Value<Rotator>(PropOffsets_PlayerPawn.TargetViewRotation); }
-	vec3& TargetWeaponViewOffset() { return Value<vec3>(PropOffsets_PlayerPawn.TargetWeaponViewOffset); }
-	float& TimeMargin() { return Value<float>(PropOffsets_PlayerPawn.TimeMargin); }
-	uint8_t& Transition() { return Value<uint8_t>(PropOffsets_PlayerPawn.Transition); }
-	UActor*& ViewTarget() { return Value<UActor*>(PropOffsets_PlayerPawn.ViewTarget); }
-	std::string& ViewingFrom() { return Value<std::string>(PropOffsets_PlayerPawn.ViewingFrom); }
-	NameString& WeaponPriority() { return Value<NameString>(PropOffsets_PlayerPawn.WeaponPriority); }
-	float& ZoomLevel() { return Value<float>(PropOffsets_PlayerPawn.ZoomLevel); }
-	float& aBaseX() { return Value<float>(PropOffsets_PlayerPawn.aBaseX); }
-	float& aBaseY() { return Value<float>(PropOffsets_PlayerPawn.aBaseY); }
-	float& aBaseZ() { return Value<float>(PropOffsets_PlayerPawn.aBaseZ); }
-	float& aExtra0() { return Value<float>(PropOffsets_PlayerPawn.aExtra0); }
-	float& aExtra1() { return Value<float>(PropOffsets_PlayerPawn.aExtra1); }
-	float& aExtra2() { return Value<float>(PropOffsets_PlayerPawn.aExtra2); }
-	float& aExtra3() { return Value<float>(PropOffsets_PlayerPawn.aExtra3); }
-	float& aExtra4() { return Value<float>(PropOffsets_PlayerPawn.aExtra4); }
-	float& aForward() { return Value<float>(PropOffsets_PlayerPawn.aForward); }
-	float& aLookUp() { return Value<float>(PropOffsets_PlayerPawn.aLookUp); }
-	float& aMouseX() { return Value<float>(PropOffsets_PlayerPawn.aMouseX); }
-	float& aMouseY() { return Value<float>(PropOffsets_PlayerPawn.aMouseY); }
-	float& aStrafe() { return Value<float>(PropOffsets_PlayerPawn.aStrafe); }
-	float& aTurn() { return Value<float>(PropOffsets_PlayerPawn.aTurn); }
-	float& aUp() { return Value<float>(PropOffsets_PlayerPawn.aUp); }
-	BitfieldBool bAdmin() { return BoolValue(PropOffsets_PlayerPawn.bAdmin); }
-	BitfieldBool bAlwaysMouseLook() { return BoolValue(PropOffsets_PlayerPawn.bAlwaysMouseLook); }
-	BitfieldBool bAnimTransition() { return BoolValue(PropOffsets_PlayerPawn.bAnimTransition); }
-	BitfieldBool bBadConnectionAlert() { return BoolValue(PropOffsets_PlayerPawn.bBadConnectionAlert); }
-	BitfieldBool bCenterView() { return BoolValue(PropOffsets_PlayerPawn.bCenterView); }
-	BitfieldBool bCheatsEnabled() { return BoolValue(PropOffsets_PlayerPawn.bCheatsEnabled); }
-	BitfieldBool bDelayedCommand() { return BoolValue(PropOffsets_PlayerPawn.bDelayedCommand); }
-	BitfieldBool bEdgeBack() { return BoolValue(PropOffsets_PlayerPawn.bEdgeBack); }
-	BitfieldBool bEdgeForward() { return BoolValue(PropOffsets_PlayerPawn.bEdgeForward); }
-	BitfieldBool bEdgeLeft() { return BoolValue(PropOffsets_PlayerPawn.bEdgeLeft); }
-	BitfieldBool bEdgeRight() { return BoolValue(PropOffsets_PlayerPawn.bEdgeRight); }
-	BitfieldBool bFixedCamera() { return BoolValue(PropOffsets_PlayerPawn.bFixedCamera); }
-	BitfieldBool bFrozen() { return BoolValue(PropOffsets_PlayerPawn.bFrozen); }
-	BitfieldBool bInvertMouse() { return BoolValue(PropOffsets_PlayerPawn.bInvertMouse); }
-	BitfieldBool bIsCrouching() { return BoolValue(PropOffsets_PlayerPawn.bIsCrouching); }
-	BitfieldBool bIsTurning() { return BoolValue(PropOffsets_PlayerPawn.bIsTurning); }
-	BitfieldBool bIsTyping() { return BoolValue(PropOffsets_PlayerPawn.bIsTyping); }
-	BitfieldBool bJumpStatus() { return BoolValue(PropOffsets_PlayerPawn.bJumpStatus); }
-	BitfieldBool bJustAltFired() { return BoolValue(PropOffsets_PlayerPawn.bJustAltFired); }
-	BitfieldBool bJustFired() { return BoolValue(PropOffsets_PlayerPawn.bJustFired); }
-	BitfieldBool bKeyboardLook() { return BoolValue(PropOffsets_PlayerPawn.bKeyboardLook); }
-	BitfieldBool bLookUpStairs() { return BoolValue(PropOffsets_PlayerPawn.bLookUpStairs); }
-	BitfieldBool bMaxMouseSmoothing() { return BoolValue(PropOffsets_PlayerPawn.bMaxMouseSmoothing); }
-	BitfieldBool bMessageBeep() { return BoolValue(PropOffsets_PlayerPawn.bMessageBeep); }
-	BitfieldBool bMouseZeroed() { return BoolValue(PropOffsets_PlayerPawn.bMouseZeroed); }
-	BitfieldBool bNeverAutoSwitch() { return BoolValue(PropOffsets_PlayerPawn.bNeverAutoSwitch); }
-	BitfieldBool bNoFlash() { return BoolValue(PropOffsets_PlayerPawn.bNoFlash); }
-	BitfieldBool bNoVoices() { return BoolValue(PropOffsets_PlayerPawn.bNoVoices); }
-	BitfieldBool bPressedJump() { return BoolValue(PropOffsets_PlayerPawn.bPressedJump); }
-	BitfieldBool bReadyToPlay() { return BoolValue(PropOffsets_PlayerPawn.bReadyToPlay); }
-	BitfieldBool bReducedVis() { return BoolValue(PropOffsets_PlayerPawn.bReducedVis); }
-	BitfieldBool bRising() { return BoolValue(PropOffsets_PlayerPawn.bRising); }
-	BitfieldBool bShakeDir() { return BoolValue(PropOffsets_PlayerPawn.bShakeDir); }
-	BitfieldBool bShowMenu() { return BoolValue(PropOffsets_PlayerPawn.bShowMenu); }
-	BitfieldBool bShowScores() { return BoolValue(PropOffsets_PlayerPawn.bShowScores); }
-	BitfieldBool bSinglePlayer() { return BoolValue(PropOffsets_PlayerPawn.bSinglePlayer); }
-	BitfieldBool bSnapToLevel() { return BoolValue(PropOffsets_PlayerPawn.bSnapToLevel); }
-	BitfieldBool bSpecialMenu() { return BoolValue(PropOffsets_PlayerPawn.bSpecialMenu); }
-	BitfieldBool bUpdatePosition() { return BoolValue(PropOffsets_PlayerPawn.bUpdatePosition); }
-	BitfieldBool bUpdating() { return BoolValue(PropOffsets_PlayerPawn.bUpdating); }
-	BitfieldBool bWasBack() { return BoolValue(PropOffsets_PlayerPawn.bWasBack); }
-	BitfieldBool bWasForward() { return BoolValue(PropOffsets_PlayerPawn.bWasForward); }
-	BitfieldBool bWasLeft() { return BoolValue(PropOffsets_PlayerPawn.bWasLeft); }
-	BitfieldBool bWasRight() { return BoolValue(PropOffsets_PlayerPawn.bWasRight); }
-	BitfieldBool bWokeUp() { return BoolValue(PropOffsets_PlayerPawn.bWokeUp); }
-	BitfieldBool bZooming() { return BoolValue(PropOffsets_PlayerPawn.bZooming); }
-	float& bobtime() { return Value<float>(PropOffsets_PlayerPawn.bobtime); }
-	float& maxshake() { return Value<float>(PropOffsets_PlayerPawn.maxshake); }
-	UHUD*& myHUD() { return Value<UHUD*>(PropOffsets_PlayerPawn.myHUD); }
-	BitfieldBool ngSecretSet() { return BoolValue(PropOffsets_PlayerPawn.ngSecretSet); }
-	std::string& ngWorldSecret() { return Value<std::string>(PropOffsets_PlayerPawn.ngWorldSecret); }
-	int& shakemag() { return Value<int>(PropOffsets_PlayerPawn.shakemag); }
-	float& shaketimer() { return Value<float>(PropOffsets_PlayerPawn.shaketimer); }
-	float& shakevert() { return Value<float>(PropOffsets_PlayerPawn.shakevert); }
-	float& verttimer() { return Value<float>(PropOffsets_PlayerPawn.verttimer); }
+	PROPERTY_VALUE(UClass*, ScoringType, PropOffsets_PlayerPawn.ScoringType)
+	PROPERTY_VALUE(float, ServerTimeStamp, PropOffsets_PlayerPawn.ServerTimeStamp)
+	PROPERTY_VALUE(int, ShowFlags, PropOffsets_PlayerPawn.ShowFlags)
+	PROPERTY_VALUE(float, SmoothMouseX, PropOffsets_PlayerPawn.SmoothMouseX)
+	PROPERTY_VALUE(float, SmoothMouseY, PropOffsets_PlayerPawn.SmoothMouseY)
+	PROPERTY_VALUE(UMusic*, Song, PropOffsets_PlayerPawn.Song)
+	PROPERTY_VALUE(uint8_t, SongSection, PropOffsets_PlayerPawn.SongSection)
+	PROPERTY_VALUE(UClass*, SpecialMenu, PropOffsets_PlayerPawn.SpecialMenu)
+	PROPERTY_VALUE(float, TargetEyeHeight, PropOffsets_PlayerPawn.TargetEyeHeight)
+	PROPERTY_VALUE(Rotator, TargetViewRotation, PropOffsets_PlayerPawn.TargetViewRotation)
+	PROPERTY_VALUE(vec3, TargetWeaponViewOffset, PropOffsets_PlayerPawn.TargetWeaponViewOffset)
+	PROPERTY_VALUE(float, TimeMargin, PropOffsets_PlayerPawn.TimeMargin)
+	PROPERTY_VALUE(uint8_t, Transition, PropOffsets_PlayerPawn.Transition)
+	PROPERTY_VALUE(UActor*, ViewTarget, PropOffsets_PlayerPawn.ViewTarget)
+	PROPERTY_VALUE(std::string, ViewingFrom, PropOffsets_PlayerPawn.ViewingFrom)
+	PROPERTY_VALUE(NameString, WeaponPriority, PropOffsets_PlayerPawn.WeaponPriority)
+	PROPERTY_VALUE(float, ZoomLevel, PropOffsets_PlayerPawn.ZoomLevel)
+	PROPERTY_VALUE(float, aBaseX, PropOffsets_PlayerPawn.aBaseX)
+	PROPERTY_VALUE(float, aBaseY, PropOffsets_PlayerPawn.aBaseY)
+	PROPERTY_VALUE(float, aBaseZ, PropOffsets_PlayerPawn.aBaseZ)
+	PROPERTY_VALUE(float, aExtra0, PropOffsets_PlayerPawn.aExtra0)
+	PROPERTY_VALUE(float, aExtra1, PropOffsets_PlayerPawn.aExtra1)
+	PROPERTY_VALUE(float, aExtra2, PropOffsets_PlayerPawn.aExtra2)
+	PROPERTY_VALUE(float, aExtra3, PropOffsets_PlayerPawn.aExtra3)
+	PROPERTY_VALUE(float, aExtra4, PropOffsets_PlayerPawn.aExtra4)
+	PROPERTY_VALUE(float, aForward, PropOffsets_PlayerPawn.aForward)
+	PROPERTY_VALUE(float, aLookUp, PropOffsets_PlayerPawn.aLookUp)
+	PROPERTY_VALUE(float, aMouseX, PropOffsets_PlayerPawn.aMouseX)
+	PROPERTY_VALUE(float, aMouseY, PropOffsets_PlayerPawn.aMouseY)
+	PROPERTY_VALUE(float, aStrafe, PropOffsets_PlayerPawn.aStrafe)
+	PROPERTY_VALUE(float, aTurn, PropOffsets_PlayerPawn.aTurn)
+	PROPERTY_VALUE(float, aUp, PropOffsets_PlayerPawn.aUp)
+	PROPERTY_BOOL(bAdmin, PropOffsets_PlayerPawn.bAdmin)
+	PROPERTY_BOOL(bAlwaysMouseLook, PropOffsets_PlayerPawn.bAlwaysMouseLook)
+	PROPERTY_BOOL(bAnimTransition, PropOffsets_PlayerPawn.bAnimTransition)
+	PROPERTY_BOOL(bBadConnectionAlert, PropOffsets_PlayerPawn.bBadConnectionAlert)
+	PROPERTY_BOOL(bCenterView, PropOffsets_PlayerPawn.bCenterView)
+	PROPERTY_BOOL(bCheatsEnabled, PropOffsets_PlayerPawn.bCheatsEnabled)
+	PROPERTY_BOOL(bDelayedCommand, PropOffsets_PlayerPawn.bDelayedCommand)
+	PROPERTY_BOOL(bEdgeBack, PropOffsets_PlayerPawn.bEdgeBack)
+	PROPERTY_BOOL(bEdgeForward, PropOffsets_PlayerPawn.bEdgeForward)
+	PROPERTY_BOOL(bEdgeLeft, PropOffsets_PlayerPawn.bEdgeLeft)
+	PROPERTY_BOOL(bEdgeRight, PropOffsets_PlayerPawn.bEdgeRight)
+	PROPERTY_BOOL(bFixedCamera, PropOffsets_PlayerPawn.bFixedCamera)
+	PROPERTY_BOOL(bFrozen, PropOffsets_PlayerPawn.bFrozen)
+	PROPERTY_BOOL(bInvertMouse, PropOffsets_PlayerPawn.bInvertMouse)
+	PROPERTY_BOOL(bIsCrouching, PropOffsets_PlayerPawn.bIsCrouching)
+	PROPERTY_BOOL(bIsTurning, PropOffsets_PlayerPawn.bIsTurning)
+	PROPERTY_BOOL(bIsTyping, PropOffsets_PlayerPawn.bIsTyping)
+	PROPERTY_BOOL(bJumpStatus, PropOffsets_PlayerPawn.bJumpStatus)
+	PROPERTY_BOOL(bJustAltFired, PropOffsets_PlayerPawn.bJustAltFired)
+	PROPERTY_BOOL(bJustFired, PropOffsets_PlayerPawn.bJustFired)
+	PROPERTY_BOOL(bKeyboardLook, PropOffsets_PlayerPawn.bKeyboardLook)
+	PROPERTY_BOOL(bLookUpStairs, PropOffsets_PlayerPawn.bLookUpStairs)
+	PROPERTY_BOOL(bMaxMouseSmoothing, PropOffsets_PlayerPawn.bMaxMouseSmoothing)
+	PROPERTY_BOOL(bMessageBeep, PropOffsets_PlayerPawn.bMessageBeep)
+	PROPERTY_BOOL(bMouseZeroed, PropOffsets_PlayerPawn.bMouseZeroed)
+	PROPERTY_BOOL(bNeverAutoSwitch, PropOffsets_PlayerPawn.bNeverAutoSwitch)
+	PROPERTY_BOOL(bNoFlash, PropOffsets_PlayerPawn.bNoFlash)
+	PROPERTY_BOOL(bNoVoices, PropOffsets_PlayerPawn.bNoVoices)
+	PROPERTY_BOOL(bPressedJump, PropOffsets_PlayerPawn.bPressedJump)
+	PROPERTY_BOOL(bReadyToPlay, PropOffsets_PlayerPawn.bReadyToPlay)
+	PROPERTY_BOOL(bReducedVis, PropOffsets_PlayerPawn.bReducedVis)
+	PROPERTY_BOOL(bRising, PropOffsets_PlayerPawn.bRising)
+	PROPERTY_BOOL(bShakeDir, PropOffsets_PlayerPawn.bShakeDir)
+	PROPERTY_BOOL(bShowMenu, PropOffsets_PlayerPawn.bShowMenu)
+	PROPERTY_BOOL(bShowScores, PropOffsets_PlayerPawn.bShowScores)
+	PROPERTY_BOOL(bSinglePlayer, PropOffsets_PlayerPawn.bSinglePlayer)
+	PROPERTY_BOOL(bSnapToLevel, PropOffsets_PlayerPawn.bSnapToLevel)
+	PROPERTY_BOOL(bSpecialMenu, PropOffsets_PlayerPawn.bSpecialMenu)
+	PROPERTY_BOOL(bUpdatePosition, PropOffsets_PlayerPawn.bUpdatePosition)
+	PROPERTY_BOOL(bUpdating, PropOffsets_PlayerPawn.bUpdating)
+	PROPERTY_BOOL(bWasBack, PropOffsets_PlayerPawn.bWasBack)
+	PROPERTY_BOOL(bWasForward, PropOffsets_PlayerPawn.bWasForward)
+	PROPERTY_BOOL(bWasLeft, PropOffsets_PlayerPawn.bWasLeft)
+	PROPERTY_BOOL(bWasRight, PropOffsets_PlayerPawn.bWasRight)
+	PROPERTY_BOOL(bWokeUp, PropOffsets_PlayerPawn.bWokeUp)
+	PROPERTY_BOOL(bZooming, PropOffsets_PlayerPawn.bZooming)
+	PROPERTY_VALUE(float, bobtime, PropOffsets_PlayerPawn.bobtime)
+	PROPERTY_VALUE(float, maxshake, PropOffsets_PlayerPawn.maxshake)
+	PROPERTY_VALUE(UHUD*, myHUD, PropOffsets_PlayerPawn.myHUD)
+	PROPERTY_BOOL(ngSecretSet, PropOffsets_PlayerPawn.ngSecretSet)
+	PROPERTY_VALUE(std::string, ngWorldSecret, PropOffsets_PlayerPawn.ngWorldSecret)
+	PROPERTY_VALUE(int, shakemag, PropOffsets_PlayerPawn.shakemag)
+	PROPERTY_VALUE(float, shaketimer, PropOffsets_PlayerPawn.shaketimer)
+	PROPERTY_VALUE(float, shakevert, PropOffsets_PlayerPawn.shakevert)
+	PROPERTY_VALUE(float, verttimer, PropOffsets_PlayerPawn.verttimer)
 };
 
 class UCamera : public UPlayerPawn
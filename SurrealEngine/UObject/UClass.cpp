@@ -595,7 +595,7 @@ std::map<NameString, std::string> UClass::ParseStructValue(const std::string& te
 
 			std::string value = text.substr(pos, endpos - pos);
 			desc[keyname] = value;
-			pos++;
+			pos = endpos + 1;
 
 			pos = text.find(',', pos);
 			if (pos == std::string::npos)
@@ -626,19 +626,81 @@ UProperty* UClass::GetProperty(const NameString& propName)
 	Exception::Throw("Class Property '" + Name.ToString() + "." + propName.ToString() + "' not found");
 }
 
-void UClass::SaveToConfig(PackageManager& packageManager)
+void UClass::SaveToConfig(PackageManager& packageManager, UObject* obj)
 {
 	if (!(ClsFlags & ClassFlags::Config))
 		return;
 
-	auto ini_file = packageManager.GetIniFile(ClassConfigName);
+	// Same layout as the config values are read with when the class is loaded.
+	// This only updates the ini in memory, the file is written by PackageManager::FlushIniFiles.
+	NameString sectionName = PackageName.ToString() + "." + Name.ToString();
+	NameString configName = ClassConfigName;
+	if (configName.IsNone()) configName = "system";
+	for (UProperty* prop : Properties)
+	{
+		bool isConfig = AllFlags(prop->PropFlags, PropertyFlags::Config) || (AllFlags(prop->PropFlags, PropertyFlags::GlobalConfig) && prop->Outer() == this);
+		if (!isConfig)
+			continue;
 
-	// Iterate and save Properties that are marked with Config
-	for (UProperty* prop : PropertyData.Class->Properties)
+		const uint8_t* ptr = static_cast<const uint8_t*>(std::as_const(obj->PropertyData).Ptr(prop));
+		for (int arrayIndex = 0; arrayIndex < prop->ArrayDimension; arrayIndex++)
+		{
+			NameString name = prop->Name;
+			if (prop->ArrayDimension > 1)
+				name = NameString(name.ToString() + "[" + std::to_string(arrayIndex) + "]");
+
+			// Properties the loader can't read back are left out rather than written in a form that would fail the next load
+			std::string value;
+			if (GetConfigValue(prop, ptr + arrayIndex * prop->ElementSize(), false, value))
+				packageManager.SetIniValue(configName, sectionName, name, value);
+		}
+	}
+}
+
+bool UClass::GetConfigValue(UProperty* prop, const void* ptr, bool structMember, std::string& value)
+{
+	// Writes the format the config values are parsed with in UClass::Load, which is not the one PrintValue uses
+	if (UObject::IsType<UByteProperty>(prop)) value = std::to_string(*static_cast<const uint8_t*>(ptr));
+	else if (UObject::IsType<UIntProperty>(prop)) value = std::to_string(*static_cast<const int32_t*>(ptr));
+	else if (UObject::IsType<UFloatProperty>(prop)) value = std::to_string(*static_cast<const float*>(ptr));
+	else if (UObject::IsType<UNameProperty>(prop)) value = static_cast<const NameString*>(ptr)->ToString();
+	else if (UObject::IsType<UStrProperty>(prop) || UObject::IsType<UStringProperty>(prop))
+	{
+		value = *static_cast<const std::string*>(ptr);
+		if (structMember)
+		{
+			// ParseStructValue strips the quotes again. A quote inside the value can't be represented.
+			if (value.find('"') != std::string::npos)
+				return false;
+			value = "\"" + value + "\"";
+		}
+	}
+	else if (auto boolprop = UObject::TryCast<UBoolProperty>(prop)) value = boolprop->GetBool(ptr) ? "True" : "False";
+	else if (UObject::IsType<UClassProperty>(prop))
 	{
-		if ((uint32_t)(prop->PropFlags & PropertyFlags::Config))
+		const UObject* cls = *static_cast<UObject* const*>(ptr);
+		value = cls ? cls->package->GetPackageName().ToString() + "." + cls->Name.ToString() : "None";
+	}
+	else if (auto structprop = UObject::TryCast<UStructProperty>(prop))
+	{
+		if (structMember)
+			return false;
+
+		value = "(";
+		for (UProperty* member : structprop->Struct->Properties)
 		{
-			ini_file->SetValue(this->Name, prop->Name, prop->PrintValue(PropertyData.Ptr(prop)));
+			std::string membervalue;
+			if (!GetConfigValue(member, static_cast<const uint8_t*>(ptr) + member->DataOffset.DataOffset, true, membervalue))
+				continue;
+			if (value.size() > 1)
+				value += ",";
+			value += member->Name.ToString() + "=" + membervalue;
 		}
+		value += ")";
+	}
+	else
+	{
+		return false;
 	}
+	return true;
 }
@@ -189,7 +189,13 @@ public:
 		return static_cast<T*>(static_cast<UObject*>(this));
 	}
 
-	void SaveToConfig(PackageManager& packageManager);
+	template<typename T>
+	const T* GetDefaultObject() const
+	{
+		return static_cast<const T*>(static_cast<const UObject*>(this));
+	}
+
+	void SaveToConfig(PackageManager& packageManager, UObject* obj);
 
 	uint32_t OldClassRecordSize = 0;
 	ClassFlags ClsFlags = {};
@@ -205,6 +211,7 @@ public:
 
 private:
 	std::map<NameString, std::string> ParseStructValue(const std::string& text);
+	static bool GetConfigValue(UProperty* prop, const void* ptr, bool structMember, std::string& value);
 };
 
 enum class ExprToken : uint8_t
@@ -15,30 +15,30 @@ class UCanvas : public UObject
 public:
 	using UObject::UObject;
 
-	UFont*& BigFont() { return Value<UFont*>(PropOffsets_Canvas.BigFont); }
-	float& ClipX() { return Value<float>(PropOffsets_Canvas.ClipX); }
-	float& ClipY() { return Value<float>(PropOffsets_Canvas.ClipY); }
-	float& CurX() { return Value<float>(PropOffsets_Canvas.CurX); }
-	float& CurY() { return Value<float>(PropOffsets_Canvas.CurY); }
-	float& CurYL() { return Value<float>(PropOffsets_Canvas.CurYL); }
-	Color& DrawColor() { return Value<Color>(PropOffsets_Canvas.DrawColor); }
-	UFont*& Font() { return Value<UFont*>(PropOffsets_Canvas.Font); }
-	int& FramePtr() { return Value<int>(PropOffsets_Canvas.FramePtr); }
-	UFont*& LargeFont() { return Value<UFont*>(PropOffsets_Canvas.LargeFont); }
-	UFont*& MedFont() { return Value<UFont*>(PropOffsets_Canvas.MedFont); }
-	float& OrgX() { return Value<float>(PropOffsets_Canvas.OrgX); }
-	float& OrgY() { return Value<float>(PropOffsets_Canvas.OrgY); }
-	int& RenderPtr() { return Value<int>(PropOffsets_Canvas.RenderPtr); }
-	int& SizeX() { return Value<int>(PropOffsets_Canvas.SizeX); }
-	int& SizeY() { return Value<int>(PropOffsets_Canvas.SizeY); }
-	UFont*& SmallFont() { return Value<UFont*>(PropOffsets_Canvas.SmallFont); }
-	float& SpaceX() { return Value<float>(PropOffsets_Canvas.SpaceX); }
-	float& SpaceY() { return Value<float>(PropOffsets_Canvas.SpaceY); }
-	uint8_t& Style() { return Value<uint8_t>(PropOffsets_Canvas.Style); }
-	UViewport*& Viewport() { return Value<UViewport*>(PropOffsets_Canvas.Viewport); }
-	float& Z() { return Value<float>(PropOffsets_Canvas.Z); }
-	BitfieldBool bCenter() { return BoolValue(PropOffsets_Canvas.bCenter); }
-	BitfieldBool bNoSmooth() { return BoolValue(PropOffsets_Canvas.bNoSmooth); }
+	PROPERTY_VALUE(UFont*, BigFont, PropOffsets_Canvas.BigFont)
+	PROPERTY_VALUE(float, ClipX, PropOffsets_Canvas.ClipX)
+	PROPERTY_VALUE(float, ClipY, PropOffsets_Canvas.ClipY)
+	PROPERTY_VALUE(float, CurX, PropOffsets_Canvas.CurX)
+	PROPERTY_VALUE(float, CurY, PropOffsets_Canvas.CurY)
+	PROPERTY_VALUE(float, CurYL, PropOffsets_Canvas.CurYL)
+	PROPERTY_VALUE(Color, DrawColor, PropOffsets_Canvas.DrawColor)
+	PROPERTY_VALUE(UFont*, Font, PropOffsets_Canvas.Font)
+	PROPERTY_VALUE(int, FramePtr, PropOffsets_Canvas.FramePtr)
+	PROPERTY_VALUE(UFont*, LargeFont, PropOffsets_Canvas.LargeFont)
+	PROPERTY_VALUE(UFont*, MedFont, PropOffsets_Canvas.MedFont)
+	PROPERTY_VALUE(float, OrgX, PropOffsets_Canvas.OrgX)
+	PROPERTY_VALUE(float, OrgY, PropOffsets_Canvas.OrgY)
+	PROPERTY_VALUE(int, RenderPtr, PropOffsets_Canvas.RenderPtr)
+	PROPERTY_VALUE(int, SizeX, PropOffsets_Canvas.SizeX)
+	PROPERTY_VALUE(int, SizeY, PropOffsets_Canvas.SizeY)
+	PROPERTY_VALUE(UFont*, SmallFont, PropOffsets_Canvas.SmallFont)
+	PROPERTY_VALUE(float, SpaceX, PropOffsets_Canvas.SpaceX)
+	PROPERTY_VALUE(float, SpaceY, PropOffsets_Canvas.SpaceY)
+	PROPERTY_VALUE(uint8_t, Style, PropOffsets_Canvas.Style)
+	PROPERTY_VALUE(UViewport*, Viewport, PropOffsets_Canvas.Viewport)
+	PROPERTY_VALUE(float, Z, PropOffsets_Canvas.Z)
+	PROPERTY_BOOL(bCenter, PropOffsets_Canvas.bCenter)
+	PROPERTY_BOOL(bNoSmooth, PropOffsets_Canvas.bNoSmooth)
 };
 
 class UConsole : public UObject
@@ -46,63 +46,63 @@ class UConsole : public UObject
 public:
 	using UObject::UObject;
 
-	std::string& AvgText() { return Value<std::string>(PropOffsets_Console.AvgText); }
-	UTexture*& Border() { return Value<UTexture*>(PropOffsets_Console.Border); }
-	int& BorderLines() { return Value<int>(PropOffsets_Console.BorderLines); }
-	int& BorderPixels() { return Value<int>(PropOffsets_Console.BorderPixels); }
-	int& BorderSize() { return Value<int>(PropOffsets_Console.BorderSize); }
-	UTexture*& ConBackground() { return Value<UTexture*>(PropOffsets_Console.ConBackground); }
-	std::string& ConnectingMessage() { return Value<std::string>(PropOffsets_Console.ConnectingMessage); }
-	float& ConsoleDest() { return Value<float>(PropOffsets_Console.ConsoleDest); }
-	int& ConsoleLines() { return Value<int>(PropOffsets_Console.ConsoleLines); }
-	float& ConsolePos() { return Value<float>(PropOffsets_Console.ConsolePos); }
-	float& ExtraTime() { return Value<float>(PropOffsets_Console.ExtraTime); }
-	int& FrameCount() { return Value<int>(PropOffsets_Console.FrameCount); }
-	std::string& FrameRateText() { return Value<std::string>(PropOffsets_Console.FrameRateText); }
-	float& FrameX() { return Value<float>(PropOffsets_Console.FrameX); }
-	float& FrameY() { return Value<float>(PropOffsets_Console.FrameY); }
-	std::string& FramesText() { return Value<std::string>(PropOffsets_Console.FramesText); }
-	std::string& History() { return Value<std::string>(PropOffsets_Console.History); }
-	int& HistoryBot() { return Value<int>(PropOffsets_Console.HistoryBot); }
-	int& HistoryCur() { return Value<int>(PropOffsets_Console.HistoryCur); }
-	int& HistoryTop() { return Value<int>(PropOffsets_Console.HistoryTop); }
-	float& LastFrameTime() { return Value<float>(PropOffsets_Console.LastFrameTime); }
-	float& LastSecFPS() { return Value<float>(PropOffsets_Console.LastSecFPS); }
-	std::string& LastSecText() { return Value<std::string>(PropOffsets_Console.LastSecText); }
-	int& LastSecondFrameCount() { return Value<int>(PropOffsets_Console.LastSecondFrameCount); }
-	float& LastSecondStartTime() { return Value<float>(PropOffsets_Console.LastSecondStartTime); }
-	std::string& LoadingMessage() { return Value<std::string>(PropOffsets_Console.LoadingMessage); }
-	float& MaxFPS() { return Value<float>(PropOffsets_Console.MaxFPS); }
-	std::string& MaxText() { return Value<std::string>(PropOffsets_Console.MaxText); }
-	float& MinFPS() { return Value<float>(PropOffsets_Console.MinFPS); }
-	std::string& MinText() { return Value<std::string>(PropOffsets_Console.MinText); }
-	UPlayerReplicationInfo*& MsgPlayer() { return Value<UPlayerReplicationInfo*>(PropOffsets_Console.MsgPlayer); }
-	std::string& MsgText() { return Value<std::string>(PropOffsets_Console.MsgText); }
-	float& MsgTick() { return Value<float>(PropOffsets_Console.MsgTick); }
-	float& MsgTickTime() { return Value<float>(PropOffsets_Console.MsgTickTime); }
-	float& MsgTime() { return Value<float>(PropOffsets_Console.MsgTime); }
-	NameString& MsgType() { return Value<NameString>(PropOffsets_Console.MsgType); }
-	std::string& PausedMessage() { return Value<std::string>(PropOffsets_Console.PausedMessage); }
-	std::string& PrecachingMessage() { return Value<std::string>(PropOffsets_Console.PrecachingMessage); }
-	std::string& SavingMessage() { return Value<std::string>(PropOffsets_Console.SavingMessage); }
-	int& Scrollback() { return Value<int>(PropOffsets_Console.Scrollback); }
-	std::string& SecondsText() { return Value<std::string>(PropOffsets_Console.SecondsText); }
-	float& StartTime() { return Value<float>(PropOffsets_Console.StartTime); }
-	int& TextLines() { return Value<int>(PropOffsets_Console.TextLines); }
-	UFont*& TimeDemoFont() { return Value<UFont*>(PropOffsets_Console.TimeDemoFont); }
-	int& TopLine() { return Value<int>(PropOffsets_Console.TopLine); }
-	std::string& TypedStr() { return Value<std::string>(PropOffsets_Console.TypedStr); }
-	UViewport*& Viewport() { return Value<UViewport*>(PropOffsets_Console.Viewport); }
-	BitfieldBool bNoDrawWorld() { return BoolValue(PropOffsets_Console.bNoDrawWorld); }
-	BitfieldBool bNoStuff() { return BoolValue(PropOffsets_Console.bNoStuff); }
-	BitfieldBool bRestartTimeDemo() { return BoolValue(PropOffsets_Console.bRestartTimeDemo); }
-	BitfieldBool bSaveTimeDemoToFile() { return BoolValue(PropOffsets_Console.bSaveTimeDemoToFile); }
-	BitfieldBool bStartTimeDemo() { return BoolValue(PropOffsets_Console.bStartTimeDemo); }
-	BitfieldBool bTimeDemo() { return BoolValue(PropOffsets_Console.bTimeDemo); }
-	BitfieldBool bTyping() { return BoolValue(PropOffsets_Console.bTyping); }
-	std::string& fpsText() { return Value<std::string>(PropOffsets_Console.fpsText); }
-	int& numLines() { return Value<int>(PropOffsets_Console.numLines); }
-	int& vtblOut() { return Value<int>(PropOffsets_Console.vtblOut); }
+	PROPERTY_VALUE(std::string, AvgText, PropOffsets_Console.AvgText)
+	PROPERTY_VALUE(UTexture*, Border, PropOffsets_Console.Border)
+	PROPERTY_VALUE(int, BorderLines, PropOffsets_Console.BorderLines)
+	PROPERTY_VALUE(int, BorderPixels, PropOffsets_Console.BorderPixels)
+	PROPERTY_VALUE(int, BorderSize, PropOffsets_Console.BorderSize)
+	PROPERTY_VALUE(UTexture*, ConBackground, PropOffsets_Console.ConBackground)
+	PROPERTY_VALUE(std::string, ConnectingMessage, PropOffsets_Console.ConnectingMessage)
+	PROPERTY_VALUE(float, ConsoleDest, PropOffsets_Console.ConsoleDest)
+	PROPERTY_VALUE(int, ConsoleLines, PropOffsets_Console.ConsoleLines)
+	PROPERTY_VALUE(float, ConsolePos, PropOffsets_Console.ConsolePos)
+	PROPERTY_VALUE(float, ExtraTime, PropOffsets_Console.ExtraTime)
+	PROPERTY_VALUE(int, FrameCount, PropOffsets_Console.FrameCount)
+	PROPERTY_VALUE(std::string, FrameRateText, PropOffsets_Console.FrameRateText)
+	PROPERTY_VALUE(float, FrameX, PropOffsets_Console.FrameX)
+	PROPERTY_VALUE(float, FrameY, PropOffsets_Console.FrameY)
+	PROPERTY_VALUE(std::string, FramesText, PropOffsets_Console.FramesText)
+	PROPERTY_VALUE(std::string, History, PropOffsets_Console.History)
+	PROPERTY_VALUE(int, HistoryBot, PropOffsets_Console.HistoryBot)
+	PROPERTY_VALUE(int, HistoryCur, PropOffsets_Console.HistoryCur)
+	PROPERTY_VALUE(int, HistoryTop, PropOffsets_Console.HistoryTop)
+	PROPERTY_VALUE(float, LastFrameTime, PropOffsets_Console.LastFrameTime)
+	PROPERTY_VALUE(float, LastSecFPS, PropOffsets_Console.LastSecFPS)
+	PROPERTY_VALUE(std::string, LastSecText, PropOffsets_Console.LastSecText)
+	PROPERTY_VALUE(int, LastSecondFrameCount, PropOffsets_Console.LastSecondFrameCount)
+	PROPERTY_VALUE(float, LastSecondStartTime, PropOffsets_Console.LastSecondStartTime)
+	PROPERTY_VALUE(std::string, LoadingMessage, PropOffsets_Console.LoadingMessage)
+	PROPERTY_VALUE(float, MaxFPS, PropOffsets_Console.MaxFPS)
+	PROPERTY_VALUE(std::string, MaxText, PropOffsets_Console.MaxText)
+	PROPERTY_VALUE(float, MinFPS, PropOffsets_Console.MinFPS)
+	PROPERTY_VALUE(std::string, MinText, PropOffsets_Console.MinText)
+	PROPERTY_VALUE(UPlayerReplicationInfo*, MsgPlayer, PropOffsets_Console.MsgPlayer)
+	PROPERTY_VALUE(std::string, MsgText, PropOffsets_Console.MsgText)
+	PROPERTY_VALUE(float, MsgTick, PropOffsets_Console.MsgTick)
+	PROPERTY_VALUE(float, MsgTickTime, PropOffsets_Console.MsgTickTime)
+	PROPERTY_VALUE(float, MsgTime, PropOffsets_Console.MsgTime)
+	PROPERTY_VALUE(NameString, MsgType, PropOffsets_Console.MsgType)
+	PROPERTY_VALUE(std::string, PausedMessage, PropOffsets_Console.PausedMessage)
+	PROPERTY_VALUE(std::string, PrecachingMessage, PropOffsets_Console.PrecachingMessage)
+	PROPERTY_VALUE(std::string, SavingMessage, PropOffsets_Console.SavingMessage)
+	PROPERTY_VALUE(int, Scrollback, PropOffsets_Console.Scrollback)
+	PROPERTY_VALUE(std::string, SecondsText, PropOffsets_Console.SecondsText)
+	PROPERTY_VALUE(float, StartTime, PropOffsets_Console.StartTime)
+	PROPERTY_VALUE(int, TextLines, PropOffsets_Console.TextLines)
+	PROPERTY_VALUE(UFont*, TimeDemoFont, PropOffsets_Console.TimeDemoFont)
+	PROPERTY_VALUE(int, TopLine, PropOffsets_Console.TopLine)
+	PROPERTY_VALUE(std::string, TypedStr, PropOffsets_Console.TypedStr)
+	PROPERTY_VALUE(UViewport*, Viewport, PropOffsets_Console.Viewport)
+	PROPERTY_BOOL(bNoDrawWorld, PropOffsets_Console.bNoDrawWorld)
+	PROPERTY_BOOL(bNoStuff, PropOffsets_Console.bNoStuff)
+	PROPERTY_BOOL(bRestartTimeDemo, PropOffsets_Console.bRestartTimeDemo)
+	PROPERTY_BOOL(bSaveTimeDemoToFile, PropOffsets_Console.bSaveTimeDemoToFile)
+	PROPERTY_BOOL(bStartTimeDemo, PropOffsets_Console.bStartTimeDemo)
+	PROPERTY_BOOL(bTimeDemo, PropOffsets_Console.bTimeDemo)
+	PROPERTY_BOOL(bTyping, PropOffsets_Console.bTyping)
+	PROPERTY_VALUE(std::string, fpsText, PropOffsets_Console.fpsText)
+	PROPERTY_VALUE(int, numLines, PropOffsets_Console.numLines)
+	PROPERTY_VALUE(int, vtblOut, PropOffsets_Console.vtblOut)
 };
 
 class UPlayer : public UObject
@@ -110,19 +110,19 @@ class UPlayer : public UObject
 public:
 	using UObject::UObject;
 
-	UPlayerPawn*& Actor() { return Value<UPlayerPawn*>(PropOffsets_Player.Actor); }
-	int& ConfiguredInternetSpeed() { return Value<int>(PropOffsets_Player.ConfiguredInternetSpeed); }
-	int& ConfiguredLanSpeed() { return Value<int>(PropOffsets_Player.ConfiguredLanSpeed); }
-	UConsole*& Console() { return Value<UConsole*>(PropOffsets_Player.Console); }
-	int& CurrentNetSpeed() { return Value<int>(PropOffsets_Player.CurrentNetSpeed); }
-	uint8_t& SelectedCursor() { return Value<uint8_t>(PropOffsets_Player.SelectedCursor); }
-	float& WindowsMouseX() { return Value<float>(PropOffsets_Player.WindowsMouseX); }
-	float& WindowsMouseY() { return Value<float>(PropOffsets_Player.WindowsMouseY); }
-	BitfieldBool bShowWindowsMouse() { return BoolValue(PropOffsets_Player.bShowWindowsMouse); }
-	BitfieldBool bSuspendPrecaching() { return BoolValue(PropOffsets_Player.bSuspendPrecaching); }
-	BitfieldBool bWindowsMouseAvailable() { return BoolValue(PropOffsets_Player.bWindowsMouseAvailable); }
-	int& vfExec() { return Value<int>(PropOffsets_Player.vfExec); } // native
-	int& vfOut() { return Value<int>(PropOffsets_Player.vfOut); } // native
+	PROPERTY_VALUE(UPlayerPawn*, Actor, PropOffsets_Player.Actor)
+	PROPERTY_VALUE(int, ConfiguredInternetSpeed, PropOffsets_Player.ConfiguredInternetSpeed)
+	PROPERTY_VALUE(int, ConfiguredLanSpeed, PropOffsets_Player.ConfiguredLanSpeed)
+	PROPERTY_VALUE(UConsole*, Console, PropOffsets_Player.Console)
+	PROPERTY_VALUE(int, CurrentNetSpeed, PropOffsets_Player.CurrentNetSpeed)
+	PROPERTY_VALUE(uint8_t, SelectedCursor, PropOffsets_Player.SelectedCursor)
+	PROPERTY_VALUE(float, WindowsMouseX, PropOffsets_Player.WindowsMouseX)
+	PROPERTY_VALUE(float, WindowsMouseY, PropOffsets_Player.WindowsMouseY)
+	PROPERTY_BOOL(bShowWindowsMouse, PropOffsets_Player.bShowWindowsMouse)
+	PROPERTY_BOOL(bSuspendPrecaching, PropOffsets_Player.bSuspendPrecaching)
+	PROPERTY_BOOL(bWindowsMouseAvailable, PropOffsets_Player.bWindowsMouseAvailable)
+	PROPERTY_VALUE(int, vfExec, PropOffsets_Player.vfExec) // native
+	PROPERTY_VALUE(int, vfOut, PropOffsets_Player.vfOut) // native
 };
 
 class UViewport : public UPlayer
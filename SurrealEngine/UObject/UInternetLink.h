@@ -41,13 +41,13 @@ public:
 	std::string IpAddrToString(const IpAddr& Arg);
 	bool StringToIpAddr(const std::string& Str, IpAddr& Addr);
 
-	int& DataPending() { return Value<int>(PropOffsets_InternetLink.DataPending); }
-	uint8_t& LinkMode() { return Value<uint8_t>(PropOffsets_InternetLink.LinkMode); }
-	int& Port() { return Value<int>(PropOffsets_InternetLink.Port); }
-	int& PrivateResolveInfo() { return Value<int>(PropOffsets_InternetLink.PrivateResolveInfo); } // native
-	uint8_t& ReceiveMode() { return Value<uint8_t>(PropOffsets_InternetLink.ReceiveMode); }
-	int& RemoteSocket() { return Value<int>(PropOffsets_InternetLink.RemoteSocket); }
-	int& Socket() { return Value<int>(PropOffsets_InternetLink.Socket); }
+	PROPERTY_VALUE(int, DataPending, PropOffsets_InternetLink.DataPending)
+	PROPERTY_VALUE(uint8_t, LinkMode, PropOffsets_InternetLink.LinkMode)
+	PROPERTY_VALUE(int, Port, PropOffsets_InternetLink.Port)
+	PROPERTY_VALUE(int, PrivateResolveInfo, PropOffsets_InternetLink.PrivateResolveInfo) // native
+	PROPERTY_VALUE(uint8_t, ReceiveMode, PropOffsets_InternetLink.ReceiveMode)
+	PROPERTY_VALUE(int, RemoteSocket, PropOffsets_InternetLink.RemoteSocket)
+	PROPERTY_VALUE(int, Socket, PropOffsets_InternetLink.Socket)
 
 	std::thread Thread;
 	std::mutex Mutex;
@@ -79,10 +79,10 @@ public:
 	int ReadText(std::string& Str);
 	int SendText(const std::string& Str);
 
-	UClass*& AcceptClass() { return Value<UClass*>(PropOffsets_TcpLink.AcceptClass); }
-	uint8_t& LinkState() { return Value<uint8_t>(PropOffsets_TcpLink.LinkState); }
-	IpAddr& RemoteAddr() { return Value<IpAddr>(PropOffsets_TcpLink.RemoteAddr); }
-	Array<void*>& SendFIFO() { return Value<Array<void*>>(PropOffsets_TcpLink.SendFIFO); }
+	PROPERTY_VALUE(UClass*, AcceptClass, PropOffsets_TcpLink.AcceptClass)
+	PROPERTY_VALUE(uint8_t, LinkState, PropOffsets_TcpLink.LinkState)
+	PROPERTY_VALUE(IpAddr, RemoteAddr, PropOffsets_TcpLink.RemoteAddr)
+	PROPERTY_VALUE(Array<void*>, SendFIFO, PropOffsets_TcpLink.SendFIFO)
 
 	socket_t handle = invalid_socket_value;
 };
@@ -103,7 +103,7 @@ public:
 	int ReadText(IpAddr& Addr, std::string& Str);
 	bool SendText(const IpAddr& Addr, const std::string& Str);
 
-	int& BroadcastAddr() { return Value<int>(PropOffsets_UdpLink.BroadcastAddr); }
+	PROPERTY_VALUE(int, BroadcastAddr, PropOffsets_UdpLink.BroadcastAddr)
 
 	socket_t handle = invalid_socket_value;
 };
@@ -183,6 +183,39 @@ bool ULevel::TraceRayAnyHit(vec3 from, vec3 to, UActor* tracingActor, bool trace
 	return trace.TraceAnyHit(this, from, to, tracingActor, traceActors, traceWorld, visibilityOnly);
 }
 
+void ULevel::TraceRayAnyHit(const TraceLine* lines, size_t count, uint8_t* hits, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly)
+{
+	TraceRayLevel trace;
+	trace.TraceAnyHit(this, lines, count, hits, tracingActor, traceActors, traceWorld, visibilityOnly);
+}
+
+void ULevel::RemoveOccludedActors(Array<UActor*>& actors, const vec3& location, bool traceFromActors, UActor* tracingActor, bool visibilityOnly)
+{
+	// Trace in chunks and move the visible actors down in place, so the list reuses its storage
+	enum { ChunkSize = 64 };
+	TraceLine lines[ChunkSize];
+	uint8_t hits[ChunkSize];
+	size_t visibleCount = 0;
+	for (size_t start = 0; start < actors.size(); start += ChunkSize)
+	{
+		size_t count = std::min(actors.size() - start, (size_t)ChunkSize);
+		for (size_t i = 0; i < count; i++)
+		{
+			if (traceFromActors)
+				lines[i] = { actors[start + i]->Location(), location };
+			else
+				lines[i] = { location, actors[start + i]->Location() };
+		}
+		TraceRayAnyHit(lines, count, hits, tracingActor, false, true, visibilityOnly);
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!hits[i])
+				actors[visibleCount++] = actors[start + i];
+		}
+	}
+	actors.resize(visibleCount);
+}
+
 /////////////////////////////////////////////////////////////////////////////
 
 void UModel::Load(ObjectStream* stream)
@@ -371,12 +404,119 @@ void UModel::Load(ObjectStream* stream)
 
 	RootOutside = stream->ReadInt32();
 	Linked = stream->ReadInt32();
+
+	BuildCollisionHulls();
+}
+
+void UModel::BuildCollisionHulls()
+{
+	BspCollisionHulls& hulls = CollisionHulls;
+	hulls.NodeHulls.resize(Nodes.size(), -1);
+
+	std::unordered_map<int, int32_t> boundHulls;
+	for (size_t nodeIndex = 0; nodeIndex < Nodes.size(); nodeIndex++)
+	{
+		int collisionBound = Nodes[nodeIndex].CollisionBound;
+		if (collisionBound < 0)
+			continue;
+
+		auto it = boundHulls.find(collisionBound);
+		if (it != boundHulls.end())
+		{
+			hulls.NodeHulls[nodeIndex] = it->second;
+			continue;
+		}
+
+		int32_t* hullIndexList = &LeafHulls[collisionBound];
+		int hullPlanesCount = 0;
+		while (hullIndexList[hullPlanesCount] >= 0)
+			hullPlanesCount++;
+
+		vec3* bboxStart = (vec3*)(&hullIndexList[hullPlanesCount + 1]);
+
+		BspCollisionHulls::Hull hull;
+		hull.Box.min = bboxStart[0];
+		hull.Box.max = bboxStart[1];
+		hull.PlaneStart = (int32_t)hulls.PlaneX.size();
+		hull.HullPlaneCount = hullPlanesCount;
+
+		// Grab the hull planes and flip the plane direction if the plane points in the wrong direction
+		for (int i = 0; i < hullPlanesCount; i++)
+		{
+			int32_t hullIndex = hullIndexList[i];
+			bool hullFlip = !!(hullIndex & 0x4000'0000);
+			hullIndex = hullIndex & ~0x4000'0000;
+			const BspNode& hullnode = Nodes[hullIndex];
+			double flip = hullFlip ? -1.0 : 1.0;
+			hulls.PlaneX.push_back(hullnode.PlaneX * flip);
+			hulls.PlaneY.push_back(hullnode.PlaneY * flip);
+			hulls.PlaneZ.push_back(hullnode.PlaneZ * flip);
+			hulls.PlaneW.push_back(hullnode.PlaneW * flip);
+		}
+
+		// Bevel planes for the hull edges where the planes face opposite directions along an axis
+		for (int i = 0; i < hullPlanesCount; i++)
+		{
+			dvec4 plane0 = hulls.GetPlane(hull.PlaneStart + i);
+			for (int j = 0; j < i; j++)
+			{
+				dvec4 plane1 = hulls.GetPlane(hull.PlaneStart + j);
+
+				if ((plane0.x < 0.0 && plane1.x > 0.0) || (plane0.x > 0.0 && plane1.x < 0.0))
+				{
+					AddBevelPlane(plane0, plane1, dvec3(1.0, 0.0, 0.0));
+				}
+				if ((plane0.y < 0.0 && plane1.y > 0.0) || (plane0.y > 0.0 && plane1.y < 0.0))
+				{
+					AddBevelPlane(plane0, plane1, dvec3(0.0, 1.0, 0.0));
+				}
+				if ((plane0.z < 0.0 && plane1.z > 0.0) || (plane0.z > 0.0 && plane1.z < 0.0))
+				{
+					AddBevelPlane(plane0, plane1, dvec3(0.0, 0.0, 1.0));
+				}
+			}
+		}
+
+		hull.PlaneCount = (int32_t)hulls.PlaneX.size() - hull.PlaneStart;
+
+		int32_t index = (int32_t)hulls.Hulls.size();
+		hulls.Hulls.push_back(hull);
+		hulls.NodeHulls[nodeIndex] = index;
+		boundHulls[collisionBound] = index;
+	}
+}
+
+void UModel::AddBevelPlane(const dvec4& plane0, const dvec4& plane1, const dvec3& bevelDirection)
+{
+	dvec3 cross1 = cross(bevelDirection, plane0.xyz());
+	dvec3 cross2 = cross(bevelDirection, plane1.xyz());
+	if (dot(cross1, cross2) > 0.00001)
+	{
+		dvec3 linedir = cross(plane0.xyz(), plane1.xyz());
+		double length2 = dot(linedir, linedir);
+		if (length2 >= 0.000001)
+		{
+			dvec3 point = (plane0.w * cross(plane1.xyz(), linedir) + plane1.w * cross(linedir, plane0.xyz())) / length2;
+			linedir = normalize(linedir);
+
+			dvec3 normal = normalize(cross(bevelDirection, linedir));
+			if (dot(plane0.xyz(), normal) < 0.0)
+			{
+				normal = -normal;
+			}
+
+			CollisionHulls.PlaneX.push_back(normal.x);
+			CollisionHulls.PlaneY.push_back(normal.y);
+			CollisionHulls.PlaneZ.push_back(normal.z);
+			CollisionHulls.PlaneW.push_back(dot(point, normal));
+		}
+	}
 }
 
-CollisionHitList UModel::TraceRay(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly)
+bool UModel::TraceRayFirstHit(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, CollisionHit& hit)
 {
 	TraceRayModel trace;
-	return trace.Trace(this, origin, tmin, dirNormalized, tmax, visibilityOnly);
+	return trace.TraceFirstHit(this, origin, tmin, dirNormalized, tmax, visibilityOnly, hit);
 }
 
 PointRegion UModel::FindRegion(const vec3& point, UZoneInfo* levelZoneInfo)
@@ -4,6 +4,7 @@
 #include "Math/bbox.h"
 #include "Collision/CollisionHash.h"
 #include "Collision/CollisionHit.h"
+#include "UObject/ObjectSnapshot.h"
 
 class UTexture;
 class UActor;
@@ -106,6 +107,29 @@ public:
 	uint64_t VisibleZones;
 };
 
+// Collision hulls of the BSP leaves, flattened when the model is loaded.
+// Each hull has its leaf planes (flipped to face outwards) followed by the bevel planes needed for box sweeps.
+class BspCollisionHulls
+{
+public:
+	struct Hull
+	{
+		BBox Box;
+		int32_t PlaneStart = 0;
+		int32_t HullPlaneCount = 0;
+		int32_t PlaneCount = 0; // Hull planes plus bevel planes
+	};
+
+	dvec4 GetPlane(int index) const { return dvec4(PlaneX[index], PlaneY[index], PlaneZ[index], PlaneW[index]); }
+
+	Array<int32_t> NodeHulls; // Hull index for each node, -1 if the node has no collision hull
+	Array<Hull> Hulls;
+	Array<double> PlaneX;
+	Array<double> PlaneY;
+	Array<double> PlaneZ;
+	Array<double> PlaneW;
+};
+
 enum PolyFlags
 {
 	// Regular in-game flags.
@@ -170,7 +194,7 @@ public:
 	using UPrimitive::UPrimitive;
 	void Load(ObjectStream* stream) override;
 
-	CollisionHitList TraceRay(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly);
+	bool TraceRayFirstHit(const dvec3& origin, double tmin, const dvec3& dirNormalized, double tmax, bool visibilityOnly, CollisionHit& hit);
 
 	PointRegion FindRegion(const vec3& point, UZoneInfo* levelZoneInfo);
 
@@ -193,10 +217,16 @@ public:
 	Array<int32_t> LeafHulls;
 	Array<ConvexVolumeLeaf> Leaves;
 
+	BspCollisionHulls CollisionHulls;
+
 	Array<UActor*> Lights;
 
 	int32_t RootOutside;
 	int32_t Linked;
+
+private:
+	void BuildCollisionHulls();
+	void AddBevelPlane(const dvec4& plane0, const dvec4& plane1, const dvec3& bevelDirection);
 };
 
 class LevelReachSpec
@@ -240,6 +270,12 @@ struct TraceFlags
 	bool traceWorld() const { return world; }
 };
 
+struct TraceLine
+{
+	vec3 From;
+	vec3 To;
+};
+
 struct LevelDecal
 {
 	UDecal* Decal = nullptr;
@@ -260,13 +296,20 @@ public:
 
 	bool TraceRayAnyHit(vec3 from, vec3 to, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly);
 
+	// Same as TraceRayAnyHit for many lines at once, traced in packets of four. hits[i] is set to 1 if lines[i] is blocked.
+	void TraceRayAnyHit(const TraceLine* lines, size_t count, uint8_t* hits, UActor* tracingActor, bool traceActors, bool traceWorld, bool visibilityOnly);
+
+	// Removes the actors the world blocks from location, keeping the order of the rest. The lines are traced from the actors to location if traceFromActors is set.
+	void RemoveOccludedActors(Array<UActor*>& actors, const vec3& location, bool traceFromActors, UActor* tracingActor, bool visibilityOnly);
+
 	Array<LevelReachSpec> ReachSpecs;
 	UModel* Model = nullptr;
 
 	CollisionHash Hash;
 	Array<std::unique_ptr<LevelDecal>> Decals;
 
-	std::map<std::string, std::string> TravelInfo;
+	// Travelling actors for each player, by player name
+	std::map<std::string, ObjectSnapshot> TravelInfo;
 
 private:
 	void TickActor(float elapsed, UActor* actor);
@@ -279,12 +322,12 @@ class ULevelSummary : public UObject
 public:
 	using UObject::UObject;
 
-	std::string& Author() { return Value<std::string>(PropOffsets_LevelSummary.Author); }
-	std::string& IdealPlayerCount() { return Value<std::string>(PropOffsets_LevelSummary.IdealPlayerCount); }
-	std::string& LevelEnterText() { return Value<std::string>(PropOffsets_LevelSummary.LevelEnterText); }
-	int& RecommendedEnemies() { return Value<int>(PropOffsets_LevelSummary.RecommendedEnemies); }
-	int& RecommendedTeammates() { return Value<int>(PropOffsets_LevelSummary.RecommendedTeammates); }
-	std::string& Title() { return Value<std::string>(PropOffsets_LevelSummary.Title); }
+	PROPERTY_VALUE(std::string, Author, PropOffsets_LevelSummary.Author)
+	PROPERTY_VALUE(std::string, IdealPlayerCount, PropOffsets_LevelSummary.IdealPlayerCount)
+	PROPERTY_VALUE(std::string, LevelEnterText, PropOffsets_LevelSummary.LevelEnterText)
+	PROPERTY_VALUE(int, RecommendedEnemies, PropOffsets_LevelSummary.RecommendedEnemies)
+	PROPERTY_VALUE(int, RecommendedTeammates, PropOffsets_LevelSummary.RecommendedTeammates)
+	PROPERTY_VALUE(std::string, Title, PropOffsets_LevelSummary.Title)
 };
 
 struct Poly
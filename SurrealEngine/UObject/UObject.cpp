@@ -136,12 +136,12 @@ std::string UObject::GetPropertyAsString(const NameString& propName) const
 void UObject::SetPropertyFromString(const NameString& name, const std::string& value)
 {
 	UProperty* prop = GetMemberProperty(name);
-	prop->SetValueFromString(PropertyData.Ptr(prop), value);
+	prop->SetValueFromString(GetProperty(prop), value);
 }
 
 void UObject::SaveConfig()
 {
-	Class->SaveToConfig(*engine->packages.get());
+	Class->SaveToConfig(*engine->packages.get(), this);
 }
 
 uint8_t UObject::GetByte(const NameString& name) const
@@ -187,12 +187,12 @@ const NameString& UObject::GetName(const NameString& name) const
 
 UObject* UObject::GetUObject(const NameString& name)
 {
-	return *static_cast<UObject**>(GetProperty(name));
+	return *static_cast<UObject* const*>(std::as_const(*this).GetProperty(name));
 }
 
 Color UObject::GetColor(const NameString& name)
 {
-	return *static_cast<Color*>(GetProperty(name));
+	return *static_cast<const Color*>(std::as_const(*this).GetProperty(name));
 }
 
 NameString UObject::GetUClassName(UObject* obj)
@@ -324,7 +324,7 @@ std::string UObject::PrintProperties()
 	{
 		result += prop->Name.ToString();
 		result += " = ";
-		void* ptr = PropertyData.Ptr(prop);
+		const void* ptr = std::as_const(PropertyData).Ptr(prop);
 		result += prop->PrintValue(ptr);
 		result += "\n";
 	}
@@ -442,6 +442,10 @@ void* PropertyDataBlock::Ptr(size_t offset)
 {
 	if (offset >= Size)
 		Exception::Throw("Property offset out of bounds!");
+	if (SharedBlocks)
+		UnshareDependents();
+	if (Defaults)
+		CopyOnWrite(offset);
 	return static_cast<uint8_t*>(Data) + offset;
 }
 
@@ -449,9 +453,18 @@ const void* PropertyDataBlock::Ptr(size_t offset) const
 {
 	if (offset >= Size)
 		Exception::Throw("Property offset out of bounds!");
+	if (IsShared(offset))
+		return static_cast<const uint8_t*>(Defaults->Data) + offset;
 	return static_cast<const uint8_t*>(Data) + offset;
 }
 
+void* PropertyDataBlock::ReadBase(size_t offset)
+{
+	if (offset >= Size)
+		Exception::Throw("Property offset out of bounds!");
+	return IsShared(offset) ? Defaults->Data : Data;
+}
+
 void PropertyDataBlock::Reset()
 {
 	// To do: this crashes as the class might have been destroyed first
@@ -463,8 +476,17 @@ void PropertyDataBlock::Reset()
 			prop->Destruct(Ptr(prop));
 		}
 	}*/
+
+	if (Defaults)
+		Unlink();
+
+	// Blocks still sharing our values get their own copy before the values go away
+	if (SharedBlocks)
+		UnshareDependents();
+
 	delete[](int64_t*)Data;
 	Data = nullptr;
+	CopiedGroups = nullptr;
 	Class = nullptr;
 }
 
@@ -474,8 +496,40 @@ void PropertyDataBlock::Init(UClass* cls)
 
 	Class = cls;
 	Size = (cls->StructSize + 7) / 8;
+
+	if (&cls->PropertyData != this)
+	{
+		// Share the default values until the instance writes to them
+		PropertyDataBlock* defaults = &cls->PropertyData;
+		if (!defaults->Data && !cls->Properties.empty())
+			Exception::Throw("Default properties for class " + cls->Name.ToString() + " have not been initialized");
+		if (defaults->Data && defaults->PropertyGroups.empty())
+			defaults->BuildPropertyGroups();
+
+		size_t maskSize = defaults->EmptyGroupsMask.size();
+		int64_t* data = new int64_t[Size + maskSize];
+		Data = data;
+		CopiedGroups = reinterpret_cast<uint64_t*>(data + Size);
+		Size *= 8;
+
+		if (maskSize != 0)
+			memcpy(CopiedGroups, defaults->EmptyGroupsMask.data(), maskSize * sizeof(uint64_t));
+
+		GroupsLeft = defaults->UsedGroupCount;
+		if (GroupsLeft != 0)
+		{
+			Defaults = defaults;
+			NextShared = defaults->SharedBlocks;
+			if (NextShared)
+				NextShared->PrevShared = this;
+			defaults->SharedBlocks = this;
+		}
+		return;
+	}
+
 	Data = new int64_t[Size];
 	Size *= 8;
+	PropertyGroups.clear();
 	for (UProperty* prop : cls->Properties)
 	{
 #ifdef _DEBUG
@@ -483,15 +537,91 @@ void PropertyDataBlock::Init(UClass* cls)
 			Exception::Throw("Memory corruption detected!");
 #endif
 
-		if (&cls->PropertyData != this)
-			prop->CopyConstruct(Ptr(prop), cls->PropertyData.Ptr(prop));
-		else if (cls->BaseStruct && prop->DataOffset.DataOffset < cls->BaseStruct->StructSize) // inherit from base default object
-			prop->CopyConstruct(Ptr(prop), cls->BaseStruct->PropertyData.Ptr(prop));
+		if (cls->BaseStruct && prop->DataOffset.DataOffset < cls->BaseStruct->StructSize) // inherit from base default object (read only, so the base defaults are not unshared)
+			prop->CopyConstruct(Ptr(prop), std::as_const(cls->BaseStruct->PropertyData).Ptr(prop));
 		else
 			prop->Construct(Ptr(prop));
 	}
 }
 
+void PropertyDataBlock::BuildPropertyGroups()
+{
+	size_t groupCount = (Class->StructSize + PropertyGroupSize - 1) / PropertyGroupSize;
+	PropertyGroups.resize(groupCount);
+	for (UProperty* prop : Class->Properties)
+	{
+		PropertyGroups[prop->DataOffset.DataOffset / PropertyGroupSize].push_back(prop);
+	}
+
+	EmptyGroupsMask.clear();
+	EmptyGroupsMask.resize((groupCount + 63) / 64, 0);
+	UsedGroupCount = 0;
+	for (size_t group = 0; group < groupCount; group++)
+	{
+		if (PropertyGroups[group].empty())
+			EmptyGroupsMask[group >> 6] |= 1ULL << (group & 63);
+		else
+			UsedGroupCount++;
+	}
+}
+
+bool PropertyDataBlock::IsShared(size_t offset) const
+{
+	if (!Defaults)
+		return false;
+	size_t group = offset / PropertyGroupSize;
+	return (CopiedGroups[group >> 6] & (1ULL << (group & 63))) == 0;
+}
+
+void PropertyDataBlock::CopyOnWrite(size_t offset)
+{
+	if (IsShared(offset))
+		CopyGroup(offset / PropertyGroupSize);
+}
+
+void PropertyDataBlock::CopyGroup(size_t group)
+{
+	uint8_t* dest = static_cast<uint8_t*>(Data);
+	uint8_t* src = static_cast<uint8_t*>(Defaults->Data);
+	for (UProperty* prop : Defaults->PropertyGroups[group])
+	{
+		size_t offset = prop->DataOffset.DataOffset;
+		prop->CopyConstruct(dest + offset, src + offset);
+	}
+
+	CopiedGroups[group >> 6] |= 1ULL << (group & 63);
+	if (--GroupsLeft == 0)
+		Unlink();
+}
+
+void PropertyDataBlock::UnshareDependents()
+{
+	while (SharedBlocks)
+	{
+		PropertyDataBlock* block = SharedBlocks;
+		for (size_t group = 0, count = PropertyGroups.size(); block->Defaults; group++)
+		{
+			if (group == count)
+				Exception::Throw("Shared property data block has no groups left to copy");
+			if ((block->CopiedGroups[group >> 6] & (1ULL << (group & 63))) == 0)
+				block->CopyGroup(group);
+		}
+	}
+}
+
+void PropertyDataBlock::Unlink()
+{
+	if (PrevShared)
+		PrevShared->NextShared = NextShared;
+	else
+		Defaults->SharedBlocks = NextShared;
+	if (NextShared)
+		NextShared->PrevShared = PrevShared;
+	PrevShared = nullptr;
+	NextShared = nullptr;
+	Defaults = nullptr;
+}
+
 void PropertyDataBlock::ReadProperties(ObjectStream* stream)
 {
 	while (true)
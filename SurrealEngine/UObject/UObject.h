@@ -141,25 +141,75 @@ public:
 	void Init(UClass* cls);
 	void ReadProperties(ObjectStream* stream);
 
+	// Write access. Copies the property group from the defaults if it is still shared.
+	// If this is a default object block, any block still sharing its values is given its own copy first.
 	void* Ptr(const UProperty* prop);
 	void* Ptr(size_t offset);
+
+	// Read access. Uncopied groups are read from the defaults.
 	const void* Ptr(const UProperty* prop) const;
 	const void* Ptr(size_t offset) const;
 
+	// Start of the block for code that addresses properties as base pointer plus offset. Makes the property at the offset writable.
+	void* WritableBase(size_t offset) { return static_cast<uint8_t*>(Ptr(offset)) - offset; }
+
+	// Same for code that only reads the property at the offset. Nothing is copied, so the base may point at the defaults.
+	void* ReadBase(size_t offset);
+
 	template<typename T>
-	T& Value(size_t offset) { return *reinterpret_cast<T*>(static_cast<uint8_t*>(Data) + offset); }
+	T& Value(size_t offset) { return *static_cast<T*>(Ptr(offset)); }
+
+	template<typename T>
+	const T& Value(size_t offset) const { return *static_cast<const T*>(Ptr(offset)); }
 
-	void* Data = nullptr;
 	size_t Size = 0;
 	UClass* Class = nullptr;
 
 private:
 	void Reset();
+	bool IsShared(size_t offset) const;
+	void CopyOnWrite(size_t offset);
+	void CopyGroup(size_t group);
+	void UnshareDependents();
+	void BuildPropertyGroups();
+	void Unlink();
+
+	// Instances do not copy the class defaults when created. Each group of properties is copied the first
+	// time it is accessed through a non-const pointer. Const reads of an uncopied group go to the defaults.
+	enum { PropertyGroupSize = 128 };
+
+	void* Data = nullptr;
+
+	PropertyDataBlock* Defaults = nullptr;
+	uint64_t* CopiedGroups = nullptr;
+	size_t GroupsLeft = 0;
+	PropertyDataBlock* PrevShared = nullptr;
+	PropertyDataBlock* NextShared = nullptr;
+
+	// Only used by default object blocks
+	PropertyDataBlock* SharedBlocks = nullptr;
+	Array<Array<UProperty*>> PropertyGroups;
+	Array<uint64_t> EmptyGroupsMask;
+	size_t UsedGroupCount = 0;
 
 	PropertyDataBlock(const PropertyDataBlock&) = delete;
 	PropertyDataBlock& operator=(const PropertyDataBlock&) = delete;
 };
 
+// Accessors for a native property. The non-const one is for writing and copies the property group if it is still shared.
+// The const one only reads, so it never copies the class defaults.
+#define PROPERTY_VALUE(type, name, offset) \
+	type& name() { return Value<type>(offset); } \
+	type const& name() const { return Value<type>(offset); }
+
+#define PROPERTY_BOOL(name, offset) \
+	BitfieldBool name() { return BoolValue(offset); } \
+	bool name() const { return BoolValue(offset); }
+
+#define PROPERTY_FIXEDARRAY(type, name, offset) \
+	type* name() { return FixedArray<type>(offset); } \
+	type const* name() const { return FixedArray<type>(offset); }
+
 class UObject
 {
 public:
@@ -254,6 +304,15 @@ public:
 	template<typename T>
 	T* FixedArray(PropertyDataOffset offset) { return static_cast<T*>(PropertyData.Ptr(offset.DataOffset)); }
 
+	// Const versions only read and never copy the class defaults
+	template<typename T>
+	const T& Value(PropertyDataOffset offset) const { return *static_cast<const T*>(PropertyData.Ptr(offset.DataOffset)); }
+
+	bool BoolValue(PropertyDataOffset offset) const { return (*static_cast<const uint32_t*>(PropertyData.Ptr(offset.DataOffset)) & offset.BitfieldMask) != 0; }
+
+	template<typename T>
+	const T* FixedArray(PropertyDataOffset offset) const { return static_cast<const T*>(PropertyData.Ptr(offset.DataOffset)); }
+
 	template<typename T>
 	static T* Cast(UObject* obj)
 	{
@@ -291,11 +350,11 @@ public:
 	static NameString GetUClassName(UObject* obj);
 	static NameString GetUClassFullName(UObject* obj);
 
-	UClass*& uc_Class() { return Value<UClass*>(PropOffsets_Object.Class); } // native
-	NameString& uc_Name() { return Value<NameString>(PropOffsets_Object.Name); } // native
-	int& uc_ObjectFlags() { return Value<int>(PropOffsets_Object.ObjectFlags); } // native
-	int& uc_ObjectInternal() { return Value<int>(PropOffsets_Object.ObjectInternal); } // native
-	UObject*& Outer() { return Value<UObject*>(PropOffsets_Object.Outer); } // native
+	PROPERTY_VALUE(UClass*, uc_Class, PropOffsets_Object.Class) // native
+	PROPERTY_VALUE(NameString, uc_Name, PropOffsets_Object.Name) // native
+	PROPERTY_VALUE(int, uc_ObjectFlags, PropOffsets_Object.ObjectFlags) // native
+	PROPERTY_VALUE(int, uc_ObjectInternal, PropOffsets_Object.ObjectInternal) // native
+	PROPERTY_VALUE(UObject*, Outer, PropOffsets_Object.Outer) // native
 };
 
 template<typename T>
@@ -339,3 +398,16 @@ Array<T*> Package::GetAllObjects()
 	}
 	return objects;
 }
+
+template<class T>
+Array<T*> Package::GetCreatedObjects()
+{
+	Array<T*> objects;
+	for (const std::unique_ptr<UObject>& obj : Objects)
+	{
+		T* cast = obj ? UObject::TryCast<T>(obj.get()) : nullptr;
+		if (cast)
+			objects.push_back(cast);
+	}
+	return objects;
+}
@@ -117,8 +117,12 @@ public:
 
 	virtual size_t Alignment() { return 4; }
 	size_t Size() { return ElementSize() * ArrayDimension; }
+
+	// Export only reads values. Going through the const accessors avoids copying groups the object still shares with its class defaults.
+	static const uint8_t* ExportPtr(const UObject* obj, UProperty* prop) { return static_cast<const uint8_t*>(obj->GetProperty(prop)); }
+	static const uint8_t* ExportPtr(const UObject* obj, const NameString& name) { return static_cast<const uint8_t*>(obj->GetProperty(name)); }
 	virtual size_t ElementSize() { return 4; }
-	virtual void GetExportText(std::string& buf, const std::string& whitespace, UObject* obj, UObject* defobj, int i)
+	virtual void GetExportText(std::string& buf, const std::string& whitespace, const UObject* obj, const UObject* defobj, int i)
 	{
 		if (i >= ArrayDimension)
 			Exception::Throw("UProperty::GetExportText index out of bounds");
@@ -126,11 +130,11 @@ public:
 		size_t elementSize = ElementSize();
 		int offset = i * (int)elementSize;
 
-		void* objval = static_cast<uint8_t*>(obj->PropertyData.Ptr(this)) + offset;
-		void* defval = nullptr;
+		const void* objval = ExportPtr(obj, this) + offset;
+		const void* defval = nullptr;
 		try
 		{
-			defval = (defobj) ? static_cast<uint8_t*>(defobj->GetProperty(Name)) + offset : nullptr;
+			defval = (defobj) ? ExportPtr(defobj, Name) + offset : nullptr;
 		}
 		catch (...) 
 		{
@@ -144,7 +148,7 @@ public:
 
 		buf += innerbuf;
 	}
-	virtual void GetExportText(std::string& buf, const std::string& whitespace, void* objval, void* defval, int i)
+	virtual void GetExportText(std::string& buf, const std::string& whitespace, const void* objval, const void* defval, int i)
 	{
 		if (!defval && IsDefaultValue(objval))
 			return;
@@ -156,13 +160,13 @@ public:
 			buf += '(' + std::to_string(i) + ')';
 		buf += '=' + PrintValue(objval);
 	}
-	virtual bool Compare(void* v1, void* v2)
+	virtual bool Compare(const void* v1, const void* v2)
 	{
 		return memcmp(v1, v2, ElementSize()) == 0;
 	}
 	virtual void Construct(void* data) { memset(data, 0, Size()); }
-	virtual void CopyConstruct(void* data, void* src) { memcpy(data, src, Size()); }
-	virtual void CopyValue(void* data, void* src)
+	virtual void CopyConstruct(void* data, const void* src) { memcpy(data, src, Size()); }
+	virtual void CopyValue(void* data, const void* src)
 	{
 		if (data != src)
 		{
@@ -171,7 +175,7 @@ public:
 		}
 	}
 	virtual void Destruct(void* data) { }
-	virtual bool IsDefaultValue(void* val) { return false; }
+	virtual bool IsDefaultValue(const void* val) { return false; }
 
 	virtual std::string PrintValue(const void* data) { return "?"; }
 
@@ -221,7 +225,7 @@ public:
 		
 		return std::to_string(*(uint8_t*)data); 
 	}
-	bool IsDefaultValue(void* val) override
+	bool IsDefaultValue(const void* val) override
 	{
 		return *(uint8_t*)val == 0;
 	}
@@ -243,7 +247,7 @@ public:
 	void LoadStructMemberValue(void* data, ObjectStream* stream) override;
 	size_t Alignment() override { return sizeof(void*); }
 	size_t ElementSize() override { return sizeof(void*); }
-	bool Compare(void* v1, void* v2) override
+	bool Compare(const void* v1, const void* v2) override
 	{
 		UObject* o1 = *(UObject**)v1;
 		UObject* o2 = *(UObject**)v2;
@@ -257,7 +261,7 @@ public:
 		else
 			return "None";
 	}
-	bool IsDefaultValue(void* val) override
+	bool IsDefaultValue(const void* val) override
 	{
 		return *(UObject**)val == nullptr;
 	}
@@ -288,10 +292,10 @@ public:
 		}
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		uint8_t* p = static_cast<uint8_t*>(data);
-		uint8_t* sp = static_cast<uint8_t*>(src);
+		const uint8_t* sp = static_cast<const uint8_t*>(src);
 		size_t s = Inner->Size();
 		int totalcount = Count * ArrayDimension;
 		for (int i = 0; i < totalcount; i++)
@@ -329,7 +333,7 @@ public:
 	size_t Alignment() override { return sizeof(void*); }
 	size_t ElementSize() override { return sizeof(Array<void*>); }
 
-	void GetExportText(std::string& buf, const std::string& whitespace, UObject* obj, UObject* defobj, int i)
+	void GetExportText(std::string& buf, const std::string& whitespace, const UObject* obj, const UObject* defobj, int i)
 	{
 		if (i >= ArrayDimension)
 			Exception::Throw("UArrayProperty::GetExportText index out of bounds");
@@ -337,13 +341,13 @@ public:
 		size_t elementSize = ElementSize();
 		int offset = i * (int)elementSize;
 
-		Array<void*>* objarray = static_cast<Array<void*>*>(obj->GetProperty(Name)) + offset;
-		Array<void*>* defarray = (defobj) ? static_cast<Array<void*>*>(defobj->GetProperty(Name)) + offset : nullptr;
+		const Array<void*>* objarray = reinterpret_cast<const Array<void*>*>(ExportPtr(obj, Name)) + offset;
+		const Array<void*>* defarray = (defobj) ? reinterpret_cast<const Array<void*>*>(ExportPtr(defobj, Name)) + offset : nullptr;
 
 		for (int k = 0; k < objarray->size(); k++)
 		{
-			void* objval = objarray->at(k);
-			void* defval = (defarray && k < defarray->size()) ? defarray->at(k) : nullptr;
+			const void* objval = objarray->at(k);
+			const void* defval = (defarray && k < defarray->size()) ? defarray->at(k) : nullptr;
 
 			Inner->GetExportText(buf, whitespace, objval, defval, i);
 		}
@@ -356,10 +360,10 @@ public:
 			new(vec + i) Array<void*>();
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		auto vec = static_cast<Array<void*>*>(data);
-		auto srcvec = static_cast<Array<void*>*>(src);
+		auto srcvec = static_cast<const Array<void*>*>(src);
 
 		for (int i = 0; i < ArrayDimension; i++)
 		{
@@ -410,10 +414,10 @@ public:
 			new(map + i) std::map<void*, void*>();
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		auto map = static_cast<std::map<void*, void*>*>(data);
-		auto srcmap = static_cast<std::map<void*, void*>*>(src);
+		auto srcmap = static_cast<const std::map<void*, void*>*>(src);
 		for (int i = 0; i < ArrayDimension; i++)
 		{
 			new(map + i) std::map<void*, void*>();
@@ -483,7 +487,7 @@ public:
 	size_t Alignment() override { return sizeof(void*); }
 	size_t ElementSize() override { return Struct ? Struct->StructSize : 0; }
 
-	void GetExportText(std::string& buf, const std::string& whitespace, UObject* obj, UObject* defobj, int i) override
+	void GetExportText(std::string& buf, const std::string& whitespace, const UObject* obj, const UObject* defobj, int i) override
 	{
 		if (!Struct)
 		{
@@ -494,12 +498,12 @@ public:
 		if (i >= ArrayDimension)
 			Exception::Throw("UStructProperty::GetExportText index out of bounds");
 
-		uint8_t* objval = static_cast<uint8_t*>(obj->PropertyData.Ptr(this)) + (i * ElementSize());
-		uint8_t* defval = nullptr;
+		const uint8_t* objval = ExportPtr(obj, this) + (i * ElementSize());
+		const uint8_t* defval = nullptr;
 		try
 		{
 			if (defobj)
-				defval = static_cast<uint8_t*>(defobj->GetProperty(Name)) + (i * ElementSize());
+				defval = ExportPtr(defobj, Name) + (i * ElementSize());
 		}
 		catch (...)
 		{
@@ -519,8 +523,8 @@ public:
 
 			for (int k = 0; k < fieldprop->ArrayDimension; k++)
 			{
-				uint8_t* objsubval = objval + offset;
-				uint8_t* defsubval = (defval) ? defval + offset : nullptr;
+				const uint8_t* objsubval = objval + offset;
+				const uint8_t* defsubval = (defval) ? defval + offset : nullptr;
 				fieldprop->GetExportText(innerbuf, "", objsubval, defsubval, k);
 
 				if (innerbuf.length() > 0)
@@ -598,7 +602,7 @@ public:
 	void LoadValue(void* data, ObjectStream* stream, const PropertyHeader& header) override;
 	void LoadStructMemberValue(void* data, ObjectStream* stream) override;
 	std::string PrintValue(const void* data) override { return std::to_string(*(int32_t*)data); }
-	bool IsDefaultValue(void* val)
+	bool IsDefaultValue(const void* val)
 	{
 		return *(int*)val == 0;
 	}
@@ -616,7 +620,7 @@ public:
 	void LoadValue(void* data, ObjectStream* stream, const PropertyHeader& header) override;
 	void LoadStructMemberValue(void* data, ObjectStream* stream) override;
 
-	bool Compare(void* v1, void* v2) override
+	bool Compare(const void* v1, const void* v2) override
 	{
 		bool b1 = GetBool(v1);
 		bool b2 = GetBool(v2);
@@ -627,7 +631,7 @@ public:
 		SetBool(data, false);
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		SetBool(data, GetBool(src));
 	}
@@ -659,7 +663,7 @@ public:
 		SetBool(data, value);
 	}
 
-	bool IsDefaultValue(void* val) override
+	bool IsDefaultValue(const void* val) override
 	{
 		return GetBool(val) == false;
 	}
@@ -675,7 +679,7 @@ public:
 	void LoadStructMemberValue(void* data, ObjectStream* stream) override;
 	std::string PrintValue(const void* data) override { return std::to_string(*(float*)data); }
 
-	bool IsDefaultValue(void* val)
+	bool IsDefaultValue(const void* val)
 	{
 		return *(float*)val == 0.0f;
 	}
@@ -697,10 +701,10 @@ public:
 	size_t Alignment() override { return sizeof(void*); }
 	size_t ElementSize() override { return sizeof(NameString); }
 	
-	bool Compare(void* v1, void* v2) override
+	bool Compare(const void* v1, const void* v2) override
 	{
-		NameString* n1 = static_cast<NameString*>(v1);
-		NameString* n2 = static_cast<NameString*>(v2);
+		const NameString* n1 = static_cast<const NameString*>(v1);
+		const NameString* n2 = static_cast<const NameString*>(v2);
 		return *n1 == *n2;
 	}
 
@@ -711,10 +715,10 @@ public:
 			new(str + i) NameString();
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		auto str = static_cast<NameString*>(data);
-		auto srcstr = static_cast<NameString*>(src);
+		auto srcstr = static_cast<const NameString*>(src);
 		for (int i = 0; i < ArrayDimension; i++)
 			new(str + i) NameString(srcstr[i]);
 	}
@@ -733,9 +737,9 @@ public:
 
 	std::string PrintValue(const void* data) override { return ((NameString*)data)->ToString(); }
 
-	bool IsDefaultValue(void* val) override
+	bool IsDefaultValue(const void* val) override
 	{
-		return static_cast<NameString*>(val)->IsNone();
+		return static_cast<const NameString*>(val)->IsNone();
 	}
 };
 
@@ -757,10 +761,10 @@ public:
 			new(str + i) std::string();
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		auto str = static_cast<std::string*>(data);
-		auto srcstr = static_cast<std::string*>(src);
+		auto srcstr = static_cast<const std::string*>(src);
 		for (int i = 0; i < ArrayDimension; i++)
 			new(str + i) std::string(srcstr[i]);
 	}
@@ -779,7 +783,7 @@ public:
 
 	std::string PrintValue(const void* data) override { return '"' + *(std::string*)data + '"'; }
 
-	bool IsDefaultValue(void* val) override
+	bool IsDefaultValue(const void* val) override
 	{
 		return ((std::string*)val)->length() == 0;
 	}
@@ -802,10 +806,10 @@ public:
 			new(str + i) std::string();
 	}
 
-	void CopyConstruct(void* data, void* src) override
+	void CopyConstruct(void* data, const void* src) override
 	{
 		auto str = static_cast<std::string*>(data);
-		auto srcstr = static_cast<std::string*>(src);
+		auto srcstr = static_cast<const std::string*>(src);
 		for (int i = 0; i < ArrayDimension; i++)
 			new(str + i) std::string(srcstr[i]);
 	}
@@ -824,7 +828,7 @@ public:
 
 	std::string PrintValue(const void* data) override { return '"' + *(std::string*)data + '"'; }
 
-	bool IsDefaultValue(void* val) override
+	bool IsDefaultValue(const void* val) override
 	{
 		return ((std::string*)val)->length() == 0;
 	}
@@ -5,6 +5,7 @@
 #include "Audio/AudioSource.h"
 #include "Audio/AudioDevice.h"
 #include "Audio/AudioSubsystem.h"
+#include "Audio/SoundDecoder.h"
 
 void USound::Load(ObjectStream* stream)
 {
@@ -18,24 +19,53 @@ void USound::Load(ObjectStream* stream)
 	stream->ReadBytes(Data.data(), size);
 }
 
-void USound::GetSound()
+USound::~USound()
 {
-	if (samples.size() > 0)
-		return;
+	if (engine && engine->audio && State == SoundState::Decoding)
+		engine->audio->GetSoundDecoder()->Cancel(this);
+}
 
-	std::unique_ptr<AudioSource> source = AudioSource::CreateWav(Data);
+bool USound::RequestSound()
+{
+	if (State == SoundState::NotLoaded)
+	{
+		State = SoundState::Decoding;
+		engine->audio->GetSoundDecoder()->Queue(this);
+	}
+	return State == SoundState::Ready;
+}
 
-	#define ALIGN(x, a) ((x & ~(a-1)) + a)
-	samples.resize(ALIGN(source->GetSamples(), 4));
-	samples.resize(ALIGN(source->ReadSamples(samples.data(), samples.size()), 4));
+void USound::GetSound()
+{
+	if (State == SoundState::NotLoaded || State == SoundState::Decoding)
+	{
+		if (State == SoundState::Decoding)
+			SetDecodedSound(engine->audio->GetSoundDecoder()->Wait(this));
+		else
+			SetDecodedSound(engine->audio->GetSoundDecoder()->Decode(this));
+	}
+
+	if (State == SoundState::Failed)
+		Exception::Throw("Could not decode sound " + Name.ToString());
+}
 
-	frequency = source->GetFrequency();
-	duration = samples.size() / (float)frequency;
-	channels = source->GetChannels();
+void USound::SetDecodedSound(DecodedSound decoded)
+{
+	if (!decoded.Error.empty())
+	{
+		LogMessage("Could not decode sound " + Name.ToString() + ": " + decoded.Error);
+		State = SoundState::Failed;
+		return;
+	}
 
-	loopInfo.Looped = source->bIsLooped;
-	loopInfo.LoopStart = source->loopStart;
-	loopInfo.LoopEnd = source->loopEnd;
+	samples = std::move(decoded.Samples);
+	sampleFormat = decoded.SampleFormat;
+	sampleCount = samples.size() / GetSampleSize(sampleFormat);
+	frequency = decoded.Frequency;
+	channels = decoded.Channels;
+	duration = sampleCount / (float)(frequency * channels);
+	loopInfo = decoded.LoopInfo;
+	State = SoundState::Ready;
 
 	engine->audio->GetDevice()->AddSound(this);
 }
@@ -17,23 +17,57 @@ public:
 	int frequency = 0;
 };
 
+class DecodedSound;
+
+// Storage format of decoded sample data
+enum class SoundSampleFormat
+{
+	Float,
+	Int16,
+	UInt8
+};
+
+inline int GetSampleSize(SoundSampleFormat format) { return format == SoundSampleFormat::Float ? 4 : format == SoundSampleFormat::Int16 ? 2 : 1; }
+
+enum class SoundState
+{
+	NotLoaded,
+	Decoding,
+	Ready,
+	Failed
+};
+
 class USound : public UObject
 {
 public:
 	using UObject::UObject;
+	~USound();
 	void Load(ObjectStream* stream) override;
 
+	// Starts decoding the sound in the background if needed. Returns true once the sound can be played.
+	bool RequestSound();
+
+	// Makes the sound ready to play, waiting for or doing the decode on this thread if needed
 	void GetSound();
+	void SetDecodedSound(DecodedSound decoded);
+
+	bool IsReady() const { return State == SoundState::Ready; }
+	bool IsFailed() const { return State == SoundState::Failed; }
+
 	float GetDuration();
 	int GetChannels();
 
 	NameString Format;
 	Array<uint8_t> Data;
 
-	Array<float> samples;
+	Array<uint8_t> samples;
+	SoundSampleFormat sampleFormat = SoundSampleFormat::Float;
+	size_t sampleCount = 0;
 	float duration = 0.0f;
 	int frequency = 0;
 	int channels = 0;
 	void* handle = nullptr;
 	AudioLoopInfo loopInfo;
+
+	SoundState State = SoundState::NotLoaded;
 };
@@ -18,6 +18,10 @@ std::string USurrealRenderDevice::GetPropertyAsString(const NameString& property
 		return IniPropertyConverter<bool>::ToString(Coronas);
 	else if (propertyName == "HighDetailActors")
 		return IniPropertyConverter<bool>::ToString(HighDetailActors);
+	else if (propertyName == "TextureMemoryBudget")
+		return IniPropertyConverter<int>::ToString(TextureMemoryBudget);
+	else if (propertyName == "TextureCpuMemoryBudget")
+		return IniPropertyConverter<int>::ToString(TextureCpuMemoryBudget);
 
 	LogMessage("Queried unknown property for SurrealRenderDevice: " + propertyName.ToString());
 	return {};
@@ -35,6 +39,10 @@ void USurrealRenderDevice::SetPropertyFromString(const NameString& propertyName,
 		Coronas = IniPropertyConverter<bool>::FromString(value);
 	else if (propertyName == "HighDetailActors")
 		HighDetailActors = IniPropertyConverter<bool>::FromString(value);
+	else if (propertyName == "TextureMemoryBudget")
+		TextureMemoryBudget = IniPropertyConverter<int>::FromString(value);
+	else if (propertyName == "TextureCpuMemoryBudget")
+		TextureCpuMemoryBudget = IniPropertyConverter<int>::FromString(value);
 	else
 		LogMessage("Setting unknown property for SurrealRenderDevice: " + propertyName.ToString());
 
@@ -48,11 +56,13 @@ void USurrealRenderDevice::LoadProperties(const NameString& from)
 	if (from == "")
 		name_from = NameString(Class);
 
-	Translucency = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Translucency", Translucency);
-	VolumetricLighting = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "VolumetricLighting", VolumetricLighting);
-	ShinySurfaces = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "ShinySurfaces", ShinySurfaces);
-	Coronas = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Coronas", Coronas);
-	HighDetailActors = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "HighDetailActors", HighDetailActors);
+	Translucency = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Translucency", Translucency);
+	VolumetricLighting = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "VolumetricLighting", VolumetricLighting);
+	ShinySurfaces = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "ShinySurfaces", ShinySurfaces);
+	Coronas = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Coronas", Coronas);
+	HighDetailActors = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "HighDetailActors", HighDetailActors);
+	TextureMemoryBudget = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "TextureMemoryBudget", TextureMemoryBudget);
+	TextureCpuMemoryBudget = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "TextureCpuMemoryBudget", TextureCpuMemoryBudget);
 }
 
 void USurrealRenderDevice::SaveConfig()
@@ -62,6 +72,8 @@ void USurrealRenderDevice::SaveConfig()
 	engine->packages->SetIniValue("System", Class, "ShinySurfaces", IniPropertyConverter<bool>::ToString(ShinySurfaces));
 	engine->packages->SetIniValue("System", Class, "Coronas", IniPropertyConverter<bool>::ToString(Coronas));
 	engine->packages->SetIniValue("System", Class, "HighDetailActors", IniPropertyConverter<bool>::ToString(HighDetailActors));
+	engine->packages->SetIniValue("System", Class, "TextureMemoryBudget", IniPropertyConverter<int>::ToString(TextureMemoryBudget));
+	engine->packages->SetIniValue("System", Class, "TextureCpuMemoryBudget", IniPropertyConverter<int>::ToString(TextureCpuMemoryBudget));
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -102,6 +114,12 @@ std::string USurrealAudioDevice::GetPropertyAsString(const NameString& propertyN
 		return IniPropertyConverter<uint8_t>::ToString(SoundVolume);
 	else if (propertyName == "AmbientFactor")
 		return IniPropertyConverter<float>::ToString(AmbientFactor);
+	else if (propertyName == "UseSoundCache")
+		return IniPropertyConverter<bool>::ToString(UseSoundCache);
+	else if (propertyName == "SoundCacheSize")
+		return IniPropertyConverter<int>::ToString(SoundCacheSize);
+	else if (propertyName == "SampleFormat")
+		return IniPropertyConverter<std::string>::ToString(SampleFormat);
 
 	LogMessage("Queried unknown property for SurrealAudioDevice: " + propertyName.ToString());
 	return {};
@@ -141,6 +159,12 @@ void USurrealAudioDevice::SetPropertyFromString(const NameString& propertyName,
 		SoundVolume = IniPropertyConverter<uint8_t>::FromString(value);
 	else if (propertyName == "AmbientFactor")
 		AmbientFactor = IniPropertyConverter<float>::FromString(value);
+	else if (propertyName == "UseSoundCache")
+		UseSoundCache = IniPropertyConverter<bool>::FromString(value);
+	else if (propertyName == "SoundCacheSize")
+		SoundCacheSize = IniPropertyConverter<int>::FromString(value);
+	else if (propertyName == "SampleFormat")
+		SampleFormat = IniPropertyConverter<std::string>::FromString(value);
 	else
 		LogMessage("Setting unknown property for SurrealAudioDevice: " + propertyName.ToString());
 
@@ -154,22 +178,25 @@ void USurrealAudioDevice::LoadProperties(const NameString& from)
 	if (from == "")
 		name_from = NameString(Class);
 
-	UseFilter = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseFilter", UseFilter);
-	UseSurround = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseSurround", UseSurround);
-	UseStereo = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseStereo", UseStereo);
-	UseCDMusic = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseCDMusic", UseCDMusic);
-	UseDigitalMusic = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseDigitalMusic", UseDigitalMusic);
-	UseSpatial = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseSpatial", UseSpatial);
-	UseReverb = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseReverb", UseReverb);
-	Use3dHardware = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Use3dHardware", Use3dHardware);
-	LowSoundQuality = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "LowSoundQuality", LowSoundQuality);
-	ReverseStereo = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "ReverseStereo", ReverseStereo);
-	Latency = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Latency", Latency);
-	OutputRate = IniPropertyConverter<AudioFrequency>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "OutputRate", OutputRate);
-	Channels = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Channels", Channels);
-	MusicVolume = IniPropertyConverter<uint8_t>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "MusicVolume", MusicVolume);
-	SoundVolume = IniPropertyConverter<uint8_t>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "SoundVolume", SoundVolume);
-	AmbientFactor = IniPropertyConverter<float>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "AmbientFactor", AmbientFactor);
+	UseFilter = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseFilter", UseFilter);
+	UseSurround = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseSurround", UseSurround);
+	UseStereo = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseStereo", UseStereo);
+	UseCDMusic = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseCDMusic", UseCDMusic);
+	UseDigitalMusic = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseDigitalMusic", UseDigitalMusic);
+	UseSpatial = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseSpatial", UseSpatial);
+	UseReverb = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseReverb", UseReverb);
+	Use3dHardware = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Use3dHardware", Use3dHardware);
+	LowSoundQuality = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "LowSoundQuality", LowSoundQuality);
+	ReverseStereo = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "ReverseStereo", ReverseStereo);
+	Latency = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Latency", Latency);
+	OutputRate = IniPropertyConverter<AudioFrequency>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "OutputRate", OutputRate);
+	Channels = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Channels", Channels);
+	MusicVolume = IniPropertyConverter<uint8_t>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "MusicVolume", MusicVolume);
+	SoundVolume = IniPropertyConverter<uint8_t>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "SoundVolume", SoundVolume);
+	AmbientFactor = IniPropertyConverter<float>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "AmbientFactor", AmbientFactor);
+	UseSoundCache = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseSoundCache", UseSoundCache);
+	SoundCacheSize = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "SoundCacheSize", SoundCacheSize);
+	SampleFormat = IniPropertyConverter<std::string>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "SampleFormat", SampleFormat);
 }
 
 void USurrealAudioDevice::SaveConfig()
@@ -190,6 +217,9 @@ void USurrealAudioDevice::SaveConfig()
 	engine->packages->SetIniValue("System", Class, "MusicVolume", IniPropertyConverter<uint8_t>::ToString(MusicVolume));
 	engine->packages->SetIniValue("System", Class, "SoundVolume", IniPropertyConverter<uint8_t>::ToString(SoundVolume));
 	engine->packages->SetIniValue("System", Class, "AmbientFactor", IniPropertyConverter<float>::ToString(AmbientFactor));
+	engine->packages->SetIniValue("System", Class, "UseSoundCache", IniPropertyConverter<bool>::ToString(UseSoundCache));
+	engine->packages->SetIniValue("System", Class, "SoundCacheSize", IniPropertyConverter<int>::ToString(SoundCacheSize));
+	engine->packages->SetIniValue("System", Class, "SampleFormat", IniPropertyConverter<std::string>::ToString(SampleFormat));
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -218,21 +248,21 @@ void USurrealClient::LoadProperties(const NameString& from)
 	if (from == "")
 		name_from = NameString(Class);
 
-	StartupFullscreen = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "StartupFullscreen", StartupFullscreen);
-	WindowedViewportX = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "WindowedViewportX", WindowedViewportX);
-	WindowedViewportY = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "WindowedViewportY", WindowedViewportY);
-	WindowedColorBits = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "WindowedColorBits", WindowedColorBits);
-	FullscreenViewportX = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "FullscreenViewportX", FullscreenViewportX);
-	FullscreenViewportY = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "FullscreenViewportY", FullscreenViewportY);
-	FullscreenColorBits = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "FullscreenColorBits", FullscreenColorBits);
-	Brightness = IniPropertyConverter<float>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Brightness", Brightness);
-	UseJoystick = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseJoystick", UseJoystick);
-	UseDirectInput = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "UseDirectInput", UseDirectInput);
-	MinDesiredFrameRate = IniPropertyConverter<int>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "MinDesiredFrameRate", MinDesiredFrameRate);
-	Decals = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "Decals", Decals);
-	NoDynamicLights = IniPropertyConverter<bool>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "NoDynamicLights", NoDynamicLights);
-	TextureDetail = IniPropertyConverter<std::string>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "TextureDetail", TextureDetail);
-	SkinDetail = IniPropertyConverter<std::string>::FromIniFile(*engine->packages->GetIniFile("System"), name_from, "SkinDetail", SkinDetail);
+	StartupFullscreen = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "StartupFullscreen", StartupFullscreen);
+	WindowedViewportX = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "WindowedViewportX", WindowedViewportX);
+	WindowedViewportY = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "WindowedViewportY", WindowedViewportY);
+	WindowedColorBits = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "WindowedColorBits", WindowedColorBits);
+	FullscreenViewportX = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "FullscreenViewportX", FullscreenViewportX);
+	FullscreenViewportY = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "FullscreenViewportY", FullscreenViewportY);
+	FullscreenColorBits = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "FullscreenColorBits", FullscreenColorBits);
+	Brightness = IniPropertyConverter<float>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Brightness", Brightness);
+	UseJoystick = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseJoystick", UseJoystick);
+	UseDirectInput = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "UseDirectInput", UseDirectInput);
+	MinDesiredFrameRate = IniPropertyConverter<int>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "MinDesiredFrameRate", MinDesiredFrameRate);
+	Decals = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "Decals", Decals);
+	NoDynamicLights = IniPropertyConverter<bool>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "NoDynamicLights", NoDynamicLights);
+	TextureDetail = IniPropertyConverter<std::string>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "TextureDetail", TextureDetail);
+	SkinDetail = IniPropertyConverter<std::string>::FromIniFile(engine->packages->GetIniFile("System"), name_from, "SkinDetail", SkinDetail);
 }
 
 void USurrealClient::SaveConfig()
@@ -74,6 +74,8 @@ public:
 	bool ShinySurfaces = true;
 	bool Coronas = true;
 	bool HighDetailActors = true;
+	int TextureMemoryBudget = 1024; // In megabytes
+	int TextureCpuMemoryBudget = 512; // In megabytes, for the texture mip data read from packages
 
 	void LoadProperties(const NameString& from = "") override;
 	void SaveConfig() override;
@@ -104,6 +106,9 @@ public:
 	uint8_t MusicVolume = 160;
 	uint8_t SoundVolume = 200;
 	float AmbientFactor = 0.7f;
+	bool UseSoundCache = true;
+	int SoundCacheSize = 512; // In megabytes
+	std::string SampleFormat = "Native"; // Float, Int16 or Native
 
 	void LoadProperties(const NameString& from = "") override;
 	void SaveConfig() override;
@@ -1,11 +1,26 @@
 
 #include "Precomp.h"
 #include "UTexture.h"
+#include "Package/Package.h"
+#include <unordered_set>
+
+// Textures holding mip data read on demand
+static std::unordered_set<UTexture*> MipCacheTextures;
+static uint64_t MipCacheUsage = 0;
+static uint64_t MipCacheFrame = 1;
+
+UTexture::~UTexture()
+{
+	UnloadMips();
+}
 
 void UTexture::Load(ObjectStream* stream)
 {
 	UBitmap::Load(stream);
 
+	// Only the mip sizes are read here. The data is read from the package when the texture is first used.
+	MipPackage = stream->GetPackage();
+
 	ActualFormat = (TextureFormat)GetByte("Format");
 
 	int mipsCount = stream->ReadUInt8();
@@ -17,8 +32,9 @@ void UTexture::Load(ObjectStream* stream)
 		if (stream->GetVersion() >= 63)
 			widthoffset = stream->ReadInt32();
 		int bytes = stream->ReadIndex();
-		mipmap.Data.resize(bytes);
-		stream->ReadBytes(mipmap.Data.data(), bytes);
+		mipmap.FileOffset = stream->Tell();
+		mipmap.FileSize = bytes;
+		stream->Skip(bytes);
 		mipmap.Width = stream->ReadUInt32();
 		mipmap.Height = stream->ReadUInt32();
 		uint8_t UBits = stream->ReadUInt8();
@@ -37,8 +53,9 @@ void UTexture::Load(ObjectStream* stream)
 			if (stream->GetVersion() >= 68)
 				widthoffset = stream->ReadInt32();
 			int bytes = stream->ReadIndex();
-			mipmap.Data.resize(bytes);
-			stream->ReadBytes(mipmap.Data.data(), bytes);
+			mipmap.FileOffset = stream->Tell();
+			mipmap.FileSize = bytes;
+			stream->Skip(bytes);
 			mipmap.Width = stream->ReadUInt32();
 			mipmap.Height = stream->ReadUInt32();
 			uint8_t UBits = stream->ReadUInt8();
@@ -47,6 +64,60 @@ void UTexture::Load(ObjectStream* stream)
 	}
 }
 
+void UTexture::LoadMips(int firstMip)
+{
+	MipsLastUsed = MipCacheFrame;
+	for (int level = std::max(firstMip, 0); level < (int)Mipmaps.size(); level++)
+	{
+		UnrealMipmap& mipmap = Mipmaps[level];
+		if (mipmap.FileSize != 0 && mipmap.Data.empty())
+		{
+			mipmap.Data.resize(mipmap.FileSize);
+			MipPackage->ReadBytes(mipmap.FileOffset, mipmap.Data.data(), mipmap.FileSize);
+			MipCacheUsage += mipmap.FileSize;
+			MipCacheTextures.insert(this);
+		}
+	}
+}
+
+void UTexture::UnloadMips()
+{
+	// Data that did not come from the package, such as the pixels of fractal textures, is kept
+	for (UnrealMipmap& mipmap : Mipmaps)
+	{
+		if (mipmap.FileSize != 0 && !mipmap.Data.empty())
+		{
+			MipCacheUsage -= mipmap.Data.size();
+			Array<uint8_t>().swap(mipmap.Data);
+		}
+	}
+	MipCacheTextures.erase(this);
+}
+
+void UTexture::EvictMips(uint64_t budget)
+{
+	if (MipCacheUsage > budget)
+	{
+		Array<UTexture*> candidates;
+		for (UTexture* texture : MipCacheTextures)
+		{
+			if (texture->MipsLastUsed < MipCacheFrame)
+				candidates.push_back(texture);
+		}
+
+		// Go below the budget by a margin so that eviction does not run again on the next frame
+		std::sort(candidates.begin(), candidates.end(), [](UTexture* a, UTexture* b) { return a->MipsLastUsed < b->MipsLastUsed; });
+		uint64_t target = budget / 8 * 7;
+		for (UTexture* texture : candidates)
+		{
+			if (MipCacheUsage <= target)
+				break;
+			texture->UnloadMips();
+		}
+	}
+	MipCacheFrame++;
+}
+
 void UTexture::Update(float elapsed)
 {
 	float animationSpeed = 0.0f;
@@ -83,6 +154,7 @@ void UFractalTexture::Load(ObjectStream* stream)
 	UTexture::Load(stream);
 
 	ActualFormat = TextureFormat::P8;
+	Mipmaps.clear();
 	Mipmaps.resize(1);
 
 	int width = GetInt("UClamp");
@@ -342,7 +414,9 @@ void UIceTexture::UpdateFrame()
 		int count = width * height;
 
 		UTexture* tex = SourceTexture();
-		if (tex && !tex->Mipmaps.empty() && tex->Mipmaps.front().Width == mipmap.Width && tex->Mipmaps.front().Height == mipmap.Height)
+		if (tex)
+			tex->LoadMips();
+		if (tex && !tex->Mipmaps.empty() && tex->Mipmaps.front().Width == mipmap.Width && tex->Mipmaps.front().Height == mipmap.Height && !tex->Mipmaps.front().Data.empty())
 		{
 			const uint8_t* srcpixels = (const uint8_t*)tex->Mipmaps.front().Data.data();
 			for (int i = 0; i < count; i++)
@@ -570,7 +644,9 @@ void UWetTexture::UpdateFrame()
 		UnrealMipmap& mipmap = Mipmaps.front();
 
 		UTexture* tex = SourceTexture();
-		if (tex && !tex->Mipmaps.empty() && tex->Mipmaps.front().Width == mipmap.Width && tex->Mipmaps.front().Height == mipmap.Height)
+		if (tex)
+			tex->LoadMips();
+		if (tex && !tex->Mipmaps.empty() && tex->Mipmaps.front().Width == mipmap.Width && tex->Mipmaps.front().Height == mipmap.Height && !tex->Mipmaps.front().Data.empty())
 		{
 			int width = mipmap.Width;
 			int height = mipmap.Height;
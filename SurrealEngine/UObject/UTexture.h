@@ -3,6 +3,7 @@
 #include "UObject.h"
 
 class UPalette;
+class Package;
 class USound;
 class UActor;
 
@@ -12,6 +13,12 @@ public:
 	int Width;
 	int Height;
 	Array<uint8_t> Data;
+
+	// Where the data is stored in the package file. Data stored there is read when first needed and may be dropped again.
+	uint32_t FileOffset = 0;
+	uint32_t FileSize = 0;
+
+	bool HasData() const { return !Data.empty() || FileSize != 0; }
 };
 
 enum class TextureFormat : uint32_t
@@ -154,25 +161,33 @@ class UBitmap : public UObject
 public:
 	using UObject::UObject;
 
-	uint8_t& Format() { return Value<uint8_t>(PropOffsets_Bitmap.Format); }
-	int& InternalTime() { return Value<int>(PropOffsets_Bitmap.InternalTime); }
-	Color& MaxColor() { return Value<Color>(PropOffsets_Bitmap.MaxColor); }
-	Color& MipZero() { return Value<Color>(PropOffsets_Bitmap.MipZero); }
-	UPalette*& Palette() { return Value<UPalette*>(PropOffsets_Bitmap.Palette); }
-	uint8_t& UBits() { return Value<uint8_t>(PropOffsets_Bitmap.UBits); }
-	int& UClamp() { return Value<int>(PropOffsets_Bitmap.UClamp); }
-	int& USize() { return Value<int>(PropOffsets_Bitmap.USize); }
-	uint8_t& VBits() { return Value<uint8_t>(PropOffsets_Bitmap.VBits); }
-	int& VClamp() { return Value<int>(PropOffsets_Bitmap.VClamp); }
-	int& VSize() { return Value<int>(PropOffsets_Bitmap.VSize); }
+	PROPERTY_VALUE(uint8_t, Format, PropOffsets_Bitmap.Format)
+	PROPERTY_VALUE(int, InternalTime, PropOffsets_Bitmap.InternalTime)
+	PROPERTY_VALUE(Color, MaxColor, PropOffsets_Bitmap.MaxColor)
+	PROPERTY_VALUE(Color, MipZero, PropOffsets_Bitmap.MipZero)
+	PROPERTY_VALUE(UPalette*, Palette, PropOffsets_Bitmap.Palette)
+	PROPERTY_VALUE(uint8_t, UBits, PropOffsets_Bitmap.UBits)
+	PROPERTY_VALUE(int, UClamp, PropOffsets_Bitmap.UClamp)
+	PROPERTY_VALUE(int, USize, PropOffsets_Bitmap.USize)
+	PROPERTY_VALUE(uint8_t, VBits, PropOffsets_Bitmap.VBits)
+	PROPERTY_VALUE(int, VClamp, PropOffsets_Bitmap.VClamp)
+	PROPERTY_VALUE(int, VSize, PropOffsets_Bitmap.VSize)
 };
 
 class UTexture : public UBitmap
 {
 public:
 	using UBitmap::UBitmap;
+	~UTexture();
 	void Load(ObjectStream* stream) override;
 
+	// Reads the data of the mip levels from firstMip down that is not in memory. Only call this from the main thread.
+	void LoadMips(int firstMip = 0);
+
+	// Drops the mip data of the least recently used textures until the data read on demand fits the budget again.
+	// Textures used since the last call keep their data. Called after each frame.
+	static void EvictMips(uint64_t budget);
+
 	UTexture* GetAnimTexture() { return AnimCurrent() ? AnimCurrent() : this; }
 
 	int GetAnimTextureCount()
@@ -241,66 +256,72 @@ public:
 #endif
 	}
 
-	float& Accumulator() { return Value<float>(PropOffsets_Texture.Accumulator); }
-	float& Alpha() { return Value<float>(PropOffsets_Texture.Alpha); }
-	UTexture*& AnimCurrent() { return Value<UTexture*>(PropOffsets_Texture.AnimCurrent); }
-	UTexture*& AnimNext() { return Value<UTexture*>(PropOffsets_Texture.AnimNext); }
-	UTexture*& BumpMap() { return Value<UTexture*>(PropOffsets_Texture.BumpMap); }
-	uint8_t& CompFormat() { return Value<uint8_t>(PropOffsets_Texture.CompFormat); }
-	Array<void*>& CompMips() { return Value<Array<void*>>(PropOffsets_Texture.CompMips); } // native
-	UTexture*& DetailTexture() { return Value<UTexture*>(PropOffsets_Texture.DetailTexture); }
-	float& Diffuse() { return Value<float>(PropOffsets_Texture.Diffuse); }
-	float& DrawScale() { return Value<float>(PropOffsets_Texture.DrawScale); }
-	USound*& FootstepSound() { return Value<USound*>(PropOffsets_Texture.FootstepSound); }
-	float& Friction() { return Value<float>(PropOffsets_Texture.Friction); }
-	USound*& HitSound() { return Value<USound*>(PropOffsets_Texture.HitSound); }
-	uint8_t& LODSet() { return Value<uint8_t>(PropOffsets_Texture.LODSet); }
-	UTexture*& MacroTexture() { return Value<UTexture*>(PropOffsets_Texture.MacroTexture); }
-	float& MaxFrameRate() { return Value<float>(PropOffsets_Texture.MaxFrameRate); }
-	float& MinFrameRate() { return Value<float>(PropOffsets_Texture.MinFrameRate); }
-	float& MipMult() { return Value<float>(PropOffsets_Texture.MipMult); }
-	Array<void*>& Mips() { return Value<Array<void*>>(PropOffsets_Texture.Mips); } // native
-	uint8_t& PrimeCount() { return Value<uint8_t>(PropOffsets_Texture.PrimeCount); }
-	uint8_t& PrimeCurrent() { return Value<uint8_t>(PropOffsets_Texture.PrimeCurrent); }
-	float& Specular() { return Value<float>(PropOffsets_Texture.Specular); }
-	BitfieldBool bAutoUPan() { return BoolValue(PropOffsets_Texture.bAutoUPan); }
-	BitfieldBool bAutoVPan() { return BoolValue(PropOffsets_Texture.bAutoVPan); }
-	BitfieldBool bBigWavy() { return BoolValue(PropOffsets_Texture.bBigWavy); }
-	BitfieldBool bCloudWavy() { return BoolValue(PropOffsets_Texture.bCloudWavy); }
-	BitfieldBool bDirtyShadows() { return BoolValue(PropOffsets_Texture.bDirtyShadows); }
-	BitfieldBool bEnvironment() { return BoolValue(PropOffsets_Texture.bEnvironment); }
-	BitfieldBool bFakeBackdrop() { return BoolValue(PropOffsets_Texture.bFakeBackdrop); }
-	BitfieldBool bGouraud() { return BoolValue(PropOffsets_Texture.bGouraud); }
-	BitfieldBool bHasComp() { return BoolValue(PropOffsets_Texture.bHasComp); }
-	BitfieldBool bHighColorQuality() { return BoolValue(PropOffsets_Texture.bHighColorQuality); }
-	BitfieldBool bHighLedge() { return BoolValue(PropOffsets_Texture.bHighLedge); }
-	BitfieldBool bHighShadowDetail() { return BoolValue(PropOffsets_Texture.bHighShadowDetail); }
-	BitfieldBool bHighTextureQuality() { return BoolValue(PropOffsets_Texture.bHighTextureQuality); }
-	BitfieldBool bInvisible() { return BoolValue(PropOffsets_Texture.bInvisible); }
-	BitfieldBool bLowShadowDetail() { return BoolValue(PropOffsets_Texture.bLowShadowDetail); }
-	BitfieldBool bMasked() { return BoolValue(PropOffsets_Texture.bMasked); }
-	BitfieldBool bMirrored() { return BoolValue(PropOffsets_Texture.bMirrored); }
-	BitfieldBool bModulate() { return BoolValue(PropOffsets_Texture.bModulate); }
-	BitfieldBool bNoMerge() { return BoolValue(PropOffsets_Texture.bNoMerge); }
-	BitfieldBool bNoSmooth() { return BoolValue(PropOffsets_Texture.bNoSmooth); }
-	BitfieldBool bNotSolid() { return BoolValue(PropOffsets_Texture.bNotSolid); }
-	BitfieldBool bParametric() { return BoolValue(PropOffsets_Texture.bParametric); }
-	BitfieldBool bPortal() { return BoolValue(PropOffsets_Texture.bPortal); }
-	BitfieldBool bRealtime() { return BoolValue(PropOffsets_Texture.bRealtime); }
-	BitfieldBool bRealtimeChanged() { return BoolValue(PropOffsets_Texture.bRealtimeChanged); }
-	BitfieldBool bSemisolid() { return BoolValue(PropOffsets_Texture.bSemisolid); }
-	BitfieldBool bSmallWavy() { return BoolValue(PropOffsets_Texture.bSmallWavy); }
-	BitfieldBool bSpecialLit() { return BoolValue(PropOffsets_Texture.bSpecialLit); }
-	BitfieldBool bTransparent() { return BoolValue(PropOffsets_Texture.bTransparent); }
-	BitfieldBool bTwoSided() { return BoolValue(PropOffsets_Texture.bTwoSided); }
-	BitfieldBool bUnlit() { return BoolValue(PropOffsets_Texture.bUnlit); }
-	BitfieldBool bWaterWavy() { return BoolValue(PropOffsets_Texture.bWaterWavy); }
-	BitfieldBool bX2() { return BoolValue(PropOffsets_Texture.bX2); }
-	BitfieldBool bX3() { return BoolValue(PropOffsets_Texture.bX3); }
-	BitfieldBool bX4() { return BoolValue(PropOffsets_Texture.bX4); }
-	BitfieldBool bX5() { return BoolValue(PropOffsets_Texture.bX5); }
-	BitfieldBool bX6() { return BoolValue(PropOffsets_Texture.bX6); }
-	BitfieldBool bX7() { return BoolValue(PropOffsets_Texture.bX7); }
+	PROPERTY_VALUE(float, Accumulator, PropOffsets_Texture.Accumulator)
+	PROPERTY_VALUE(float, Alpha, PropOffsets_Texture.Alpha)
+	PROPERTY_VALUE(UTexture*, AnimCurrent, PropOffsets_Texture.AnimCurrent)
+	PROPERTY_VALUE(UTexture*, AnimNext, PropOffsets_Texture.AnimNext)
+	PROPERTY_VALUE(UTexture*, BumpMap, PropOffsets_Texture.BumpMap)
+	PROPERTY_VALUE(uint8_t, CompFormat, PropOffsets_Texture.CompFormat)
+	PROPERTY_VALUE(Array<void*>, CompMips, PropOffsets_Texture.CompMips) // native
+	PROPERTY_VALUE(UTexture*, DetailTexture, PropOffsets_Texture.DetailTexture)
+	PROPERTY_VALUE(float, Diffuse, PropOffsets_Texture.Diffuse)
+	PROPERTY_VALUE(float, DrawScale, PropOffsets_Texture.DrawScale)
+	PROPERTY_VALUE(USound*, FootstepSound, PropOffsets_Texture.FootstepSound)
+	PROPERTY_VALUE(float, Friction, PropOffsets_Texture.Friction)
+	PROPERTY_VALUE(USound*, HitSound, PropOffsets_Texture.HitSound)
+	PROPERTY_VALUE(uint8_t, LODSet, PropOffsets_Texture.LODSet)
+	PROPERTY_VALUE(UTexture*, MacroTexture, PropOffsets_Texture.MacroTexture)
+	PROPERTY_VALUE(float, MaxFrameRate, PropOffsets_Texture.MaxFrameRate)
+	PROPERTY_VALUE(float, MinFrameRate, PropOffsets_Texture.MinFrameRate)
+	PROPERTY_VALUE(float, MipMult, PropOffsets_Texture.MipMult)
+	PROPERTY_VALUE(Array<void*>, Mips, PropOffsets_Texture.Mips) // native
+	PROPERTY_VALUE(uint8_t, PrimeCount, PropOffsets_Texture.PrimeCount)
+	PROPERTY_VALUE(uint8_t, PrimeCurrent, PropOffsets_Texture.PrimeCurrent)
+	PROPERTY_VALUE(float, Specular, PropOffsets_Texture.Specular)
+	PROPERTY_BOOL(bAutoUPan, PropOffsets_Texture.bAutoUPan)
+	PROPERTY_BOOL(bAutoVPan, PropOffsets_Texture.bAutoVPan)
+	PROPERTY_BOOL(bBigWavy, PropOffsets_Texture.bBigWavy)
+	PROPERTY_BOOL(bCloudWavy, PropOffsets_Texture.bCloudWavy)
+	PROPERTY_BOOL(bDirtyShadows, PropOffsets_Texture.bDirtyShadows)
+	PROPERTY_BOOL(bEnvironment, PropOffsets_Texture.bEnvironment)
+	PROPERTY_BOOL(bFakeBackdrop, PropOffsets_Texture.bFakeBackdrop)
+	PROPERTY_BOOL(bGouraud, PropOffsets_Texture.bGouraud)
+	PROPERTY_BOOL(bHasComp, PropOffsets_Texture.bHasComp)
+	PROPERTY_BOOL(bHighColorQuality, PropOffsets_Texture.bHighColorQuality)
+	PROPERTY_BOOL(bHighLedge, PropOffsets_Texture.bHighLedge)
+	PROPERTY_BOOL(bHighShadowDetail, PropOffsets_Texture.bHighShadowDetail)
+	PROPERTY_BOOL(bHighTextureQuality, PropOffsets_Texture.bHighTextureQuality)
+	PROPERTY_BOOL(bInvisible, PropOffsets_Texture.bInvisible)
+	PROPERTY_BOOL(bLowShadowDetail, PropOffsets_Texture.bLowShadowDetail)
+	PROPERTY_BOOL(bMasked, PropOffsets_Texture.bMasked)
+	PROPERTY_BOOL(bMirrored, PropOffsets_Texture.bMirrored)
+	PROPERTY_BOOL(bModulate, PropOffsets_Texture.bModulate)
+	PROPERTY_BOOL(bNoMerge, PropOffsets_Texture.bNoMerge)
+	PROPERTY_BOOL(bNoSmooth, PropOffsets_Texture.bNoSmooth)
+	PROPERTY_BOOL(bNotSolid, PropOffsets_Texture.bNotSolid)
+	PROPERTY_BOOL(bParametric, PropOffsets_Texture.bParametric)
+	PROPERTY_BOOL(bPortal, PropOffsets_Texture.bPortal)
+	PROPERTY_BOOL(bRealtime, PropOffsets_Texture.bRealtime)
+	PROPERTY_BOOL(bRealtimeChanged, PropOffsets_Texture.bRealtimeChanged)
+	PROPERTY_BOOL(bSemisolid, PropOffsets_Texture.bSemisolid)
+	PROPERTY_BOOL(bSmallWavy, PropOffsets_Texture.bSmallWavy)
+	PROPERTY_BOOL(bSpecialLit, PropOffsets_Texture.bSpecialLit)
+	PROPERTY_BOOL(bTransparent, PropOffsets_Texture.bTransparent)
+	PROPERTY_BOOL(bTwoSided, PropOffsets_Texture.bTwoSided)
+	PROPERTY_BOOL(bUnlit, PropOffsets_Texture.bUnlit)
+	PROPERTY_BOOL(bWaterWavy, PropOffsets_Texture.bWaterWavy)
+	PROPERTY_BOOL(bX2, PropOffsets_Texture.bX2)
+	PROPERTY_BOOL(bX3, PropOffsets_Texture.bX3)
+	PROPERTY_BOOL(bX4, PropOffsets_Texture.bX4)
+	PROPERTY_BOOL(bX5, PropOffsets_Texture.bX5)
+	PROPERTY_BOOL(bX6, PropOffsets_Texture.bX6)
+	PROPERTY_BOOL(bX7, PropOffsets_Texture.bX7)
+
+private:
+	void UnloadMips();
+
+	Package* MipPackage = nullptr;
+	uint64_t MipsLastUsed = 0;
 };
 
 class UFractalTexture : public UTexture
@@ -309,13 +330,13 @@ public:
 	using UTexture::UTexture;
 	void Load(ObjectStream* stream) override;
 
-	uint8_t& AuxPhase() { return Value<uint8_t>(PropOffsets_FractalTexture.AuxPhase); }
-	uint8_t& DrawPhase() { return Value<uint8_t>(PropOffsets_FractalTexture.DrawPhase); }
-	int& GlobalPhase() { return Value<int>(PropOffsets_FractalTexture.GlobalPhase); }
-	int& LightOutput() { return Value<int>(PropOffsets_FractalTexture.LightOutput); }
-	int& SoundOutput() { return Value<int>(PropOffsets_FractalTexture.SoundOutput); }
-	int& UMask() { return Value<int>(PropOffsets_FractalTexture.UMask); }
-	int& VMask() { return Value<int>(PropOffsets_FractalTexture.VMask); }
+	PROPERTY_VALUE(uint8_t, AuxPhase, PropOffsets_FractalTexture.AuxPhase)
+	PROPERTY_VALUE(uint8_t, DrawPhase, PropOffsets_FractalTexture.DrawPhase)
+	PROPERTY_VALUE(int, GlobalPhase, PropOffsets_FractalTexture.GlobalPhase)
+	PROPERTY_VALUE(int, LightOutput, PropOffsets_FractalTexture.LightOutput)
+	PROPERTY_VALUE(int, SoundOutput, PropOffsets_FractalTexture.SoundOutput)
+	PROPERTY_VALUE(int, UMask, PropOffsets_FractalTexture.UMask)
+	PROPERTY_VALUE(int, VMask, PropOffsets_FractalTexture.VMask)
 };
 
 enum class ESpark : uint8_t
@@ -403,26 +424,26 @@ public:
 
 	const Array<Spark>& GetSparks() const { return Sparks; }
 
-	FireDrawMode& DrawMode() { return Value<FireDrawMode>(PropOffsets_FireTexture.DrawMode); }
-	uint8_t& FX_Area() { return Value<uint8_t>(PropOffsets_FireTexture.FX_Area); }
-	uint8_t& FX_AuxSize() { return Value<uint8_t>(PropOffsets_FireTexture.FX_AuxSize); }
-	uint8_t& FX_Frequency() { return Value<uint8_t>(PropOffsets_FireTexture.FX_Frequency); }
-	uint8_t& FX_Heat() { return Value<uint8_t>(PropOffsets_FireTexture.FX_Heat); }
-	uint8_t& FX_HorizSpeed() { return Value<uint8_t>(PropOffsets_FireTexture.FX_HorizSpeed); }
-	uint8_t& FX_Phase() { return Value<uint8_t>(PropOffsets_FireTexture.FX_Phase); }
-	uint8_t& FX_Size() { return Value<uint8_t>(PropOffsets_FireTexture.FX_Size); }
-	uint8_t& FX_VertSpeed() { return Value<uint8_t>(PropOffsets_FireTexture.FX_VertSpeed); }
-	int& NumSparks() { return Value<int>(PropOffsets_FireTexture.NumSparks); }
-	int& OldRenderHeat() { return Value<int>(PropOffsets_FireTexture.OldRenderHeat); }
-	uint8_t& PenDownX() { return Value<uint8_t>(PropOffsets_FireTexture.PenDownX); }
-	uint8_t& PenDownY() { return Value<uint8_t>(PropOffsets_FireTexture.PenDownY); }
-	uint8_t& RenderHeat() { return Value<uint8_t>(PropOffsets_FireTexture.RenderHeat); }
-	uint8_t& RenderTable() { return Value<uint8_t>(PropOffsets_FireTexture.RenderTable); }
-	uint8_t& SparkType() { return Value<uint8_t>(PropOffsets_FireTexture.SparkType); }
+	PROPERTY_VALUE(FireDrawMode, DrawMode, PropOffsets_FireTexture.DrawMode)
+	PROPERTY_VALUE(uint8_t, FX_Area, PropOffsets_FireTexture.FX_Area)
+	PROPERTY_VALUE(uint8_t, FX_AuxSize, PropOffsets_FireTexture.FX_AuxSize)
+	PROPERTY_VALUE(uint8_t, FX_Frequency, PropOffsets_FireTexture.FX_Frequency)
+	PROPERTY_VALUE(uint8_t, FX_Heat, PropOffsets_FireTexture.FX_Heat)
+	PROPERTY_VALUE(uint8_t, FX_HorizSpeed, PropOffsets_FireTexture.FX_HorizSpeed)
+	PROPERTY_VALUE(uint8_t, FX_Phase, PropOffsets_FireTexture.FX_Phase)
+	PROPERTY_VALUE(uint8_t, FX_Size, PropOffsets_FireTexture.FX_Size)
+	PROPERTY_VALUE(uint8_t, FX_VertSpeed, PropOffsets_FireTexture.FX_VertSpeed)
+	PROPERTY_VALUE(int, NumSparks, PropOffsets_FireTexture.NumSparks)
+	PROPERTY_VALUE(int, OldRenderHeat, PropOffsets_FireTexture.OldRenderHeat)
+	PROPERTY_VALUE(uint8_t, PenDownX, PropOffsets_FireTexture.PenDownX)
+	PROPERTY_VALUE(uint8_t, PenDownY, PropOffsets_FireTexture.PenDownY)
+	PROPERTY_VALUE(uint8_t, RenderHeat, PropOffsets_FireTexture.RenderHeat)
+	PROPERTY_VALUE(uint8_t, RenderTable, PropOffsets_FireTexture.RenderTable)
+	PROPERTY_VALUE(uint8_t, SparkType, PropOffsets_FireTexture.SparkType)
 	//Array<Spark*>& Sparks() { return Value<Array<Spark*>>(PropOffsets_FireTexture.Sparks); }
-	int& SparksLimit() { return Value<int>(PropOffsets_FireTexture.SparksLimit); }
-	uint8_t& StarStatus() { return Value<uint8_t>(PropOffsets_FireTexture.StarStatus); }
-	BitfieldBool bRising() { return BoolValue(PropOffsets_FireTexture.bRising); }
+	PROPERTY_VALUE(int, SparksLimit, PropOffsets_FireTexture.SparksLimit)
+	PROPERTY_VALUE(uint8_t, StarStatus, PropOffsets_FireTexture.StarStatus)
+	PROPERTY_BOOL(bRising, PropOffsets_FireTexture.bRising)
 
 private:
 	int RandomByteValue() { return (int)(rand() * 256LL / (RAND_MAX + 1LL)); }
@@ -441,27 +462,27 @@ public:
 
 	void UpdateFrame() override;
 
-	uint8_t& Amplitude() { return Value<uint8_t>(PropOffsets_IceTexture.Amplitude); }
-	int& ForceRefresh() { return Value<int>(PropOffsets_IceTexture.ForceRefresh); }
-	uint8_t& Frequency() { return Value<uint8_t>(PropOffsets_IceTexture.Frequency); }
-	UTexture*& GlassTexture() { return Value<UTexture*>(PropOffsets_IceTexture.GlassTexture); }
-	uint8_t& HorizPanSpeed() { return Value<uint8_t>(PropOffsets_IceTexture.HorizPanSpeed); }
-	int& LocalSource() { return Value<int>(PropOffsets_IceTexture.LocalSource); }
-	float& MasterCount() { return Value<float>(PropOffsets_IceTexture.MasterCount); }
-	BitfieldBool MoveIce() { return BoolValue(PropOffsets_IceTexture.MoveIce); }
-	UTexture*& OldGlassTex() { return Value<UTexture*>(PropOffsets_IceTexture.OldGlassTex); }
-	UTexture*& OldSourceTex() { return Value<UTexture*>(PropOffsets_IceTexture.OldSourceTex); }
-	int& OldUDisplace() { return Value<int>(PropOffsets_IceTexture.OldUDisplace); }
-	int& OldVDisplace() { return Value<int>(PropOffsets_IceTexture.OldVDisplace); }
-	uint8_t& PanningStyle() { return Value<uint8_t>(PropOffsets_IceTexture.PanningStyle); }
-	UTexture*& SourceTexture() { return Value<UTexture*>(PropOffsets_IceTexture.SourceTexture); }
-	float& TickAccu() { return Value<float>(PropOffsets_IceTexture.TickAccu); }
-	uint8_t& TimeMethod() { return Value<uint8_t>(PropOffsets_IceTexture.TimeMethod); }
-	float& UDisplace() { return Value<float>(PropOffsets_IceTexture.UDisplace); }
-	float& UPosition() { return Value<float>(PropOffsets_IceTexture.UPosition); }
-	float& VDisplace() { return Value<float>(PropOffsets_IceTexture.VDisplace); }
-	float& VPosition() { return Value<float>(PropOffsets_IceTexture.VPosition); }
-	uint8_t& VertPanSpeed() { return Value<uint8_t>(PropOffsets_IceTexture.VertPanSpeed); }
+	PROPERTY_VALUE(uint8_t, Amplitude, PropOffsets_IceTexture.Amplitude)
+	PROPERTY_VALUE(int, ForceRefresh, PropOffsets_IceTexture.ForceRefresh)
+	PROPERTY_VALUE(uint8_t, Frequency, PropOffsets_IceTexture.Frequency)
+	PROPERTY_VALUE(UTexture*, GlassTexture, PropOffsets_IceTexture.GlassTexture)
+	PROPERTY_VALUE(uint8_t, HorizPanSpeed, PropOffsets_IceTexture.HorizPanSpeed)
+	PROPERTY_VALUE(int, LocalSource, PropOffsets_IceTexture.LocalSource)
+	PROPERTY_VALUE(float, MasterCount, PropOffsets_IceTexture.MasterCount)
+	PROPERTY_BOOL(MoveIce, PropOffsets_IceTexture.MoveIce)
+	PROPERTY_VALUE(UTexture*, OldGlassTex, PropOffsets_IceTexture.OldGlassTex)
+	PROPERTY_VALUE(UTexture*, OldSourceTex, PropOffsets_IceTexture.OldSourceTex)
+	PROPERTY_VALUE(int, OldUDisplace, PropOffsets_IceTexture.OldUDisplace)
+	PROPERTY_VALUE(int, OldVDisplace, PropOffsets_IceTexture.OldVDisplace)
+	PROPERTY_VALUE(uint8_t, PanningStyle, PropOffsets_IceTexture.PanningStyle)
+	PROPERTY_VALUE(UTexture*, SourceTexture, PropOffsets_IceTexture.SourceTexture)
+	PROPERTY_VALUE(float, TickAccu, PropOffsets_IceTexture.TickAccu)
+	PROPERTY_VALUE(uint8_t, TimeMethod, PropOffsets_IceTexture.TimeMethod)
+	PROPERTY_VALUE(float, UDisplace, PropOffsets_IceTexture.UDisplace)
+	PROPERTY_VALUE(float, UPosition, PropOffsets_IceTexture.UPosition)
+	PROPERTY_VALUE(float, VDisplace, PropOffsets_IceTexture.VDisplace)
+	PROPERTY_VALUE(float, VPosition, PropOffsets_IceTexture.VPosition)
+	PROPERTY_VALUE(uint8_t, VertPanSpeed, PropOffsets_IceTexture.VertPanSpeed)
 };
 
 enum class ADropType : uint8_t
@@ -512,24 +533,24 @@ public:
 
 	void UpdateFrame() override;
 
-	uint8_t& DropType() { return Value<uint8_t>(PropOffsets_WaterTexture.DropType); }
-	ADrop* Drops() { return FixedArray<ADrop>(PropOffsets_WaterTexture.Drops); }
+	PROPERTY_VALUE(uint8_t, DropType, PropOffsets_WaterTexture.DropType)
+	PROPERTY_FIXEDARRAY(ADrop, Drops, PropOffsets_WaterTexture.Drops)
 	// ADrop& Drops() { return Value<ADrop>(PropOffsets_WaterTexture.Drops); }
-	uint8_t& FX_Amplitude() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Amplitude); }
-	uint8_t& FX_Depth() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Depth); }
-	uint8_t& FX_Frequency() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Frequency); }
-	uint8_t& FX_Phase() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Phase); }
-	uint8_t& FX_Radius() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Radius); }
-	uint8_t& FX_Size() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Size); }
-	uint8_t& FX_Speed() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Speed); }
-	uint8_t& FX_Time() { return Value<uint8_t>(PropOffsets_WaterTexture.FX_Time); }
-	int& NumDrops() { return Value<int>(PropOffsets_WaterTexture.NumDrops); }
-	int& OldWaveAmp() { return Value<int>(PropOffsets_WaterTexture.OldWaveAmp); }
-	uint8_t& RenderTable() { return Value<uint8_t>(PropOffsets_WaterTexture.RenderTable); }
-	int& SourceFields() { return Value<int>(PropOffsets_WaterTexture.SourceFields); }
-	uint8_t& WaterParity() { return Value<uint8_t>(PropOffsets_WaterTexture.WaterParity); }
-	uint8_t& WaterTable() { return Value<uint8_t>(PropOffsets_WaterTexture.WaterTable); }
-	uint8_t& WaveAmp() { return Value<uint8_t>(PropOffsets_WaterTexture.WaveAmp); }
+	PROPERTY_VALUE(uint8_t, FX_Amplitude, PropOffsets_WaterTexture.FX_Amplitude)
+	PROPERTY_VALUE(uint8_t, FX_Depth, PropOffsets_WaterTexture.FX_Depth)
+	PROPERTY_VALUE(uint8_t, FX_Frequency, PropOffsets_WaterTexture.FX_Frequency)
+	PROPERTY_VALUE(uint8_t, FX_Phase, PropOffsets_WaterTexture.FX_Phase)
+	PROPERTY_VALUE(uint8_t, FX_Radius, PropOffsets_WaterTexture.FX_Radius)
+	PROPERTY_VALUE(uint8_t, FX_Size, PropOffsets_WaterTexture.FX_Size)
+	PROPERTY_VALUE(uint8_t, FX_Speed, PropOffsets_WaterTexture.FX_Speed)
+	PROPERTY_VALUE(uint8_t, FX_Time, PropOffsets_WaterTexture.FX_Time)
+	PROPERTY_VALUE(int, NumDrops, PropOffsets_WaterTexture.NumDrops)
+	PROPERTY_VALUE(int, OldWaveAmp, PropOffsets_WaterTexture.OldWaveAmp)
+	PROPERTY_VALUE(uint8_t, RenderTable, PropOffsets_WaterTexture.RenderTable)
+	PROPERTY_VALUE(int, SourceFields, PropOffsets_WaterTexture.SourceFields)
+	PROPERTY_VALUE(uint8_t, WaterParity, PropOffsets_WaterTexture.WaterParity)
+	PROPERTY_VALUE(uint8_t, WaterTable, PropOffsets_WaterTexture.WaterTable)
+	PROPERTY_VALUE(uint8_t, WaveAmp, PropOffsets_WaterTexture.WaveAmp)
 
 protected:
 	void UpdateWater();
@@ -545,10 +566,10 @@ public:
 
 	void UpdateFrame() override;
 
-	uint8_t& BumpMapAngle() { return Value<uint8_t>(PropOffsets_WaveTexture.BumpMapAngle); }
-	uint8_t& BumpMapLight() { return Value<uint8_t>(PropOffsets_WaveTexture.BumpMapLight); }
-	uint8_t& PhongRange() { return Value<uint8_t>(PropOffsets_WaveTexture.PhongRange); }
-	uint8_t& PhongSize() { return Value<uint8_t>(PropOffsets_WaveTexture.PhongSize); }
+	PROPERTY_VALUE(uint8_t, BumpMapAngle, PropOffsets_WaveTexture.BumpMapAngle)
+	PROPERTY_VALUE(uint8_t, BumpMapLight, PropOffsets_WaveTexture.BumpMapLight)
+	PROPERTY_VALUE(uint8_t, PhongRange, PropOffsets_WaveTexture.PhongRange)
+	PROPERTY_VALUE(uint8_t, PhongSize, PropOffsets_WaveTexture.PhongSize)
 };
 
 class UWetTexture : public UWaterTexture
@@ -558,9 +579,9 @@ public:
 
 	void UpdateFrame() override;
 
-	int& LocalSourceBitmap() { return Value<int>(PropOffsets_WetTexture.LocalSourceBitmap); }
-	UTexture*& OldSourceTex() { return Value<UTexture*>(PropOffsets_WetTexture.OldSourceTex); }
-	UTexture*& SourceTexture() { return Value<UTexture*>(PropOffsets_WetTexture.SourceTexture); }
+	PROPERTY_VALUE(int, LocalSourceBitmap, PropOffsets_WetTexture.LocalSourceBitmap)
+	PROPERTY_VALUE(UTexture*, OldSourceTex, PropOffsets_WetTexture.OldSourceTex)
+	PROPERTY_VALUE(UTexture*, SourceTexture, PropOffsets_WetTexture.SourceTexture)
 };
 
 class UScriptedTexture : public UTexture
@@ -568,12 +589,12 @@ class UScriptedTexture : public UTexture
 public:
 	using UTexture::UTexture;
 
-	int& Junk1() { return Value<int>(PropOffsets_ScriptedTexture.Junk1); }
-	int& Junk2() { return Value<int>(PropOffsets_ScriptedTexture.Junk2); }
-	int& Junk3() { return Value<int>(PropOffsets_ScriptedTexture.Junk3); }
-	float& LocalTime() { return Value<float>(PropOffsets_ScriptedTexture.LocalTime); }
-	UActor*& NotifyActor() { return Value<UActor*>(PropOffsets_ScriptedTexture.NotifyActor); }
-	UTexture*& SourceTexture() { return Value<UTexture*>(PropOffsets_ScriptedTexture.SourceTexture); }
+	PROPERTY_VALUE(int, Junk1, PropOffsets_ScriptedTexture.Junk1)
+	PROPERTY_VALUE(int, Junk2, PropOffsets_ScriptedTexture.Junk2)
+	PROPERTY_VALUE(int, Junk3, PropOffsets_ScriptedTexture.Junk3)
+	PROPERTY_VALUE(float, LocalTime, PropOffsets_ScriptedTexture.LocalTime)
+	PROPERTY_VALUE(UActor*, NotifyActor, PropOffsets_ScriptedTexture.NotifyActor)
+	PROPERTY_VALUE(UTexture*, SourceTexture, PropOffsets_ScriptedTexture.SourceTexture)
 };
 
 class UPalette : public UObject
@@ -12,6 +12,8 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <stdio.h>
 #include <unistd.h>
 #ifdef __APPLE__
@@ -24,6 +26,9 @@ extern const char* __progname;
 #include "Utils/Exception.h"
 #include <string.h>
 #include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
 
 #ifdef WIN32
 
@@ -118,6 +123,76 @@ std::shared_ptr<File> File::open_existing(const std::string &filename)
 	return std::make_shared<FileImpl>(handle);
 }
 
+bool File::try_get_stats(const std::string& filename, FileStats& stats)
+{
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (GetFileAttributesEx(to_utf16(filename).c_str(), GetFileExInfoStandard, &data) == FALSE)
+		return false;
+	stats.size = (((uint64_t)data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+	stats.modified = (int64_t)((((uint64_t)data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime);
+	return true;
+}
+
+void File::replace(const std::string& from, const std::string& to)
+{
+	if (MoveFileEx(to_utf16(from).c_str(), to_utf16(to).c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == FALSE)
+		Exception::Throw("Could not replace " + to);
+}
+
+class MappedFileImpl : public MappedFile
+{
+public:
+	MappedFileImpl(HANDLE file, HANDLE mapping, const uint8_t* view, size_t viewSize) : file(file), mapping(mapping), view(view), viewSize(viewSize)
+	{
+	}
+
+	~MappedFileImpl()
+	{
+		UnmapViewOfFile(view);
+		CloseHandle(mapping);
+		CloseHandle(file);
+	}
+
+	const uint8_t* data() const override { return view; }
+	size_t size() const override { return viewSize; }
+
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+	const uint8_t* view = nullptr;
+	size_t viewSize = 0;
+};
+
+std::shared_ptr<MappedFile> MappedFile::open_existing(const std::string& filename)
+{
+	HANDLE file = CreateFile(to_utf16(filename).c_str(), FILE_READ_ACCESS, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (file == INVALID_HANDLE_VALUE)
+		Exception::Throw("Could not open " + filename);
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize) == FALSE || fileSize.QuadPart == 0 || (uint64_t)fileSize.QuadPart > (uint64_t)SIZE_MAX)
+	{
+		CloseHandle(file);
+		Exception::Throw("Could not map " + filename);
+	}
+
+	HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		Exception::Throw("Could not map " + filename);
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		Exception::Throw("Could not map " + filename);
+	}
+
+	return std::make_shared<MappedFileImpl>(file, mapping, static_cast<const uint8_t*>(view), (size_t)fileSize.QuadPart);
+}
+
 #else
 
 class FileImpl : public File
@@ -127,6 +202,11 @@ public:
 	{
 	}
 
+	~FileImpl()
+	{
+		fclose(handle);
+	}
+
 	int64_t size() override
 	{
 		auto pos = ftell(handle);
@@ -189,6 +269,67 @@ std::shared_ptr<File> File::open_existing(const std::string &filename)
 	return std::make_shared<FileImpl>(handle);
 }
 
+bool File::try_get_stats(const std::string& filename, FileStats& stats)
+{
+	struct stat statbuf;
+	if (stat(filename.c_str(), &statbuf) == -1)
+		return false;
+	stats.size = (uint64_t)statbuf.st_size;
+#ifdef __APPLE__
+	stats.modified = (int64_t)statbuf.st_mtimespec.tv_sec * 1000000000 + statbuf.st_mtimespec.tv_nsec;
+#else
+	stats.modified = (int64_t)statbuf.st_mtim.tv_sec * 1000000000 + statbuf.st_mtim.tv_nsec;
+#endif
+	return true;
+}
+
+void File::replace(const std::string& from, const std::string& to)
+{
+	if (rename(from.c_str(), to.c_str()) == -1)
+		Exception::Throw("Could not replace " + to);
+}
+
+class MappedFileImpl : public MappedFile
+{
+public:
+	MappedFileImpl(const uint8_t* view, size_t viewSize) : view(view), viewSize(viewSize)
+	{
+	}
+
+	~MappedFileImpl()
+	{
+		munmap((void*)view, viewSize);
+	}
+
+	const uint8_t* data() const override { return view; }
+	size_t size() const override { return viewSize; }
+
+	const uint8_t* view = nullptr;
+	size_t viewSize = 0;
+};
+
+std::shared_ptr<MappedFile> MappedFile::open_existing(const std::string& filename)
+{
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd == -1)
+		Exception::Throw("Could not open " + filename);
+
+	struct stat statbuf;
+	if (fstat(fd, &statbuf) == -1 || statbuf.st_size <= 0 || (uint64_t)statbuf.st_size > (uint64_t)SIZE_MAX)
+	{
+		close(fd);
+		Exception::Throw("Could not map " + filename);
+	}
+
+	size_t size = (size_t)statbuf.st_size;
+	void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // The mapping keeps its own reference to the file
+	if (view == MAP_FAILED)
+		Exception::Throw("Could not map " + filename);
+
+	return std::make_shared<MappedFileImpl>(static_cast<const uint8_t*>(view), size);
+}
+
 #endif
 
 void File::write_all_bytes(const std::string& filename, const void* data, size_t size)
@@ -203,6 +344,46 @@ void File::write_all_text(const std::string& filename, const std::string& text)
 	file->write(text.data(), text.size());
 }
 
+// Unique per process and call, so concurrent saves of the same file never share a temporary file
+static std::string GetTempFilename(const std::string& filename)
+{
+	static std::atomic<uint32_t> counter;
+#ifdef WIN32
+	unsigned long pid = GetCurrentProcessId();
+#else
+	unsigned long pid = (unsigned long)getpid();
+#endif
+	return filename + "." + std::to_string(pid) + "-" + std::to_string(counter++) + ".tmp";
+}
+
+void File::write_atomic(const std::string& filename, const std::function<void(File& file)>& writeContent)
+{
+	std::string tempFilename = GetTempFilename(filename);
+	try
+	{
+		{
+			auto file = create_always(tempFilename);
+			writeContent(*file);
+		}
+		replace(tempFilename, filename);
+	}
+	catch (...)
+	{
+		std::remove(tempFilename.c_str());
+		throw;
+	}
+}
+
+void File::write_all_bytes_atomic(const std::string& filename, const void* data, size_t size)
+{
+	write_atomic(filename, [&](File& file) { file.write(data, size); });
+}
+
+void File::write_all_text_atomic(const std::string& filename, const std::string& text)
+{
+	write_atomic(filename, [&](File& file) { file.write(text.data(), text.size()); });
+}
+
 Array<uint8_t> File::read_all_bytes(const std::string& filename)
 {
 	auto file = open_existing(filename);
@@ -433,6 +614,49 @@ std::string OS::executable_path()
 	#endif
 }
 
+std::string OS::cache_path()
+{
+	try
+	{
+#ifdef WIN32
+		const wchar_t* localAppData = _wgetenv(L"LOCALAPPDATA");
+		if (!localAppData)
+			return {};
+		std::string path = FilePath::combine(from_utf16(localAppData), "SurrealEngine");
+		Directory::make_directory(path);
+		path = FilePath::combine(path, "Cache");
+		Directory::make_directory(path);
+		return path;
+#else
+		std::string path;
+		const char* xdgCacheHome = std::getenv("XDG_CACHE_HOME");
+		const char* home = std::getenv("HOME");
+		if (xdgCacheHome && *xdgCacheHome)
+			path = xdgCacheHome;
+		else if (home && *home)
+			path = FilePath::combine(home, ".cache");
+		else
+			return {};
+		Directory::make_directory(path);
+		path = FilePath::combine(path, "surrealengine");
+		Directory::make_directory(path);
+		return path;
+#endif
+	}
+	catch (...)
+	{
+		return {};
+	}
+}
+
+std::string OS::cache_filename(const std::string& gameRootFolder, const std::string& name)
+{
+	std::string cachePath = cache_path();
+	if (cachePath.empty())
+		return {};
+	return FilePath::combine(cachePath, name + "-" + std::to_string(std::hash<std::string>()(gameRootFolder)) + ".bin");
+}
+
 std::string OS::get_default_font_name()
 {
 #ifdef WIN32
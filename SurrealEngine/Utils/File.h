@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <functional>
 
 enum class SeekPoint
 {
@@ -10,6 +11,12 @@ enum class SeekPoint
 	end
 };
 
+struct FileStats
+{
+	uint64_t size = 0;
+	int64_t modified = 0; // Last write time in platform specific units, with sub-second precision
+};
+
 class File
 {
 public:
@@ -30,10 +37,18 @@ public:
 
 	static void write_all_bytes(const std::string& filename, const void* data, size_t size);
 	static void write_all_text(const std::string& filename, const std::string& text);
+	// Writes to a temporary file and then replaces the target with it, so the target is never left partially written
+	static void write_all_bytes_atomic(const std::string& filename, const void* data, size_t size);
+	static void write_all_text_atomic(const std::string& filename, const std::string& text);
+	// Same for files written in several parts. The callback writes the whole content to the file it is given.
+	static void write_atomic(const std::string& filename, const std::function<void(File& file)>& writeContent);
 	static Array<uint8_t> read_all_bytes(const std::string& filename);
 	static std::string read_all_text(const std::string& filename);
 	static Array<std::string> read_all_lines(const std::string& filename);
 
+	static bool try_get_stats(const std::string& filename, FileStats& stats);
+	static void replace(const std::string& from, const std::string& to);
+
 	uint8_t read_uint8() { uint8_t v; read(&v, sizeof(uint8_t)); return v; }
 	int8_t read_int8() { int8_t v; read(&v, sizeof(int8_t)); return v; }
 	uint16_t read_uint16() { uint16_t v; read(&v, sizeof(uint16_t)); return v; }
@@ -51,6 +66,29 @@ public:
 	virtual uint64_t tell() = 0;
 };
 
+// Read-only view of a whole file mapped into memory
+class MappedFile
+{
+public:
+	static std::shared_ptr<MappedFile> open_existing(const std::string& filename);
+
+	static std::shared_ptr<MappedFile> try_open_existing(const std::string& filename)
+	{
+		try
+		{
+			return open_existing(filename);
+		}
+		catch (...)
+		{
+			return {};
+		}
+	}
+
+	virtual ~MappedFile() = default;
+	virtual const uint8_t* data() const = 0;
+	virtual size_t size() const = 0;
+};
+
 class Directory
 {
 public:
@@ -64,6 +102,12 @@ public:
 	static std::string executable_path();
 	static std::string get_default_font_name();
 	static std::string find_truetype_font(const std::string& font_name);
+
+	// Per user folder for data that can always be rebuilt. Created on first use. Empty if there is no such folder.
+	static std::string cache_path();
+
+	// File in the cache folder belonging to one game install. Empty if there is no cache folder.
+	static std::string cache_filename(const std::string& gameRootFolder, const std::string& name);
 };
 
 class FilePath
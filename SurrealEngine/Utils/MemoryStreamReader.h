@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <stdexcept>
+
+// Reads back data written by MemoryStreamWriter. Throws if reading past the end of the data.
+class MemoryStreamReader
+{
+public:
+	MemoryStreamReader(const uint8_t* data, size_t size) : data(data), size(size) { }
+
+	template<typename T>
+	T Read()
+	{
+		T value;
+		ReadBytes(&value, sizeof(T));
+		return value;
+	}
+
+	void ReadBytes(void* d, size_t s)
+	{
+		memcpy(d, Get(s), s);
+	}
+
+	const uint8_t* Get(size_t s)
+	{
+		if (s > size - pos)
+			throw std::runtime_error("Unexpected end of data");
+		const uint8_t* p = data + pos;
+		pos += s;
+		return p;
+	}
+
+	// Length prefixed string. The view points into the data.
+	std::string_view ReadString()
+	{
+		uint32_t len = Read<uint32_t>();
+		return std::string_view((const char*)Get(len), len);
+	}
+
+	bool AtEnd() const { return pos == size; }
+
+private:
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+	size_t pos = 0;
+};
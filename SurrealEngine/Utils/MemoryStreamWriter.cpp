@@ -36,19 +36,20 @@ void MemoryStreamWriter::Reserve(size_t capacity)
 
 void MemoryStreamWriter::Write(const void* buf, size_t size)
 {
-	const uint8_t* buf8 = reinterpret_cast<const uint8_t*>(buf);
-	for (size_t i = 0; i < size; i++)
-	{
-		if (pos == data.size())
-		{
-			data.push_back(buf8[i]);
-		}
-		else
-		{
-			data[pos] = buf8[i];
-		}
-		pos++;
-	}
+	if (size == 0)
+		return;
+
+	size_t end = pos + size;
+	if (end > data.size())
+		data.resize(end);
+	memcpy(data.data() + pos, buf, size);
+	pos = end;
+}
+
+void MemoryStreamWriter::WriteString(const std::string& str)
+{
+	*this << (uint32_t)str.size();
+	Write(str.data(), str.size());
 }
 
 void MemoryStreamWriter::Seek(size_t newpos, int base)
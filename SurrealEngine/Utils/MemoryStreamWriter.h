@@ -14,6 +14,8 @@ public:
 
 	void Reserve(size_t capacity);
 	void Write(const void* buf, size_t size);
+	// Length prefixed, as read back by MemoryStreamReader::ReadString. The << operator writes the characters only.
+	void WriteString(const std::string& str);
 	void Seek(size_t pos, int base);
 	size_t Tell() const;
 
@@ -8,7 +8,7 @@
 #include "Engine.h"
 #include "Package/PackageManager.h"
 
-ExpressionEvalResult ExpressionEvaluator::Eval(Expression* expr, UObject* self, UObject* context, void* localVariables)
+ExpressionEvalResult ExpressionEvaluator::Eval(Expression* expr, UObject* self, UObject* context, void* localVariables, bool lvalue)
 {
 	auto oldExpr = Frame::StepExpression;
 	Frame::StepExpression = expr;
@@ -25,6 +25,7 @@ ExpressionEvalResult ExpressionEvaluator::Eval(Expression* expr, UObject* self,
 	evaluator.Self = self;
 	evaluator.Context = context;
 	evaluator.LocalVariables = localVariables;
+	evaluator.LValue = lvalue;
 	expr->Visit(&evaluator);
 	Frame::StepExpression = oldExpr;
 	return std::move(evaluator.Result);
@@ -37,15 +38,17 @@ void ExpressionEvaluator::Expr(LocalVariableExpression* expr)
 
 void ExpressionEvaluator::Expr(InstanceVariableExpression* expr)
 {
-	Result.Value = ExpressionValue::Variable(Context->PropertyData.Data, expr->Variable);
+	size_t offset = expr->Variable->DataOffset.DataOffset;
+	void* base = LValue ? Context->PropertyData.WritableBase(offset) : Context->PropertyData.ReadBase(offset);
+	Result.Value = ExpressionValue::Variable(base, expr->Variable);
 }
 
 void ExpressionEvaluator::Expr(DefaultVariableExpression* expr)
 {
-	if (UObject::TryCast<UClass>(Context))
-		Result.Value = ExpressionValue::Variable(Context->PropertyData.Data, expr->Variable);
-	else
-		Result.Value = ExpressionValue::Variable(Context->Class->GetDefaultObject<UObject>()->PropertyData.Data, expr->Variable);
+	UObject* defaults = UObject::TryCast<UClass>(Context) ? Context : Context->Class->GetDefaultObject<UObject>();
+	size_t offset = expr->Variable->DataOffset.DataOffset;
+	void* base = LValue ? defaults->PropertyData.WritableBase(offset) : defaults->PropertyData.ReadBase(offset);
+	Result.Value = ExpressionValue::Variable(base, expr->Variable);
 }
 
 void ExpressionEvaluator::Expr(ReturnExpression* expr)
@@ -120,7 +123,7 @@ void ExpressionEvaluator::Expr(EatStringExpression* expr)
 
 void ExpressionEvaluator::Expr(LetExpression* expr)
 {
-	ExpressionValue lvalue = Eval(expr->LeftSide).Value;
+	ExpressionValue lvalue = EvalLValue(expr->LeftSide).Value;
 	ExpressionValue rvalue = Eval(expr->RightSide).Value;
 	lvalue.Store(rvalue);
 	Result.Value = std::move(lvalue);
@@ -128,7 +131,7 @@ void ExpressionEvaluator::Expr(LetExpression* expr)
 
 void ExpressionEvaluator::Expr(LetBoolExpression* expr)
 {
-	ExpressionValue lvalue = Eval(expr->LeftSide).Value;
+	ExpressionValue lvalue = EvalLValue(expr->LeftSide).Value;
 	ExpressionValue rvalue = Eval(expr->RightSide).Value;
 	lvalue.Store(rvalue);
 	Result.Value = std::move(lvalue);
@@ -167,7 +170,7 @@ void ExpressionEvaluator::Expr(ClassContextExpression* expr)
 	UClass* cls = UObject::TryCast<UClass>(object.ToObject());
 	if (cls)
 	{
-		Result = Eval(expr->ContextExpr, Self, cls->GetDefaultObject<UObject>(), LocalVariables);
+		Result = Eval(expr->ContextExpr, Self, cls->GetDefaultObject<UObject>(), LocalVariables, LValue);
 	}
 	else
 	{
@@ -205,7 +208,7 @@ void ExpressionEvaluator::Expr(SelfExpression* expr)
 
 void ExpressionEvaluator::Expr(SkipExpression* expr)
 {
-	Result = Eval(expr->Value);
+	Result = Eval(expr->Value, Self, Context, LocalVariables, LValue);
 }
 
 void ExpressionEvaluator::Expr(ContextExpression* expr)
@@ -214,7 +217,7 @@ void ExpressionEvaluator::Expr(ContextExpression* expr)
 	UObject* context = value.ToObject();
 	if (context)
 	{
-		Result = Eval(expr->ContextExpr, Self, context, LocalVariables);
+		Result = Eval(expr->ContextExpr, Self, context, LocalVariables, LValue);
 	}
 	else
 	{
@@ -225,7 +228,7 @@ void ExpressionEvaluator::Expr(ContextExpression* expr)
 void ExpressionEvaluator::Expr(ArrayElementExpression* expr)
 {
 	int index = Eval(expr->Index).Value.ToInt();
-	auto arrayval = Eval(expr->Array).Value;
+	auto arrayval = Eval(expr->Array, Self, Context, LocalVariables, LValue).Value;
 	if (arrayval.IsVariable())
 	{
 		Result.Value = arrayval.ItemAt(index);
@@ -318,7 +321,7 @@ void ExpressionEvaluator::Expr(IntConstByteExpression* expr)
 
 void ExpressionEvaluator::Expr(BoolVariableExpression* expr)
 {
-	Result.Value = Eval(expr->Variable).Value;
+	Result.Value = Eval(expr->Variable, Self, Context, LocalVariables, LValue).Value;
 }
 
 void ExpressionEvaluator::Expr(DynamicCastExpression* expr)
@@ -364,7 +367,7 @@ void ExpressionEvaluator::Expr(StructCmpNeExpression* expr)
 void ExpressionEvaluator::Expr(StructMemberExpression* expr)
 {
 	if (expr->Field)
-		Result.Value = Eval(expr->Value).Value.Member(expr->Field);
+		Result.Value = Eval(expr->Value, Self, Context, LocalVariables, LValue).Value.Member(expr->Field);
 	else
 		Frame::ThrowException("Null field encountered in struct member expression");
 }
@@ -651,10 +654,22 @@ void ExpressionEvaluator::Call(UFunction* func, const Array<Expression*>& exprAr
 	}
 	else
 	{
+		// Out parameters are written to, everything else is only read
 		Array<ExpressionValue> args;
 		args.reserve(exprArgs.size());
+		UField* field = func->Children;
 		for (Expression* arg : exprArgs)
-			args.push_back(Eval(arg, Self, Self, LocalVariables).Value);
+		{
+			UProperty* parm = nullptr;
+			for (; field && !parm; field = field->Next)
+			{
+				UProperty* prop = UObject::TryCast<UProperty>(field);
+				if (prop && AllFlags(prop->PropFlags, PropertyFlags::Parm))
+					parm = prop;
+			}
+			bool outParm = parm && AllFlags(parm->PropFlags, PropertyFlags::OutParm);
+			args.push_back(Eval(arg, Self, Self, LocalVariables, outParm).Value);
+		}
 		Result.Value = Frame::Call(func, Context, std::move(args));
 	}
 }
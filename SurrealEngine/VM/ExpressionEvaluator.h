@@ -33,10 +33,11 @@ struct ExpressionEvalResult
 class ExpressionEvaluator : ExpressionVisitor
 {
 public:
-	static ExpressionEvalResult Eval(Expression* expr, UObject* self, UObject* context, void* localVariables);
+	static ExpressionEvalResult Eval(Expression* expr, UObject* self, UObject* context, void* localVariables, bool lvalue = false);
 
 private:
 	ExpressionEvalResult Eval(Expression* expr) { return Eval(expr, Self, Context, LocalVariables); }
+	ExpressionEvalResult EvalLValue(Expression* expr) { return Eval(expr, Self, Context, LocalVariables, true); }
 
 	void Expr(LocalVariableExpression* expr) override;
 	void Expr(InstanceVariableExpression* expr) override;
@@ -133,4 +134,7 @@ private:
 	UObject* Self = nullptr;
 	UObject* Context = nullptr;
 	void* LocalVariables = nullptr;
+
+	// Set while evaluating the target of an assignment or an out parameter. Only then are shared property groups copied.
+	bool LValue = false;
 };
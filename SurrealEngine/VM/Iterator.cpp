@@ -207,13 +207,16 @@ VisibleActorsIterator::VisibleActorsIterator(UActor* Caller, UObject* BaseClass,
 		// Our checks:
 		// * Whether the actor we're dealing with is not hidden and is the class of BaseClass
 		// * Then whether the distance of the actor from our given Location is no more than Radius
-		if (!levelActor->bHidden() && levelActor->IsA(BaseClass->Name) && 
-			length(levelActor->Location() - Location) <= Radius && Caller->FastTrace(levelActor->Location(), Location))
+		// * Then whether a FastTrace from Location to the actor is not blocked by the world
+		if (!levelActor->bHidden() && levelActor->IsA(BaseClass->Name) &&
+			length(levelActor->Location() - Location) <= Radius)
 		{
 			VisibleActors.push_back(levelActor);
 		}
 	}
 
+	engine->Level->RemoveOccludedActors(VisibleActors, Location, false, Caller, false);
+
 	iterator = VisibleActors.begin();
 }
 